@@ -0,0 +1,120 @@
+// Makes an anti-aliased GFXalphaFont (see Adafruit_AlphaFont.h) from one
+// of the 1-bit GFXfont headers, by resampling it down. Each output pixel's
+// alpha is how much of it the source glyph's lit pixels cover, so the
+// source should be a size larger than the output: FreeMono24pt7b scaled by
+// 3/4 makes an 18 point font, by 1/2 a 12 point one.
+//
+// Build from this directory, naming the source font, then run it with the
+// output font name and the scale:
+// g++ -std=c++11 -I../src -DFONT=FreeMono24pt7b -DFONT_FILE='"FreeMono24pt7b.h"' fontalpha.cpp -o fontalpha
+// ./fontalpha FreeMono18pt4a 3 4 > ../src/FreeMono18pt4a.h
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#define PROGMEM
+#include "gfxfont.h"
+#include FONT_FILE
+
+// Floor and ceiling of a * num / den for any sign of a
+static int scaleFloor(int a, int num, int den) {
+	int p = a * num;
+	return (p >= 0) ? p / den : -((-p + den - 1) / den);
+}
+static int scaleCeil(int a, int num, int den) {
+	return -scaleFloor(-a, num, den);
+}
+
+// Length of the overlap of [a0, a1) and [b0, b1)
+static int overlap(int a0, int a1, int b0, int b1) {
+	int lo = (a0 > b0) ? a0 : b0, hi = (a1 < b1) ? a1 : b1;
+	return (hi > lo) ? hi - lo : 0;
+}
+
+int main(int argc, char *argv[]) {
+	if (argc != 4) {
+		fprintf(stderr, "usage: %s name num den\n", argv[0]);
+		return 1;
+	}
+	const char *name = argv[1];
+	int num = atoi(argv[2]), den = atoi(argv[3]);
+	if ((num <= 0) || (den <= 0) || (num > den)) {
+		fprintf(stderr, "scale num/den must be > 0 and <= 1\n");
+		return 1;
+	}
+	const GFXfont &src = FONT;
+
+	std::vector<uint8_t> bitmap;
+	std::vector<GFXglyph> glyphs;
+	for (int c = src.first; c <= src.last; c++) {
+		const GFXglyph &g = src.glyph[c - src.first];
+		GFXglyph out;
+		out.bitmapOffset = bitmap.size();
+		out.xAdvance = (g.xAdvance * num + den / 2) / den;
+		if (!g.width || !g.height) {
+			out.width = out.height = 0;
+			out.xOffset = 0;
+			out.yOffset = 1;
+			glyphs.push_back(out);
+			continue;
+		}
+
+		// Output box, in output pixels from the origin
+		int x0 = scaleFloor(g.xOffset, num, den),
+		    y0 = scaleFloor(g.yOffset, num, den),
+		    x1 = scaleCeil(g.xOffset + g.width, num, den),
+		    y1 = scaleCeil(g.yOffset + g.height, num, den);
+		out.xOffset = x0;
+		out.yOffset = y0;
+		out.width   = x1 - x0;
+		out.height  = y1 - y0;
+
+		// In units of 1/num output pixel = 1/den source pixel, source pixel
+		// i spans [i * num, (i + 1) * num) and output pixel o spans
+		// [o * den, (o + 1) * den), so the overlaps are exact
+		int n = 0;
+		for (int oy = y0; oy < y1; oy++) {
+			for (int ox = x0; ox < x1; ox++, n++) {
+				long covered = 0;
+				for (int sy = 0; sy < g.height; sy++) {
+					int ly = overlap((g.yOffset + sy) * num, (g.yOffset + sy + 1) * num,
+					                 oy * den, (oy + 1) * den);
+					if (!ly) continue;
+					for (int sx = 0; sx < g.width; sx++) {
+						int bit = sy * g.width + sx;
+						if (!(src.bitmap[g.bitmapOffset + bit / 8] & (0x80 >> (bit & 7)))) continue;
+						covered += (long)ly * overlap((g.xOffset + sx) * num, (g.xOffset + sx + 1) * num,
+						                              ox * den, (ox + 1) * den);
+					}
+				}
+				long full  = (long)den * den;
+				int  alpha = (covered * 15 + full / 2) / full;
+				if (n & 1) {
+					bitmap.back() |= alpha;
+				} else {
+					bitmap.push_back(alpha << 4);
+				}
+			}
+		}
+		glyphs.push_back(out);
+	}
+
+	printf("const uint8_t %sBitmaps[] PROGMEM = {\n ", name);
+	for (size_t i = 0; i < bitmap.size(); i++) {
+		printf(" 0x%02X%s", bitmap[i], (i + 1 == bitmap.size()) ? " };\n\n" : ((i % 12 == 11) ? ",\n " : ","));
+	}
+	printf("const GFXglyph %sGlyphs[] PROGMEM = {\n", name);
+	for (size_t i = 0; i < glyphs.size(); i++) {
+		const GFXglyph &g = glyphs[i];
+		int c = src.first + i;
+		printf("  { %5u, %3u, %3u, %3u, %4d, %4d }%s // 0x%02X '%c'\n", g.bitmapOffset, g.width, g.height,
+		       g.xAdvance, g.xOffset, g.yOffset, (i + 1 == glyphs.size()) ? " };" : ",  ", c, c);
+	}
+	printf("\nconst GFXalphaFont %s PROGMEM = {\n", name);
+	printf("  (const uint8_t  *)%sBitmaps,\n", name);
+	printf("  (const GFXglyph *)%sGlyphs,\n", name);
+	printf("  0x%02X, 0x%02X, %d };\n\n", src.first, src.last, (src.yAdvance * num + den / 2) / den);
+	printf("// Approx. %lu bytes\n", (unsigned long)(bitmap.size() + glyphs.size() * 7 + 7));
+	return 0;
+}
@@ -0,0 +1,102 @@
+// Makes a run-length encoded GFXrleImage (see Adafruit_RLEImage.h) from an
+// uncompressed 24- or 32-bit BMP file. Colors are reduced to 5-6-5. The runs
+// hold the colors, or with 256 or fewer colors indexes into an 8-bit
+// palette, or with 16 or fewer a 4-bit one, whichever comes out smallest.
+// Give 16 as the last argument to always store colors. For a PNG or
+// anything else, save it as a 24-bit BMP first (e.g. ImageMagick:
+// convert icon.png -type TrueColor BMP3:icon.bmp).
+//
+// Build from this directory, then run it with the image name and file:
+// g++ -std=c++11 imageconvert.cpp -o imageconvert
+// ./imageconvert walkIcon walk.bmp > ../src/walkIcon.h
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "rleencode.h"
+
+static uint32_t le(const std::vector<uint8_t> &f, size_t at, int bytes) {
+	uint32_t v = 0;
+	for (int i = bytes - 1; i >= 0; i--) v = (v << 8) | f[at + i];
+	return v;
+}
+
+int main(int argc, char *argv[]) {
+	if ((argc != 3) && (argc != 4)) {
+		fprintf(stderr, "usage: %s name file.bmp [16]\n", argv[0]);
+		return 1;
+	}
+	const char *name = argv[1];
+	FILE *in = fopen(argv[2], "rb");
+	if (!in) {
+		perror(argv[2]);
+		return 1;
+	}
+	std::vector<uint8_t> f;
+	for (int c; (c = fgetc(in)) != EOF;) f.push_back(c);
+	fclose(in);
+
+	if ((f.size() < 54) || (f[0] != 'B') || (f[1] != 'M')) {
+		fprintf(stderr, "%s: not a BMP file\n", argv[2]);
+		return 1;
+	}
+	uint32_t offset = le(f, 10, 4), compression = le(f, 30, 4);
+	int32_t  width = (int32_t)le(f, 18, 4), height = (int32_t)le(f, 22, 4);
+	int      depth = le(f, 28, 2);
+	bool     topDown = height < 0;
+	if (topDown) height = -height;
+	if (((depth != 24) && (depth != 32)) || ((compression != 0) && (compression != 3)) ||
+	    (width <= 0) || (width > 0xFFFF) || (height == 0) || (height > 0xFFFF)) {
+		fprintf(stderr, "%s: only uncompressed 24- and 32-bit BMPs up to 65535 pixels a side\n", argv[2]);
+		return 1;
+	}
+	size_t stride = ((size_t)width * (depth / 8) + 3) & ~(size_t)3;
+	if (offset + stride * height > f.size()) {
+		fprintf(stderr, "%s: file is short\n", argv[2]);
+		return 1;
+	}
+
+	// Pixels top to bottom, and the colors in order of first use
+	std::vector<uint16_t> pixels, palette;
+	for (int32_t y = 0; y < height; y++) {
+		size_t row = offset + stride * (topDown ? y : height - 1 - y);
+		for (int32_t x = 0; x < width; x++) {
+			const uint8_t *bgr = &f[row + x * (depth / 8)];
+			uint16_t c = ((bgr[2] & 0xF8) << 8) | ((bgr[1] & 0xFC) << 3) | (bgr[0] >> 3);
+			pixels.push_back(c);
+			if ((palette.size() <= 256) && (std::find(palette.begin(), palette.end(), c) == palette.end())) {
+				palette.push_back(c);
+			}
+		}
+	}
+	// The smallest of the encodings the colors allow
+	int bits = 16;
+	std::vector<uint8_t> data = rleEncode(pixels, palette, 16);
+	for (int b = 8; (b >= 4) && (argc == 3) && (palette.size() <= (1u << b)); b -= 4) {
+		std::vector<uint8_t> d = rleEncode(pixels, palette, b);
+		if (d.size() + palette.size() * 2 < data.size()) {
+			data = d;
+			bits = b;
+		}
+	}
+
+	printf("const uint8_t %sData[] PROGMEM = {\n ", name);
+	for (size_t i = 0; i < data.size(); i++) {
+		printf(" 0x%02X%s", data[i], (i + 1 == data.size()) ? " };\n\n" : ((i % 12 == 11) ? ",\n " : ","));
+	}
+	if (bits != 16) {
+		printf("const uint16_t %sPalette[] PROGMEM = {\n ", name);
+		for (size_t i = 0; i < palette.size(); i++) {
+			printf(" 0x%04X%s", palette[i], (i + 1 == palette.size()) ? " };\n\n" : ((i % 8 == 7) ? ",\n " : ","));
+		}
+	}
+	printf("const GFXrleImage %s PROGMEM = {\n", name);
+	printf("  %sData, %s%s, %d, %d, %d };\n\n", name, (bits == 16) ? "NULL" : name, (bits == 16) ? "" : "Palette",
+	       width, height, bits);
+	printf("// %d x %d, %lu bytes (raw 565 is %lu)\n", width, height,
+	       (unsigned long)(data.size() + ((bits == 16) ? 0 : palette.size() * 2) + 12),
+	       (unsigned long)pixels.size() * 2);
+	return 0;
+}
@@ -0,0 +1,67 @@
+// The run-length encoder imageconvert.cpp makes GFXrleImage data with (see
+// Adafruit_RLEImage.h), here so the library's tests can check
+// drawRLEImage() against what the tool actually writes.
+#ifndef _RLEENCODE_H_
+#define _RLEENCODE_H_
+
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+
+// Shortest run worth a repeat packet, by bits per value
+static size_t rleMinRun(int bits) {
+	return (bits == 16) ? 2 : ((bits == 8) ? 3 : 4);
+}
+
+// Run-length encode pixels, as colors or as indexes into the palette
+static std::vector<uint8_t> rleEncode(const std::vector<uint16_t> &pixels, const std::vector<uint16_t> &palette,
+                                      int bits) {
+	std::vector<uint16_t> v;
+	for (size_t i = 0; i < pixels.size(); i++) {
+		v.push_back((bits == 16) ? pixels[i] :
+		            (uint16_t)(std::find(palette.begin(), palette.end(), pixels[i]) - palette.begin()));
+	}
+
+	std::vector<uint8_t> data;
+	std::vector<uint16_t> literal;
+	for (size_t i = 0; i <= v.size(); ) {
+		size_t run = 0;
+		if (i < v.size()) {
+			for (run = 1; (i + run < v.size()) && (run < 128) && (v[i + run] == v[i]); run++) {}
+		}
+		if ((i == v.size()) || (run >= rleMinRun(bits)) || (literal.size() == 128)) {
+			if (!literal.empty()) {
+				data.push_back(literal.size() - 1);
+				for (size_t j = 0; j < literal.size(); j++) {
+					if (bits == 16) {
+						data.push_back(literal[j] >> 8);
+						data.push_back(literal[j] & 0xFF);
+					} else if (bits == 8) {
+						data.push_back(literal[j]);
+					} else if (j & 1) {
+						data.back() |= literal[j];
+					} else {
+						data.push_back(literal[j] << 4);
+					}
+				}
+				literal.clear();
+			}
+			if (i == v.size()) break;
+		}
+		if (run >= rleMinRun(bits)) {
+			data.push_back(0x80 | (run - 1));
+			if (bits == 16) {
+				data.push_back(v[i] >> 8);
+				data.push_back(v[i] & 0xFF);
+			} else {
+				data.push_back((bits == 8) ? v[i] : (v[i] << 4));
+			}
+			i += run;
+		} else {
+			literal.push_back(v[i++]);
+		}
+	}
+	return data;
+}
+
+#endif // _RLEENCODE_H_
@@ -0,0 +1,254 @@
+/*!
+ * @file Adafruit_AlphaFont.cpp
+ *
+ * Part of Adafruit's GFX graphics library. See Adafruit_AlphaFont.h.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_AlphaFont.h"
+#ifdef __AVR__
+  #include <avr/pgmspace.h>
+#elif defined(ESP8266) || defined(ESP32)
+  #include <pgmspace.h>
+#endif
+
+#ifndef pgm_read_byte
+ #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#endif
+#ifndef pgm_read_word
+ #define pgm_read_word(addr) (*(const unsigned short *)(addr))
+#endif
+#ifndef pgm_read_dword
+ #define pgm_read_dword(addr) (*(const unsigned long *)(addr))
+#endif
+
+#if !defined(__INT_MAX__) || (__INT_MAX__ > 0xFFFF)
+ #define pgm_read_pointer(addr) ((void *)pgm_read_dword(addr))
+#else
+ #define pgm_read_pointer(addr) ((void *)pgm_read_word(addr))
+#endif
+
+#ifndef min
+ #define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef max
+ #define max(a,b) (((a) > (b)) ? (a) : (b))
+#endif
+
+inline const GFXglyph *alphaGlyph(const GFXalphaFont *font, uint8_t c)
+{
+#ifdef __AVR__
+    return &(((const GFXglyph *)pgm_read_pointer(&font->glyph))[c]);
+#else
+    return font->glyph + c;
+#endif
+}
+
+inline const uint8_t *alphaBitmap(const GFXalphaFont *font)
+{
+#ifdef __AVR__
+    return (const uint8_t *)pgm_read_pointer(&font->bitmap);
+#else
+    return font->bitmap;
+#endif
+}
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate anti-aliased text output, white on black to start
+    @param   gfx   Display or canvas to draw on
+    @param   font  Font to draw with, from fontconvert/fontalpha.cpp
+*/
+/**************************************************************************/
+GFXalphaText::GFXalphaText(Adafruit_GFX &gfx, const GFXalphaFont *font) :
+  gfx(gfx), font(font) {
+    cursor_x = cursor_y = 0;
+    wrap     = true;
+    setTextColor(0xFFFF, 0x0000);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Set the text color and the background it's blended against.
+             The 16 blends are worked out here, once, per channel and
+             rounded, so drawing is a table lookup per pixel.
+    @param   color  16-bit 5-6-5 text color
+    @param   bg     16-bit 5-6-5 color of the background under the text
+*/
+/**************************************************************************/
+void GFXalphaText::setTextColor(uint16_t color, uint16_t bg) {
+    int16_t r0 = bg >> 11, g0 = (bg >> 5) & 0x3F, b0 = bg & 0x1F,
+            dr = (color >> 11) - r0,
+            dg = ((color >> 5) & 0x3F) - g0,
+            db = (color & 0x1F) - b0;
+    for(int16_t a=0; a<16; a++) {
+        // Round half away from zero, so a ramp is the same both ways
+        int16_t r = r0 + (dr * a + (dr < 0 ? -7 : 7)) / 15,
+                g = g0 + (dg * a + (dg < 0 ? -7 : 7)) / 15,
+                b = b0 + (db * a + (db < 0 ? -7 : 7)) / 15;
+        blend[a] = (r << 11) | (g << 5) | b;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw one character, its whole bounding box, at a given origin
+             without moving the cursor
+    @param   x  Left end of the baseline
+    @param   y  Baseline
+    @param   c  Character
+*/
+/**************************************************************************/
+void GFXalphaText::drawChar(int16_t x, int16_t y, unsigned char c) {
+    uint8_t first = pgm_read_byte(&font->first);
+    if((c < first) || (c > (uint8_t)pgm_read_byte(&font->last))) return;
+
+    const GFXglyph *glyph  = alphaGlyph(font, c - first);
+    const uint8_t  *bitmap = alphaBitmap(font) +
+                             pgm_read_word(&glyph->bitmapOffset);
+    uint8_t  w  = pgm_read_byte(&glyph->width),
+             h  = pgm_read_byte(&glyph->height);
+    int8_t   xo = pgm_read_byte(&glyph->xOffset),
+             yo = pgm_read_byte(&glyph->yOffset);
+    if(!w || !h) return;
+    x += xo;
+    y += yo;
+    if((x >= gfx.width()) || (y >= gfx.height()) ||
+       (x + w <= 0) || (y + h <= 0)) return;
+
+    uint32_t n = 0; // Pixel (nibble) index into the glyph
+    gfx.startWrite();
+    if((x >= 0) && (y >= 0) && (x + w <= gfx.width()) &&
+       (y + h <= gfx.height()) && (w <= GFX_ALPHA_SPAN) &&
+       gfx.writeWindow(x, y, w, h)) {
+        // The whole box in one window, a row at a time
+        uint16_t span[GFX_ALPHA_SPAN];
+        for(uint8_t yy=0; yy<h; yy++) {
+            for(uint8_t xx=0; xx<w; xx++, n++) {
+                uint8_t b = pgm_read_byte(&bitmap[n >> 1]);
+                span[xx]  = blend[(n & 1) ? (b & 0x0F) : (b >> 4)];
+            }
+            gfx.writeWindowPixels(span, w);
+        }
+    } else {
+        for(uint8_t yy=0; yy<h; yy++) {
+            for(uint8_t xx=0; xx<w; xx++, n++) {
+                uint8_t b = pgm_read_byte(&bitmap[n >> 1]);
+                gfx.writePixel(x + xx, y + yy,
+                  blend[(n & 1) ? (b & 0x0F) : (b >> 4)]);
+            }
+        }
+    }
+    gfx.endWrite();
+}
+
+/**************************************************************************/
+/*!
+   @brief    Print one character at the cursor and advance it, used to
+             support print(). '\\n' moves to the start of the next line.
+    @param   c  The 8-bit ascii character to write
+*/
+/**************************************************************************/
+#if ARDUINO >= 100
+size_t GFXalphaText::write(uint8_t c) {
+#else
+void GFXalphaText::write(uint8_t c) {
+#endif
+    if(c == '\n') {
+        cursor_x  = 0;
+        cursor_y += (uint8_t)pgm_read_byte(&font->yAdvance);
+    } else if(c != '\r') {
+        uint8_t first = pgm_read_byte(&font->first);
+        if((c >= first) && (c <= (uint8_t)pgm_read_byte(&font->last))) {
+            const GFXglyph *glyph = alphaGlyph(font, c - first);
+            uint8_t w  = pgm_read_byte(&glyph->width);
+            int8_t  xo = pgm_read_byte(&glyph->xOffset);
+            if(w && wrap && ((cursor_x + xo + w) > gfx.width())) {
+                cursor_x  = 0;
+                cursor_y += (uint8_t)pgm_read_byte(&font->yAdvance);
+            }
+            drawChar(cursor_x, cursor_y, c);
+            cursor_x += (uint8_t)pgm_read_byte(&glyph->xAdvance);
+        }
+    }
+#if ARDUINO >= 100
+    return 1;
+#endif
+}
+
+/**************************************************************************/
+/*!
+   @brief    Get the box printing a string would draw in, the way write()
+             places it (newlines go back to the left edge, x 0)
+    @param   str  The string
+    @param   x    Cursor x, the left end of the baseline
+    @param   y    Cursor y
+    @param   x1   Set to the box's left edge
+    @param   y1   Set to the box's top edge
+    @param   w    Set to the box's width, 0 if nothing would be drawn
+    @param   h    Set to the box's height
+*/
+/**************************************************************************/
+void GFXalphaText::getTextBounds(const char *str, int16_t x, int16_t y,
+  int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h) {
+    uint8_t first = pgm_read_byte(&font->first),
+            last  = pgm_read_byte(&font->last),
+            yAdv  = pgm_read_byte(&font->yAdvance);
+    int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -0x7FFF, maxy = -0x7FFF;
+    for(; *str; str++) {
+        uint8_t c = *str;
+        if(c == '\n') {
+            x  = 0;
+            y += yAdv;
+        } else if((c >= first) && (c <= last)) {
+            const GFXglyph *glyph = alphaGlyph(font, c - first);
+            uint8_t gw = pgm_read_byte(&glyph->width),
+                    gh = pgm_read_byte(&glyph->height);
+            int8_t  xo = pgm_read_byte(&glyph->xOffset),
+                    yo = pgm_read_byte(&glyph->yOffset);
+            if(gw && wrap && ((x + xo + gw) > gfx.width())) {
+                x  = 0;
+                y += yAdv;
+            }
+            if(gw && gh) {
+                minx = min(minx, (int16_t)(x + xo));
+                miny = min(miny, (int16_t)(y + yo));
+                maxx = max(maxx, (int16_t)(x + xo + gw - 1));
+                maxy = max(maxy, (int16_t)(y + yo + gh - 1));
+            }
+            x += (uint8_t)pgm_read_byte(&glyph->xAdvance);
+        }
+    }
+    if(maxx >= minx) {
+        *x1 = minx;
+        *y1 = miny;
+        *w  = maxx - minx + 1;
+        *h  = maxy - miny + 1;
+    } else {
+        *x1 = x;
+        *y1 = y;
+        *w  = *h = 0;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Get how far printing a string would move the cursor, e.g.
+             to center it
+    @param   str  The string, a single line
+    @returns Width in pixels
+*/
+/**************************************************************************/
+int16_t GFXalphaText::textWidth(const char *str) {
+    uint8_t first = pgm_read_byte(&font->first),
+            last  = pgm_read_byte(&font->last);
+    int16_t w = 0;
+    for(; *str; str++) {
+        uint8_t c = *str;
+        if((c >= first) && (c <= last)) {
+            w += (uint8_t)pgm_read_byte(&alphaGlyph(font, c - first)->xAdvance);
+        }
+    }
+    return w;
+}
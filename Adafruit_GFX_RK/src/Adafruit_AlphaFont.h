@@ -0,0 +1,102 @@
+/*!
+ * @file Adafruit_AlphaFont.h
+ *
+ * Part of Adafruit's GFX graphics library. Anti-aliased text: fonts that
+ * store 4 bits of coverage per pixel instead of 1, made from the regular
+ * GFXfont tables with fontconvert/fontalpha.cpp, and a Print class that
+ * blends them against a known background color.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _ADAFRUIT_ALPHAFONT_H_
+#define _ADAFRUIT_ALPHAFONT_H_
+
+#include "Adafruit_GFX.h"
+
+#if !defined(GFX_ALPHA_SPAN)
+ #define GFX_ALPHA_SPAN 64 ///< Widest glyph row sent as one block, in pixels
+#endif
+
+/// Font data, same as GFXfont except for the bitmap format
+typedef struct {
+  const uint8_t  *bitmap; ///< Glyph alphas, 4 bits per pixel, high nibble
+                          ///< first, each glyph starting on a byte
+  const GFXglyph *glyph;  ///< Glyph array, as in GFXfont
+  uint8_t first;          ///< ASCII extents (first char)
+  uint8_t last;           ///< ASCII extents (last char)
+  uint8_t yAdvance;       ///< Newline distance (y axis)
+} GFXalphaFont;
+
+/*!
+  @brief  Prints a GFXalphaFont on any Adafruit_GFX display or canvas.
+
+          Each glyph's bounding box is blended between the text color and
+          a background color, so the text must go on a background of that
+          color (clear that area first), and glyphs that overlap each other
+          overwrite rather than blend. In return a glyph is one address
+          window of pixels on displays that support writeWindow(), instead
+          of a rectangle per run of pixels.
+
+          Like GFXfont text the cursor is the left end of the baseline.
+*/
+class GFXalphaText : public Print {
+ public:
+  GFXalphaText(Adafruit_GFX &gfx, const GFXalphaFont *font);
+  void      setTextColor(uint16_t color, uint16_t bg);
+  void      drawChar(int16_t x, int16_t y, unsigned char c);
+  int16_t   textWidth(const char *str);
+  void      getTextBounds(const char *str, int16_t x, int16_t y,
+              int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h);
+#if ARDUINO >= 100
+  size_t    write(uint8_t c);
+#else
+  void      write(uint8_t c);
+#endif
+  /**********************************************************************/
+  /*!
+    @brief  Set the font for text printed from now on
+    @param  f  The font
+  */
+  /**********************************************************************/
+  void      setFont(const GFXalphaFont *f) { font = f; }
+  /**********************************************************************/
+  /*!
+    @brief  Set the text cursor, the left end of the baseline
+    @param  x  X coordinate in pixels
+    @param  y  Y coordinate in pixels
+  */
+  /**********************************************************************/
+  void      setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+  /**********************************************************************/
+  /*!
+    @brief  Set whether text that runs off the right edge continues on
+            the next line
+    @param  w  true to wrap (the default)
+  */
+  /**********************************************************************/
+  void      setTextWrap(bool w) { wrap = w; }
+  /**********************************************************************/
+  /*!
+    @brief    Get text cursor X location
+    @returns  X coordinate in pixels
+  */
+  /**********************************************************************/
+  int16_t   getCursorX(void) const { return cursor_x; }
+  /**********************************************************************/
+  /*!
+    @brief    Get text cursor Y location
+    @returns  Y coordinate in pixels
+  */
+  /**********************************************************************/
+  int16_t   getCursorY(void) const { return cursor_y; }
+
+ private:
+  Adafruit_GFX       &gfx;
+  const GFXalphaFont *font;
+  uint16_t  blend[16];          ///< Color for each alpha, see setTextColor()
+  int16_t   cursor_x, cursor_y;
+  bool      wrap;
+};
+
+#endif // _ADAFRUIT_ALPHAFONT_H_
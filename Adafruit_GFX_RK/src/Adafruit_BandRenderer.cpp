@@ -0,0 +1,710 @@
+/*!
+ * @file Adafruit_BandRenderer.cpp
+ *
+ * Part of Adafruit's GFX graphics library. See Adafruit_BandRenderer.h.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_BandRenderer.h"
+
+#ifndef min
+#define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef max
+#define max(a,b) (((a) > (b)) ? (a) : (b))
+#endif
+
+// Display list commands. Each one is a header word (command in the low
+// byte, number of argument words in the high byte), the first and last
+// display row it can touch, then its arguments. Colors are stored as is,
+// pointers take PTR_WORDS words.
+#define BAND_PIXEL         1 ///< x, y, color
+#define BAND_HLINE         2 ///< x, y, w, color
+#define BAND_VLINE         3 ///< x, y, h, color
+#define BAND_FILLRECT      4 ///< x, y, w, h, color
+#define BAND_LINE          5 ///< x0, y0, x1, y1, color
+#define BAND_RECT          6 ///< x, y, w, h, color
+#define BAND_CIRCLE        7 ///< x0, y0, r, color
+#define BAND_FILLCIRCLE    8 ///< x0, y0, r, color
+#define BAND_TRIANGLE      9 ///< x0, y0, x1, y1, x2, y2, color
+#define BAND_FILLTRIANGLE 10 ///< x0, y0, x1, y1, x2, y2, color
+#define BAND_ROUNDRECT    11 ///< x, y, w, h, r, color
+#define BAND_FILLROUNDRECT 12 ///< x, y, w, h, r, color
+#define BAND_BITMAP       13 ///< x, y, w, h, color, bitmap
+#define BAND_BITMAPBG     14 ///< x, y, w, h, color, bg, bitmap
+#define BAND_RGBBITMAP    15 ///< x, y, w, h, bitmap
+#define BAND_TEXT         16 ///< See TEXT_* below
+
+// A BAND_TEXT command is a run of print()ed characters, two per word
+// after these arguments
+#define TEXT_X      0 ///< Cursor before the first character
+#define TEXT_Y      1
+#define TEXT_COLOR  2
+#define TEXT_BG     3
+#define TEXT_SIZE   4 ///< textsize_x | textsize_y << 8
+#define TEXT_FLAGS  5 ///< TEXT_WRAP | TEXT_CP437
+#define TEXT_LEN    6 ///< Number of characters
+#define TEXT_FONT   7 ///< gfxFont, PTR_WORDS words
+#define TEXT_CHARS  (TEXT_FONT + PTR_WORDS)
+
+#define TEXT_WRAP   0x01
+#define TEXT_CP437  0x02
+
+#define PTR_WORDS   ((sizeof(void *) + 1) / 2) ///< Words per stored pointer
+#define NO_TEXT     0xFFFF ///< lastText when there's no run to extend
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate a band renderer. Nothing is drawn until render().
+    @param   w          Frame width, in pixels
+    @param   h          Frame height, in pixels
+    @param   rows       Height of each strip, in pixels
+    @param   listBytes  Size of the display list, in bytes
+*/
+/**************************************************************************/
+GFXbandRenderer::GFXbandRenderer(uint16_t w, uint16_t h, uint16_t rows,
+  uint16_t listBytes) : Adafruit_GFX(w, h), band(w, min(rows, h)) {
+    listSize = listBytes / 2;
+    list     = (uint16_t *)malloc(listSize * 2);
+    muted    = false;
+    clear();
+}
+
+/**************************************************************************/
+/*!
+   @brief    Delete the renderer, free memory
+*/
+/**************************************************************************/
+GFXbandRenderer::~GFXbandRenderer(void) {
+    if(list) free(list);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Start a new frame of a single color, forgetting everything
+             recorded so far
+    @param   color 16-bit 5-6-5 Color of the empty frame
+*/
+/**************************************************************************/
+void GFXbandRenderer::clear(uint16_t color) {
+    listLen    = 0;
+    lastText   = NO_TEXT;
+    background = color;
+    overflow   = false;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Add a command to the display list
+    @param   op      BAND_* command
+    @param   top     First display row the command can draw on
+    @param   bottom  Last display row the command can draw on
+    @param   n       Number of argument words
+    @returns Where to store the arguments, NULL if the command is entirely
+             off screen or doesn't fit
+*/
+/**************************************************************************/
+uint16_t *GFXbandRenderer::put(uint8_t op, int16_t top, int16_t bottom,
+  uint8_t n) {
+    if(muted) return NULL;
+    lastText = NO_TEXT;
+    if((bottom < 0) || (top >= _height)) return NULL;
+    if(!list || (listLen + 3 + n > listSize)) {
+        overflow = true;
+        return NULL;
+    }
+
+    uint16_t *p = &list[listLen];
+    p[0] = op | ((uint16_t)n << 8);
+    p[1] = top;
+    p[2] = bottom;
+    listLen += 3 + n;
+    return &p[3];
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a pixel
+    @param   x   x coordinate
+    @param   y   y coordinate
+    @param   color 16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void GFXbandRenderer::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if((x < 0) || (x >= _width)) return;
+    uint16_t *a = put(BAND_PIXEL, y, y, 3);
+    if(a) {
+        a[0] = x; a[1] = y; a[2] = color;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a perfectly vertical line
+    @param   x   Top-most x coordinate
+    @param   y   Top-most y coordinate
+    @param   h   Height in pixels
+    @param   color 16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void GFXbandRenderer::drawFastVLine(int16_t x, int16_t y, int16_t h,
+  uint16_t color) {
+    uint16_t *a = put(BAND_VLINE, min(y, y + h - 1), max(y, y + h - 1), 4);
+    if(a) {
+        a[0] = x; a[1] = y; a[2] = h; a[3] = color;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a perfectly horizontal line
+    @param   x   Left-most x coordinate
+    @param   y   Left-most y coordinate
+    @param   w   Width in pixels
+    @param   color 16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void GFXbandRenderer::drawFastHLine(int16_t x, int16_t y, int16_t w,
+  uint16_t color) {
+    uint16_t *a = put(BAND_HLINE, y, y, 4);
+    if(a) {
+        a[0] = x; a[1] = y; a[2] = w; a[3] = color;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Fill a rectangle completely with one color
+    @param   x   Top left corner x coordinate
+    @param   y   Top left corner y coordinate
+    @param   w   Width in pixels
+    @param   h   Height in pixels
+    @param   color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXbandRenderer::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+  uint16_t color) {
+    uint16_t *a = put(BAND_FILLRECT, min(y, y + h - 1), max(y, y + h - 1), 5);
+    if(a) {
+        a[0] = x; a[1] = y; a[2] = w; a[3] = h; a[4] = color;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Fill the whole frame with one color. Nothing drawn before this
+             can show, so it empties the display list rather than adding
+             to it.
+    @param   color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXbandRenderer::fillScreen(uint16_t color) {
+    if(!muted) clear(color);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a line
+    @param   x0  Start point x coordinate
+    @param   y0  Start point y coordinate
+    @param   x1  End point x coordinate
+    @param   y1  End point y coordinate
+    @param   color 16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void GFXbandRenderer::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+  uint16_t color) {
+    uint16_t *a = put(BAND_LINE, min(y0, y1), max(y0, y1), 5);
+    if(a) {
+        a[0] = x0; a[1] = y0; a[2] = x1; a[3] = y1; a[4] = color;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a line, same as drawLine() here
+    @param   x0  Start point x coordinate
+    @param   y0  Start point y coordinate
+    @param   x1  End point x coordinate
+    @param   y1  End point y coordinate
+    @param   color 16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void GFXbandRenderer::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+  uint16_t color) {
+    drawLine(x0, y0, x1, y1, color);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a rectangle with no fill color
+    @param   x   Top left corner x coordinate
+    @param   y   Top left corner y coordinate
+    @param   w   Width in pixels
+    @param   h   Height in pixels
+    @param   color 16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void GFXbandRenderer::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+  uint16_t color) {
+    uint16_t *a = put(BAND_RECT, min(y, y + h - 1), max(y, y + h - 1), 5);
+    if(a) {
+        a[0] = x; a[1] = y; a[2] = w; a[3] = h; a[4] = color;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a circle outline
+    @param   x0   Center-point x coordinate
+    @param   y0   Center-point y coordinate
+    @param   r    Radius of circle
+    @param   color 16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void GFXbandRenderer::drawCircle(int16_t x0, int16_t y0, int16_t r,
+  uint16_t color) {
+    uint16_t *a = put(BAND_CIRCLE, y0 - r, y0 + r, 4);
+    if(a) {
+        a[0] = x0; a[1] = y0; a[2] = r; a[3] = color;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a circle with filled color
+    @param   x0   Center-point x coordinate
+    @param   y0   Center-point y coordinate
+    @param   r    Radius of circle
+    @param   color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXbandRenderer::fillCircle(int16_t x0, int16_t y0, int16_t r,
+  uint16_t color) {
+    uint16_t *a = put(BAND_FILLCIRCLE, y0 - r, y0 + r, 4);
+    if(a) {
+        a[0] = x0; a[1] = y0; a[2] = r; a[3] = color;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a triangle with no fill color
+    @param   x0  Vertex #0 x coordinate
+    @param   y0  Vertex #0 y coordinate
+    @param   x1  Vertex #1 x coordinate
+    @param   y1  Vertex #1 y coordinate
+    @param   x2  Vertex #2 x coordinate
+    @param   y2  Vertex #2 y coordinate
+    @param   color 16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void GFXbandRenderer::drawTriangle(int16_t x0, int16_t y0,
+  int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    uint16_t *a = put(BAND_TRIANGLE, min(y0, min(y1, y2)),
+      max(y0, max(y1, y2)), 7);
+    if(a) {
+        a[0] = x0; a[1] = y0; a[2] = x1; a[3] = y1;
+        a[4] = x2; a[5] = y2; a[6] = color;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a triangle with color-fill
+    @param   x0  Vertex #0 x coordinate
+    @param   y0  Vertex #0 y coordinate
+    @param   x1  Vertex #1 x coordinate
+    @param   y1  Vertex #1 y coordinate
+    @param   x2  Vertex #2 x coordinate
+    @param   y2  Vertex #2 y coordinate
+    @param   color 16-bit 5-6-5 Color to fill/draw with
+*/
+/**************************************************************************/
+void GFXbandRenderer::fillTriangle(int16_t x0, int16_t y0,
+  int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    uint16_t *a = put(BAND_FILLTRIANGLE, min(y0, min(y1, y2)),
+      max(y0, max(y1, y2)), 7);
+    if(a) {
+        a[0] = x0; a[1] = y0; a[2] = x1; a[3] = y1;
+        a[4] = x2; a[5] = y2; a[6] = color;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a rounded rectangle with no fill color
+    @param   x   Top left corner x coordinate
+    @param   y   Top left corner y coordinate
+    @param   w   Width in pixels
+    @param   h   Height in pixels
+    @param   r   Radius of corner rounding
+    @param   color 16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void GFXbandRenderer::drawRoundRect(int16_t x, int16_t y, int16_t w,
+  int16_t h, int16_t r, uint16_t color) {
+    uint16_t *a = put(BAND_ROUNDRECT, y, y + h - 1, 6);
+    if(a) {
+        a[0] = x; a[1] = y; a[2] = w; a[3] = h; a[4] = r; a[5] = color;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a rounded rectangle with fill color
+    @param   x   Top left corner x coordinate
+    @param   y   Top left corner y coordinate
+    @param   w   Width in pixels
+    @param   h   Height in pixels
+    @param   r   Radius of corner rounding
+    @param   color 16-bit 5-6-5 Color to draw/fill with
+*/
+/**************************************************************************/
+void GFXbandRenderer::fillRoundRect(int16_t x, int16_t y, int16_t w,
+  int16_t h, int16_t r, uint16_t color) {
+    uint16_t *a = put(BAND_FILLROUNDRECT, y, y + h - 1, 6);
+    if(a) {
+        a[0] = x; a[1] = y; a[2] = w; a[3] = h; a[4] = r; a[5] = color;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Record any of the bitmap commands
+    @param   op      BAND_BITMAP, BAND_BITMAPBG or BAND_RGBBITMAP
+    @param   x       Top left corner x coordinate
+    @param   y       Top left corner y coordinate
+    @param   bitmap  Bitmap address, must stay valid until render()
+    @param   w       Width of bitmap in pixels
+    @param   h       Height of bitmap in pixels
+    @param   color   16-bit 5-6-5 Color to draw set pixels with
+    @param   bg      16-bit 5-6-5 Color to draw background with
+*/
+/**************************************************************************/
+void GFXbandRenderer::putBitmap(uint8_t op, int16_t x, int16_t y,
+  const void *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+    uint8_t   n = (op == BAND_RGBBITMAP) ? 4 : (op == BAND_BITMAP) ? 5 : 6;
+    uint16_t *a = put(op, y, y + h - 1, n + PTR_WORDS);
+    if(a) {
+        a[0] = x; a[1] = y; a[2] = w; a[3] = h; a[4] = color; a[5] = bg;
+        memcpy(&a[n], &bitmap, sizeof(bitmap));
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a PROGMEM-resident 1-bit image, only the set pixels
+    @param   x   Top left corner x coordinate
+    @param   y   Top left corner y coordinate
+    @param   bitmap  byte array with monochrome bitmap
+    @param   w   Width of bitmap in pixels
+    @param   h   Height of bitmap in pixels
+    @param   color 16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void GFXbandRenderer::drawBitmap(int16_t x, int16_t y,
+  const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) {
+    putBitmap(BAND_BITMAP, x, y, bitmap, w, h, color, 0);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a PROGMEM-resident 1-bit image, set and unset pixels
+    @param   x   Top left corner x coordinate
+    @param   y   Top left corner y coordinate
+    @param   bitmap  byte array with monochrome bitmap
+    @param   w   Width of bitmap in pixels
+    @param   h   Height of bitmap in pixels
+    @param   color 16-bit 5-6-5 Color to draw pixels with
+    @param   bg 16-bit 5-6-5 Color to draw background with
+*/
+/**************************************************************************/
+void GFXbandRenderer::drawBitmap(int16_t x, int16_t y,
+  const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+    putBitmap(BAND_BITMAPBG, x, y, bitmap, w, h, color, bg);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a RAM-resident 1-bit image, only the set pixels
+    @param   x   Top left corner x coordinate
+    @param   y   Top left corner y coordinate
+    @param   bitmap  byte array with monochrome bitmap
+    @param   w   Width of bitmap in pixels
+    @param   h   Height of bitmap in pixels
+    @param   color 16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void GFXbandRenderer::drawBitmap(int16_t x, int16_t y,
+  uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) {
+    putBitmap(BAND_BITMAP, x, y, bitmap, w, h, color, 0);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a RAM-resident 1-bit image, set and unset pixels
+    @param   x   Top left corner x coordinate
+    @param   y   Top left corner y coordinate
+    @param   bitmap  byte array with monochrome bitmap
+    @param   w   Width of bitmap in pixels
+    @param   h   Height of bitmap in pixels
+    @param   color 16-bit 5-6-5 Color to draw pixels with
+    @param   bg 16-bit 5-6-5 Color to draw background with
+*/
+/**************************************************************************/
+void GFXbandRenderer::drawBitmap(int16_t x, int16_t y,
+  uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+    putBitmap(BAND_BITMAPBG, x, y, bitmap, w, h, color, bg);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a PROGMEM-resident 16-bit image (RGB 5/6/5)
+    @param   x   Top left corner x coordinate
+    @param   y   Top left corner y coordinate
+    @param   bitmap  byte array with 16-bit color bitmap
+    @param   w   Width of bitmap in pixels
+    @param   h   Height of bitmap in pixels
+*/
+/**************************************************************************/
+void GFXbandRenderer::drawRGBBitmap(int16_t x, int16_t y,
+  const uint16_t bitmap[], int16_t w, int16_t h) {
+    putBitmap(BAND_RGBBITMAP, x, y, bitmap, w, h, 0, 0);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a RAM-resident 16-bit image (RGB 5/6/5)
+    @param   x   Top left corner x coordinate
+    @param   y   Top left corner y coordinate
+    @param   bitmap  byte array with 16-bit color bitmap
+    @param   w   Width of bitmap in pixels
+    @param   h   Height of bitmap in pixels
+*/
+/**************************************************************************/
+void GFXbandRenderer::drawRGBBitmap(int16_t x, int16_t y,
+  uint16_t *bitmap, int16_t w, int16_t h) {
+    putBitmap(BAND_RGBBITMAP, x, y, bitmap, w, h, 0, 0);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Find the text run the next character can be added to
+    @param   x   Cursor x before the character
+    @param   y   Cursor y before the character
+    @returns Arguments of the last command if it's a run that ends at
+             (x, y) with the current text settings, otherwise NULL
+*/
+/**************************************************************************/
+uint16_t *GFXbandRenderer::textRun(int16_t x, int16_t y) {
+    if((lastText == NO_TEXT) || (x != textX) || (y != textY)) return NULL;
+
+    uint16_t *a = &list[lastText + 3];
+    const GFXfont *font;
+    memcpy(&font, &a[TEXT_FONT], sizeof(font));
+    uint8_t flags = (wrap ? TEXT_WRAP : 0) | (_cp437 ? TEXT_CP437 : 0);
+    if((a[TEXT_COLOR] != textcolor) || (a[TEXT_BG] != textbgcolor) ||
+       (a[TEXT_SIZE] != (textsize_x | ((uint16_t)textsize_y << 8))) ||
+       (a[TEXT_FLAGS] != flags) || (font != gfxFont)) return NULL;
+    return a;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Print one byte/character of data, used to support print().
+            Consecutive characters with the same settings are kept as one
+            display list command.
+    @param  c  The 8-bit ascii character to write
+*/
+/**************************************************************************/
+#if ARDUINO >= 100
+size_t GFXbandRenderer::write(uint8_t c) {
+#else
+void GFXbandRenderer::write(uint8_t c) {
+#endif
+    int16_t x = cursor_x, y = cursor_y;
+
+    // Let Adafruit_GFX move the cursor, without recording what it draws
+    muted = true;
+    Adafruit_GFX::write(c);
+    muted = false;
+
+    // Rows this character can cover, from where it was drawn after any wrap
+    bool    drawn = (c != '\n') && (c != '\r');
+    int16_t top, bottom;
+    if(!gfxFont) {
+        top    = cursor_y;
+        bottom = cursor_y + textsize_y * 8 - 1;
+    } else {
+        int16_t ya = (int16_t)textsize_y *
+                     (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+        top    = cursor_y - ya;
+        bottom = cursor_y + ya;
+    }
+
+    uint16_t *a = textRun(x, y);
+    if(a) {
+        uint16_t *hdr = &list[lastText];
+        uint16_t  len = a[TEXT_LEN];
+        if(!(len & 1)) { // Needs another word
+            if(((hdr[0] >> 8) == 255) || (listLen >= listSize)) {
+                a = NULL; // Run is full, start another
+            } else {
+                hdr[0] += 1 << 8;
+                list[listLen++] = 0;
+            }
+        }
+        if(a) {
+            a[TEXT_CHARS + len / 2] |= (len & 1) ? ((uint16_t)c << 8) : c;
+            a[TEXT_LEN] = len + 1;
+            if(drawn) {
+                hdr[1] = min((int16_t)hdr[1], top);
+                hdr[2] = max((int16_t)hdr[2], bottom);
+            }
+        }
+    }
+
+    if(!a && drawn) {
+        a = put(BAND_TEXT, top, bottom, TEXT_CHARS + 1);
+        if(a) {
+            lastText         = (a - 3) - list;
+            a[TEXT_X]        = x;
+            a[TEXT_Y]        = y;
+            a[TEXT_COLOR]    = textcolor;
+            a[TEXT_BG]       = textbgcolor;
+            a[TEXT_SIZE]     = textsize_x | ((uint16_t)textsize_y << 8);
+            a[TEXT_FLAGS]    = (wrap ? TEXT_WRAP : 0) | (_cp437 ? TEXT_CP437 : 0);
+            a[TEXT_LEN]      = 1;
+            memcpy(&a[TEXT_FONT], &gfxFont, sizeof(gfxFont));
+            a[TEXT_CHARS]    = c;
+        }
+    }
+    textX = cursor_x;
+    textY = cursor_y;
+#if ARDUINO >= 100
+    return 1;
+#endif
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw one display list command into the strip
+    @param   p   Command header
+    @param   y0  Display row of the top of the strip
+*/
+/**************************************************************************/
+void GFXbandRenderer::replay(const uint16_t *p, int16_t y0) {
+    const int16_t *a = (const int16_t *)&p[3];
+    const void    *ptr;
+
+    switch(p[0] & 0xFF) {
+        case BAND_PIXEL:
+            band.drawPixel(a[0], a[1] - y0, a[2]);
+            break;
+        case BAND_HLINE:
+            band.drawFastHLine(a[0], a[1] - y0, a[2], a[3]);
+            break;
+        case BAND_VLINE:
+            band.drawFastVLine(a[0], a[1] - y0, a[2], a[3]);
+            break;
+        case BAND_FILLRECT:
+            band.fillRect(a[0], a[1] - y0, a[2], a[3], a[4]);
+            break;
+        case BAND_LINE:
+            band.drawLine(a[0], a[1] - y0, a[2], a[3] - y0, a[4]);
+            break;
+        case BAND_RECT:
+            band.drawRect(a[0], a[1] - y0, a[2], a[3], a[4]);
+            break;
+        case BAND_CIRCLE:
+            band.drawCircle(a[0], a[1] - y0, a[2], a[3]);
+            break;
+        case BAND_FILLCIRCLE:
+            band.fillCircle(a[0], a[1] - y0, a[2], a[3]);
+            break;
+        case BAND_TRIANGLE:
+            band.drawTriangle(a[0], a[1] - y0, a[2], a[3] - y0,
+              a[4], a[5] - y0, a[6]);
+            break;
+        case BAND_FILLTRIANGLE:
+            band.fillTriangle(a[0], a[1] - y0, a[2], a[3] - y0,
+              a[4], a[5] - y0, a[6]);
+            break;
+        case BAND_ROUNDRECT:
+            band.drawRoundRect(a[0], a[1] - y0, a[2], a[3], a[4], a[5]);
+            break;
+        case BAND_FILLROUNDRECT:
+            band.fillRoundRect(a[0], a[1] - y0, a[2], a[3], a[4], a[5]);
+            break;
+        case BAND_BITMAP:
+            memcpy(&ptr, &a[5], sizeof(ptr));
+            band.drawBitmap(a[0], a[1] - y0, (const uint8_t *)ptr,
+              a[2], a[3], a[4]);
+            break;
+        case BAND_BITMAPBG:
+            memcpy(&ptr, &a[6], sizeof(ptr));
+            band.drawBitmap(a[0], a[1] - y0, (const uint8_t *)ptr,
+              a[2], a[3], a[4], a[5]);
+            break;
+        case BAND_RGBBITMAP:
+            memcpy(&ptr, &a[4], sizeof(ptr));
+            band.drawRGBBitmap(a[0], a[1] - y0, (const uint16_t *)ptr,
+              a[2], a[3]);
+            break;
+        case BAND_TEXT: {
+            const uint16_t *t = &p[3];
+            memcpy(&ptr, &t[TEXT_FONT], sizeof(ptr));
+            band.setFont((const GFXfont *)ptr);
+            band.setGlyphCache(glyphCache);
+            band.setTextSize(t[TEXT_SIZE] & 0xFF, t[TEXT_SIZE] >> 8);
+            band.setTextColor(t[TEXT_COLOR], t[TEXT_BG]);
+            band.setTextWrap(t[TEXT_FLAGS] & TEXT_WRAP);
+            band.cp437(t[TEXT_FLAGS] & TEXT_CP437);
+            band.setCursor(a[TEXT_X], a[TEXT_Y] - y0);
+            for(uint16_t i=0; i<t[TEXT_LEN]; i++) {
+                band.write((t[TEXT_CHARS + i / 2] >> ((i & 1) * 8)) & 0xFF);
+            }
+            break;
+        }
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw the recorded frame on a display, one strip at a time.
+             Each strip only replays the commands that can reach it, and
+             is sent as its own transaction so other devices on the SPI
+             bus aren't locked out while the next one is drawn. The
+             display list is kept, so the same frame can be rendered again.
+    @param   tft  Display to draw on
+    @param   x    Display column of the frame's left edge
+    @param   y    Display row of the frame's top edge
+    @returns Number of pixels sent
+*/
+/**************************************************************************/
+uint32_t GFXbandRenderer::render(Adafruit_SPITFT &tft, int16_t x, int16_t y) {
+    uint16_t *buffer = band.getBuffer();
+    if(!buffer) return 0;
+
+    uint32_t pixels = 0;
+    for(int16_t y0=0; y0<_height; y0+=band.height()) {
+        int16_t rows = min(band.height(), _height - y0);
+
+        band.fillScreen(background);
+        for(uint16_t i=0; i<listLen; i+=3+(list[i] >> 8)) {
+            if(((int16_t)list[i + 1] < y0 + rows) &&
+               ((int16_t)list[i + 2] >= y0)) {
+                replay(&list[i], y0);
+            }
+        }
+
+        tft.startWrite();
+        tft.setAddrWindow(x, y + y0, _width, rows);
+        tft.writePixels(buffer, (uint32_t)_width * rows);
+        tft.endWrite();
+        pixels += (uint32_t)_width * rows;
+    }
+    return pixels;
+}
@@ -0,0 +1,135 @@
+/*!
+ * @file Adafruit_BandRenderer.h
+ *
+ * Part of Adafruit's GFX graphics library. Full-screen off-screen drawing
+ * without a full-screen framebuffer: drawing calls are recorded in a
+ * display list, then played back a few rows at a time into a small
+ * GFXcanvas16 strip that is sent to an Adafruit_SPITFT display before the
+ * next strip is drawn.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _ADAFRUIT_BANDRENDERER_H_
+#define _ADAFRUIT_BANDRENDERER_H_
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_SPITFT.h"
+
+#if !defined(GFX_BAND_ROWS)
+ #define GFX_BAND_ROWS 24   ///< Default strip height, 15K of RAM at 320 wide
+#endif
+#if !defined(GFX_BAND_LIST)
+ #define GFX_BAND_LIST 2048 ///< Default display list size in bytes
+#endif
+
+/*!
+  @brief  Records drawing calls for a whole frame, then renders it in
+          horizontal strips. A 320x240 GFXcanvas16 needs 150K; this needs
+          one strip (width x GFX_BAND_ROWS x 2 bytes) plus the display list,
+          and the display only ever receives finished rows, so there's no
+          visible clear-then-draw flicker.
+
+          fillScreen() empties the display list, since it covers everything
+          drawn before it, so the usual "fillScreen(), draw, render()"
+          frame doesn't need clear(). Runs of print()ed text with the same
+          settings are kept as one command of about a byte per character,
+          drawn with the renderer's setGlyphCache() cache if it has one.
+
+          drawCircle(), fillTriangle(), bitmaps and the other primitives
+          that Adafruit_GFX doesn't make virtual are recorded as single
+          commands when called on a GFXbandRenderer. Called through an
+          Adafruit_GFX reference they still work, but are recorded as the
+          lines and pixels they draw. Bitmaps are recorded by address and
+          must still be there when render() is called.
+
+          The renderer doesn't rotate; make it the size of the display at
+          its current rotation.
+*/
+class GFXbandRenderer : public Adafruit_GFX {
+ public:
+  GFXbandRenderer(uint16_t w, uint16_t h, uint16_t rows = GFX_BAND_ROWS,
+    uint16_t listBytes = GFX_BAND_LIST);
+  ~GFXbandRenderer(void);
+
+  void      drawPixel(int16_t x, int16_t y, uint16_t color),
+            drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
+            drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+            fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+              uint16_t color),
+            fillScreen(uint16_t color),
+            drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+              uint16_t color),
+            writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+              uint16_t color),
+            drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+              uint16_t color);
+#if ARDUINO >= 100
+  size_t    write(uint8_t c);
+#else
+  void      write(uint8_t c);
+#endif
+
+  // Hide the non-virtual Adafruit_GFX versions so each is one command
+  using Adafruit_GFX::drawBitmap;
+  using Adafruit_GFX::drawRGBBitmap;
+  void      drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color),
+            fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color),
+            drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+              int16_t x2, int16_t y2, uint16_t color),
+            fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+              int16_t x2, int16_t y2, uint16_t color),
+            drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
+              int16_t r, uint16_t color),
+            fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
+              int16_t r, uint16_t color),
+            drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+              int16_t w, int16_t h, uint16_t color),
+            drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+              int16_t w, int16_t h, uint16_t color, uint16_t bg),
+            drawBitmap(int16_t x, int16_t y, uint8_t *bitmap,
+              int16_t w, int16_t h, uint16_t color),
+            drawBitmap(int16_t x, int16_t y, uint8_t *bitmap,
+              int16_t w, int16_t h, uint16_t color, uint16_t bg),
+            drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[],
+              int16_t w, int16_t h),
+            drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap,
+              int16_t w, int16_t h);
+
+  void      clear(uint16_t color = 0);
+  uint32_t  render(Adafruit_SPITFT &tft, int16_t x = 0, int16_t y = 0);
+  /**********************************************************************/
+  /*!
+    @brief    Check whether anything was dropped because the display list
+              was full
+    @returns  true if render() will be missing some drawing
+  */
+  /**********************************************************************/
+  bool      overflowed(void) const { return overflow; }
+  /**********************************************************************/
+  /*!
+    @brief    Get how much of the display list the frame uses so far
+    @returns  Bytes used
+  */
+  /**********************************************************************/
+  uint16_t  listUsed(void) const { return listLen * 2; }
+
+ private:
+  uint16_t *put(uint8_t op, int16_t top, int16_t bottom, uint8_t n),
+           *textRun(int16_t x, int16_t y);
+  void      putBitmap(uint8_t op, int16_t x, int16_t y, const void *bitmap,
+              int16_t w, int16_t h, uint16_t color, uint16_t bg),
+            replay(const uint16_t *p, int16_t y0);
+
+  GFXcanvas16 band;          ///< One strip of the frame
+  uint16_t *list;            ///< Display list, see put()
+  uint16_t  listSize,        ///< Display list capacity in 16-bit words
+            listLen,         ///< Words used
+            lastText;        ///< Offset of the text run print() may extend
+  int16_t   textX, textY;    ///< Cursor position at the end of that run
+  uint16_t  background;      ///< Color of everything not drawn on
+  bool      overflow,        ///< Something didn't fit in the list
+            muted;           ///< Inside Adafruit_GFX::write(), don't record
+};
+
+#endif // _ADAFRUIT_BANDRENDERER_H_
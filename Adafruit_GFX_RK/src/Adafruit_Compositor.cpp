@@ -0,0 +1,367 @@
+/*!
+ * @file Adafruit_Compositor.cpp
+ *
+ * Part of Adafruit's GFX graphics library. See Adafruit_Compositor.h.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_Compositor.h"
+#include "Adafruit_Pixel565.h"
+#ifdef __AVR__
+  #include <avr/pgmspace.h>
+#elif defined(ESP8266) || defined(ESP32)
+  #include <pgmspace.h>
+#endif
+
+#ifndef pgm_read_byte
+ #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#endif
+#ifndef pgm_read_word
+ #define pgm_read_word(addr) (*(const unsigned short *)(addr))
+#endif
+
+#ifndef min
+ #define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef max
+ #define max(a,b) (((a) > (b)) ? (a) : (b))
+#endif
+
+#if defined(USE_SPI_ASYNC)
+ // Particle swaps each span into the other of two buffers before sending
+ // it, so spans needn't wait for the one before
+ #define COMPOSITOR_BLOCK false
+#else
+ // SAMD DMA starts again at its first buffer on every writePixels(), which
+ // may still be going out, so each span is sent before the next
+ #define COMPOSITOR_BLOCK true
+#endif
+
+/// Pixels in a rectangle with inclusive corners
+static int32_t area(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    return (int32_t)(x2 - x1 + 1) * (y2 - y1 + 1);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate a compositor with no sprites on a black background
+    @param   tft       The display
+    @param   scratchW  Width of the canvas areas are put together in
+    @param   scratchH  Height of that canvas; it takes scratchW x scratchH
+                       x 2 bytes, 8K by default
+*/
+/**************************************************************************/
+GFXcompositor::GFXcompositor(Adafruit_SPITFT &tft, uint16_t scratchW,
+  uint16_t scratchH) : tft(tft), scratch(scratchW, scratchH) {
+    backCanvas = NULL;
+    backColor  = 0x0000;
+    numSprites = numDirty = 0;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Add a sprite with a transparent color. It starts shown at the
+             top left corner.
+    @param   bitmap  16-bit 5-6-5 pixels, w x h
+    @param   w       Width in pixels
+    @param   h       Height in pixels
+    @param   key     Color in bitmap that shows what's behind
+    @returns Sprite number, or -1 if there are already GFX_SPRITES
+*/
+/**************************************************************************/
+int8_t GFXcompositor::addSprite(const uint16_t *bitmap, int16_t w, int16_t h,
+  uint16_t key) {
+    if((numSprites >= GFX_SPRITES) || (w <= 0) || (h <= 0)) return -1;
+    Sprite &s = sprites[numSprites];
+    s.bitmap  = bitmap;
+    s.mask    = NULL;
+    s.key     = key;
+    s.x       = s.y = 0;
+    s.w       = w;
+    s.h       = h;
+    s.shown   = s.changed = true;
+    s.drawn   = false;
+    return numSprites++;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Add a sprite with a 1-bit mask. It starts shown at the top
+             left corner.
+    @param   bitmap  16-bit 5-6-5 pixels, w x h
+    @param   mask    1 bit per pixel, rows padded to whole bytes, most
+                     significant bit first; 1 for drawn, 0 for what's behind
+    @param   w       Width in pixels
+    @param   h       Height in pixels
+    @returns Sprite number, or -1 if there are already GFX_SPRITES
+*/
+/**************************************************************************/
+int8_t GFXcompositor::addSprite(const uint16_t *bitmap, const uint8_t *mask,
+  int16_t w, int16_t h) {
+    int8_t id = addSprite(bitmap, w, h, 0);
+    if(id >= 0) sprites[id].mask = mask;
+    return id;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Make the background one color. Everything is redrawn at the
+             next update().
+    @param   color  16-bit 5-6-5 color
+*/
+/**************************************************************************/
+void GFXcompositor::setBackground(uint16_t color) {
+    backCanvas = NULL;
+    backColor  = color;
+    markAll();
+}
+
+/**************************************************************************/
+/*!
+   @brief    Show a canvas behind the sprites. Everything is redrawn at the
+             next update(); after drawing on the canvas, call redraw().
+    @param   canvas  Canvas the size of the display at its rotation, at
+                     rotation 0 itself. Parts of the display it doesn't
+                     cover are the last background color.
+*/
+/**************************************************************************/
+void GFXcompositor::setBackground(const GFXcanvas16 *canvas) {
+    backCanvas = canvas;
+    markAll();
+}
+
+/**************************************************************************/
+/*!
+   @brief    Give a sprite another bitmap of the same size, such as the
+             next frame of an animation
+    @param   id      Sprite number from addSprite()
+    @param   bitmap  16-bit 5-6-5 pixels
+    @param   mask    New mask for a sprite added with one, else ignored
+*/
+/**************************************************************************/
+void GFXcompositor::setBitmap(int8_t id, const uint16_t *bitmap,
+  const uint8_t *mask) {
+    if((id < 0) || (id >= numSprites)) return;
+    Sprite &s = sprites[id];
+    s.bitmap  = bitmap;
+    if(s.mask && mask) s.mask = mask;
+    s.changed = true;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Move a sprite
+    @param   id  Sprite number from addSprite()
+    @param   x   New left edge, may be off the display
+    @param   y   New top edge, may be off the display
+*/
+/**************************************************************************/
+void GFXcompositor::moveSprite(int8_t id, int16_t x, int16_t y) {
+    if((id < 0) || (id >= numSprites)) return;
+    Sprite &s = sprites[id];
+    if((s.x != x) || (s.y != y)) {
+        s.x       = x;
+        s.y       = y;
+        s.changed = true;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Show or hide a sprite
+    @param   id    Sprite number from addSprite()
+    @param   show  True to show it
+*/
+/**************************************************************************/
+void GFXcompositor::showSprite(int8_t id, bool show) {
+    if((id < 0) || (id >= numSprites)) return;
+    Sprite &s = sprites[id];
+    if(s.shown != show) {
+        s.shown   = show;
+        s.changed = true;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Send the whole display, e.g. at the start or after drawing on
+             the background canvas
+*/
+/**************************************************************************/
+void GFXcompositor::redraw(void) {
+    markAll();
+    update();
+}
+
+/**************************************************************************/
+/*!
+   @brief    Send the parts of the display changed by sprites moving,
+             changing or being shown or hidden since the last update()
+    @returns Number of separate rectangles sent
+*/
+/**************************************************************************/
+uint8_t GFXcompositor::update(void) {
+    for(uint8_t i=0; i<numSprites; i++) {
+        Sprite &s = sprites[i];
+        if(!s.changed) continue;
+        if(s.drawn) mark(s.sent);
+        Rect r  = { s.x, s.y, (int16_t)(s.x + s.w - 1),
+                    (int16_t)(s.y + s.h - 1) };
+        s.sent  = r;
+        if(s.shown) mark(s.sent);
+        s.drawn   = s.shown;
+        s.changed = false;
+    }
+    uint8_t n = numDirty;
+    if(n && scratch.getBuffer()) {
+        tft.startWrite();
+        for(uint8_t i=0; i<n; i++) send(dirty[i]);
+        tft.endWrite();
+    }
+    numDirty = 0;
+    return n;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Add a rectangle to send at the next update(), clipped to the
+             display, merged with any waiting rectangle it overlaps or
+             touches enough that together they cover no more pixels than
+             apart
+    @param   r  The rectangle
+*/
+/**************************************************************************/
+void GFXcompositor::mark(const Rect &r) {
+    Rect m = { max(r.x1, (int16_t)0), max(r.y1, (int16_t)0),
+               min(r.x2, (int16_t)(tft.width() - 1)),
+               min(r.y2, (int16_t)(tft.height() - 1)) };
+    if((m.x1 > m.x2) || (m.y1 > m.y2)) return;
+    for(uint8_t i=0; i<numDirty; ) {
+        Rect &d = dirty[i];
+        Rect u  = { min(d.x1, m.x1), min(d.y1, m.y1),
+                    max(d.x2, m.x2), max(d.y2, m.y2) };
+        if(area(u.x1, u.y1, u.x2, u.y2) <=
+           area(d.x1, d.y1, d.x2, d.y2) + area(m.x1, m.y1, m.x2, m.y2)) {
+            m = u;                       // Take it in and start again, the
+            dirty[i] = dirty[--numDirty]; // bigger one may reach others
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+    if(numDirty < 2 * GFX_SPRITES) {
+        dirty[numDirty++] = m;
+    } else { // Full, which takes more than every sprite changing at once
+        Rect &d = dirty[numDirty - 1];
+        d.x1 = min(d.x1, m.x1);
+        d.y1 = min(d.y1, m.y1);
+        d.x2 = max(d.x2, m.x2);
+        d.y2 = max(d.y2, m.y2);
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Mark the whole display to send at the next update()
+*/
+/**************************************************************************/
+void GFXcompositor::markAll(void) {
+    Rect all = { 0, 0, (int16_t)(tft.width() - 1), (int16_t)(tft.height() - 1) };
+    mark(all);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Put together and send a rectangle, a scratch canvas at a time.
+             Must be inside startWrite() and endWrite(). Each window waits
+             for the pixels before it, and the last is waited for before
+             it returns.
+    @param   r  Rectangle on the display
+*/
+/**************************************************************************/
+void GFXcompositor::send(const Rect &r) {
+    uint16_t *buf = scratch.getBuffer();
+    int16_t   sw  = scratch.width();
+    for(int16_t y=r.y1; y<=r.y2; y+=scratch.height()) {
+        int16_t h = min((int16_t)(r.y2 - y + 1), scratch.height());
+        for(int16_t x=r.x1; x<=r.x2; x+=sw) {
+            int16_t w = min((int16_t)(r.x2 - x + 1), sw);
+            // Either way buf has been copied or sent by the time a span's
+            // writePixels() returns, so it can be refilled while the last
+            // span goes out; the window's commands wait
+            compose(x, y, w, h);
+            tft.dmaWait();
+            tft.setAddrWindow(x, y, w, h);
+            if(w == sw) {
+                tft.writePixels(buf, (uint32_t)w * h, COMPOSITOR_BLOCK);
+            } else { // The window's rows aren't whole canvas rows
+                for(int16_t row=0; row<h; row++) {
+                    tft.writePixels(&buf[row * sw], w, COMPOSITOR_BLOCK);
+                }
+            }
+        }
+    }
+    tft.dmaWait();
+}
+
+/**************************************************************************/
+/*!
+   @brief    Put together a piece of the display in the top left corner of
+             the scratch canvas: the background, then each sprite in front
+    @param   x  Left edge on the display
+    @param   y  Top edge on the display
+    @param   w  Width, at most the canvas width
+    @param   h  Height, at most the canvas height
+*/
+/**************************************************************************/
+void GFXcompositor::compose(int16_t x, int16_t y, int16_t w, int16_t h) {
+    uint16_t *buf = scratch.getBuffer();
+    int16_t   sw  = scratch.width();
+
+    // Background, from the canvas where it covers
+    int16_t bw = 0, bh = 0;
+    if(backCanvas && backCanvas->getBuffer()) {
+        bw = backCanvas->width();
+        bh = backCanvas->height();
+    }
+    for(int16_t row=0; row<h; row++) {
+        uint16_t *dst = &buf[row * sw];
+        int16_t   n   = ((y + row) < bh) ? max(min(w, bw - x), 0) : 0;
+        if(n) {
+            memcpy(dst, &backCanvas->getBuffer()[(int32_t)(y + row) * bw + x],
+              n * 2);
+        }
+        if(n < w) gfx565Fill(&dst[n], backColor, w - n);
+    }
+
+    // Sprites, back to front
+    for(uint8_t i=0; i<numSprites; i++) {
+        const Sprite &s = sprites[i];
+        if(!s.shown) continue;
+        int16_t x1 = max(s.x, x), x2 = min(s.x + s.w, x + w),
+                y1 = max(s.y, y), y2 = min(s.y + s.h, y + h);
+        int16_t maskW = (s.w + 7) / 8;
+        for(int16_t sy=y1; sy<y2; sy++) {
+            const uint16_t *src  = &s.bitmap[(int32_t)(sy - s.y) * s.w];
+            const uint8_t  *mask = s.mask ? &s.mask[(sy - s.y) * maskW] : NULL;
+            uint16_t       *dst  = &buf[(sy - y) * sw];
+#if !defined(__AVR__) // Flash is in the address space, read it directly
+            if(!mask) {
+                if(x1 < x2) {
+                    gfx565CopyKey(&dst[x1 - x], &src[x1 - s.x], x2 - x1, s.key);
+                }
+                continue;
+            }
+#endif
+            for(int16_t sx=x1; sx<x2; sx++) {
+                int16_t  i = sx - s.x;
+                uint16_t c = pgm_read_word(&src[i]);
+                if(mask ? (pgm_read_byte(&mask[i >> 3]) & (0x80 >> (i & 7))) :
+                          (c != s.key)) {
+                    dst[sx - x] = c;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,98 @@
+/*!
+ * @file Adafruit_Compositor.h
+ *
+ * Part of Adafruit's GFX graphics library. Sprites over a still
+ * background on an Adafruit_SPITFT display: when sprites move or change,
+ * only the area they left and the area they moved to is put together in a
+ * small canvas and sent, so nothing is erased on the display and nothing
+ * flickers.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _ADAFRUIT_COMPOSITOR_H_
+#define _ADAFRUIT_COMPOSITOR_H_
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_SPITFT.h"
+
+#if !defined(GFX_SPRITES)
+ #define GFX_SPRITES 8 ///< Most sprites a compositor holds
+#endif
+#if !defined(GFX_SPRITE_SCRATCH)
+ #define GFX_SPRITE_SCRATCH 64 ///< Default side of the canvas areas are put together in
+#endif
+
+/*!
+  @brief  A background and up to GFX_SPRITES sprites on top of it, later
+          sprites in front of earlier ones.
+
+          A sprite is a 16-bit bitmap, the same as drawRGBBitmap() takes,
+          with either a transparent key color or a 1-bit mask (one bit per
+          pixel, rows padded to whole bytes, 1 for drawn) showing what's
+          behind it. The background is a single color or a GFXcanvas16 the
+          size of the display.
+
+          Moving a sprite, giving it another bitmap (the next frame of an
+          animation) or hiding it marks the rectangle it was drawn in and
+          the one it will be drawn in. update() merges the marked
+          rectangles that overlap, then for each one fills the scratch
+          canvas from the background, draws every sprite that touches it
+          and sends it in a single address window. Areas bigger than the
+          scratch canvas go a canvas-sized piece at a time. On Particle a
+          piece is sent by DMA while the next one is put together.
+
+          Coordinates are the display's at its current rotation. Bitmaps,
+          masks and the background canvas aren't copied, so must not go
+          away while in use; change them only through setBitmap() and
+          setBackground().
+*/
+class GFXcompositor {
+ public:
+  GFXcompositor(Adafruit_SPITFT &tft, uint16_t scratchW = GFX_SPRITE_SCRATCH,
+    uint16_t scratchH = GFX_SPRITE_SCRATCH);
+  int8_t    addSprite(const uint16_t *bitmap, int16_t w, int16_t h,
+              uint16_t key),
+            addSprite(const uint16_t *bitmap, const uint8_t *mask,
+              int16_t w, int16_t h);
+  void      setBackground(uint16_t color),
+            setBackground(const GFXcanvas16 *canvas),
+            setBitmap(int8_t id, const uint16_t *bitmap,
+              const uint8_t *mask = NULL),
+            moveSprite(int8_t id, int16_t x, int16_t y),
+            showSprite(int8_t id, bool show),
+            redraw(void);
+  uint8_t   update(void);
+
+ private:
+  /// Rectangle on the display, corners inclusive
+  struct Rect { int16_t x1, y1, x2, y2; };
+
+  /// One sprite, and where it was last sent
+  struct Sprite {
+    const uint16_t *bitmap;
+    const uint8_t  *mask;   ///< NULL to use key instead
+    uint16_t key;
+    int16_t  x, y, w, h;
+    bool     shown;         ///< Should be on the display
+    bool     drawn;         ///< Is on the display, at 'sent'
+    bool     changed;       ///< Since the last update()
+    Rect     sent;
+  };
+
+  void      mark(const Rect &r),
+            markAll(void),
+            compose(int16_t x, int16_t y, int16_t w, int16_t h),
+            send(const Rect &r);
+
+  Adafruit_SPITFT &tft;
+  GFXcanvas16      scratch;
+  const GFXcanvas16 *backCanvas;   ///< NULL for a solid background
+  uint16_t  backColor;
+  Sprite    sprites[GFX_SPRITES];
+  uint8_t   numSprites;
+  Rect      dirty[2 * GFX_SPRITES];
+  uint8_t   numDirty;
+};
+
+#endif // _ADAFRUIT_COMPOSITOR_H_
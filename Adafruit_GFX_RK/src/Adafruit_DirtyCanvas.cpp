@@ -0,0 +1,401 @@
+/*!
+ * @file Adafruit_DirtyCanvas.cpp
+ *
+ * Part of Adafruit's GFX graphics library. See Adafruit_DirtyCanvas.h.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_DirtyCanvas.h"
+#include "Adafruit_Pixel565.h"
+
+#ifndef min
+#define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef max
+#define max(a,b) (((a) > (b)) ? (a) : (b))
+#endif
+
+// Tile flags, see flush()
+#define TILE_STALE   0x01 ///< Display content unknown, e.g. after markDirty()
+#define TILE_SEEN    0x02 ///< Already hashed during this flush()
+#define TILE_CHANGED 0x04 ///< Differs from what was last sent
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate a dirty-tracking 16-bit canvas. Everything starts
+             out dirty, as nothing is known about what the display shows.
+    @param   w   Canvas width, in pixels
+    @param   h   Canvas height, in pixels
+*/
+/**************************************************************************/
+GFXcanvas16Dirty::GFXcanvas16Dirty(uint16_t w, uint16_t h) :
+  GFXcanvas16(w, h) {
+    direct    = false; // Fills and copies go through drawPixel()
+    numRects  = 0;
+    tilesX    = (w + GFX_DIRTY_TILE - 1) / GFX_DIRTY_TILE;
+    tilesY    = (h + GFX_DIRTY_TILE - 1) / GFX_DIRTY_TILE;
+    tileHash  = (uint32_t *)malloc(tilesX * tilesY * sizeof(uint32_t));
+    tileState = (uint8_t *)malloc(tilesX * tilesY);
+    if(!tileHash || !tileState) { // Still works, just sends more
+        if(tileHash)  free(tileHash);
+        if(tileState) free(tileState);
+        tileHash  = NULL;
+        tileState = NULL;
+    } else {
+        memset(tileState, 0, tilesX * tilesY);
+    }
+    markAllDirty();
+}
+
+/**************************************************************************/
+/*!
+   @brief    Delete the canvas, free memory
+*/
+/**************************************************************************/
+GFXcanvas16Dirty::~GFXcanvas16Dirty(void) {
+    if(tileHash)  free(tileHash);
+    if(tileState) free(tileState);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw a pixel to the canvas framebuffer, marking it dirty only
+            if its color changes
+    @param  x   x coordinate
+    @param  y   y coordinate
+    @param  color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas16Dirty::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    uint16_t *buffer = getBuffer();
+    if(buffer) {
+        if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return;
+
+        int16_t t;
+        switch(rotation) {
+            case 1:
+                t = x;
+                x = WIDTH  - 1 - y;
+                y = t;
+                break;
+            case 2:
+                x = WIDTH  - 1 - x;
+                y = HEIGHT - 1 - y;
+                break;
+            case 3:
+                t = x;
+                x = y;
+                y = HEIGHT - 1 - t;
+                break;
+        }
+
+        uint16_t *p = &buffer[x + y * WIDTH];
+        if(*p != color) {
+            *p = color;
+            addRect(x, y, x, y);
+        }
+    }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fill the framebuffer completely with one color. Each row only
+            dirties the span between its first and last changed pixel.
+    @param  color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas16Dirty::fillScreen(uint16_t color) {
+    uint16_t *buffer = getBuffer();
+    if(buffer) {
+        for(int16_t y=0; y<HEIGHT; y++) {
+            uint16_t *row = &buffer[y * WIDTH];
+            int16_t   x1  = 0, x2 = WIDTH - 1;
+            while((x1 <= x2) && (row[x1] == color)) x1++;
+            if(x1 > x2) continue; // Row already that color
+            while(row[x2] == color) x2--;
+            gfx565Fill(&row[x1], color, x2 - x1 + 1);
+            addRect(x1, y, x2, y);
+        }
+    }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Force an area to be sent by the next flush(), e.g. when
+            something else drew over that part of the display
+    @param  x   Left edge, unrotated canvas coordinates
+    @param  y   Top edge, unrotated canvas coordinates
+    @param  w   Width in pixels
+    @param  h   Height in pixels
+*/
+/**************************************************************************/
+void GFXcanvas16Dirty::markDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+    int16_t x2 = x + w - 1, y2 = y + h - 1;
+    if(x  <  0)      x  = 0;
+    if(y  <  0)      y  = 0;
+    if(x2 >= WIDTH)  x2 = WIDTH  - 1;
+    if(y2 >= HEIGHT) y2 = HEIGHT - 1;
+    if((x > x2) || (y > y2)) return;
+
+    addRect(x, y, x2, y2);
+    if(tileState) { // Don't trust tile hashes here either
+        for(int16_t ty=y/GFX_DIRTY_TILE; ty<=y2/GFX_DIRTY_TILE; ty++) {
+            for(int16_t tx=x/GFX_DIRTY_TILE; tx<=x2/GFX_DIRTY_TILE; tx++) {
+                tileState[ty * tilesX + tx] |= TILE_STALE;
+            }
+        }
+    }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Force the whole canvas to be sent by the next flush()
+*/
+/**************************************************************************/
+void GFXcanvas16Dirty::markAllDirty(void) {
+    numRects = 0;
+    markDirty(0, 0, WIDTH, HEIGHT);
+}
+
+/**************************************************************************/
+/*!
+    @brief   Send the dirty regions to a display, all in a single
+             transaction. Parts of a region whose tiles are unchanged since
+             the last flush are skipped, and what's left is sent as one
+             address window per run of rows with the same changed span.
+    @param   tft  Display to copy to
+    @param   x    Display column of the canvas' left edge
+    @param   y    Display row of the canvas' top edge
+    @returns Number of pixels sent
+*/
+/**************************************************************************/
+uint32_t GFXcanvas16Dirty::flush(Adafruit_SPITFT &tft, int16_t x, int16_t y) {
+    return update(&tft, x, y);
+}
+
+/**************************************************************************/
+/*!
+    @brief   Common code for flush() and clearDirty()
+    @param   tft  Display to copy to, or NULL to only bring the tile hashes
+                  up to date
+    @param   x    Display column of the canvas' left edge
+    @param   y    Display row of the canvas' top edge
+    @returns Number of pixels sent
+*/
+/**************************************************************************/
+uint32_t GFXcanvas16Dirty::update(Adafruit_SPITFT *tft, int16_t x, int16_t y) {
+    uint32_t pixels = 0;
+    if(!getBuffer() || !numRects) return 0;
+
+    if(tft) tft->startWrite();
+    if(!tileState) {
+        for(uint8_t i=0; i<numRects; i++) {
+            pixels += sendRect(tft, x, y,
+              rects[i].x1, rects[i].y1, rects[i].x2, rects[i].y2);
+        }
+    } else {
+        // Hash every tile under a dirty region once, flagging the ones
+        // that differ from what the display was last sent
+        for(uint8_t i=0; i<numRects; i++) {
+            const Rect &r = rects[i];
+            for(int16_t ty=r.y1/GFX_DIRTY_TILE; ty<=r.y2/GFX_DIRTY_TILE; ty++) {
+                for(int16_t tx=r.x1/GFX_DIRTY_TILE; tx<=r.x2/GFX_DIRTY_TILE; tx++) {
+                    uint16_t t     = ty * tilesX + tx;
+                    uint8_t  state = tileState[t];
+                    if(state & TILE_SEEN) continue;
+                    uint32_t h = hashTile(tx, ty);
+                    if((state & TILE_STALE) || (h != tileHash[t])) {
+                        state |= TILE_CHANGED;
+                    }
+                    tileHash[t]  = h;
+                    tileState[t] = (state | TILE_SEEN) & ~TILE_STALE;
+                }
+            }
+        }
+
+        // Send changed tiles, clipped to each region
+        for(uint8_t i=0; i<numRects; i++) {
+            const Rect &r = rects[i];
+            int16_t px1 = 0, px2 = -1, py1 = 0, py2 = -1; // Pending window
+            for(int16_t ty=r.y1/GFX_DIRTY_TILE; ty<=r.y2/GFX_DIRTY_TILE; ty++) {
+                int16_t tx1 = -1, tx2 = -1;
+                for(int16_t tx=r.x1/GFX_DIRTY_TILE; tx<=r.x2/GFX_DIRTY_TILE; tx++) {
+                    if(tileState[ty * tilesX + tx] & TILE_CHANGED) {
+                        if(tx1 < 0) tx1 = tx;
+                        tx2 = tx;
+                    }
+                }
+                int16_t x1 = max(r.x1, tx1 * GFX_DIRTY_TILE),
+                        x2 = min(r.x2, (tx2 + 1) * GFX_DIRTY_TILE - 1),
+                        y1 = max(r.y1, ty * GFX_DIRTY_TILE),
+                        y2 = min(r.y2, (ty + 1) * GFX_DIRTY_TILE - 1);
+                if((tx1 >= 0) && (x1 == px1) && (x2 == px2) && (y1 == py2 + 1)) {
+                    py2 = y2; // Same span as the tile row above, grow it
+                    continue;
+                }
+                if(px2 >= px1) pixels += sendRect(tft, x, y, px1, py1, px2, py2);
+                if(tx1 >= 0) {
+                    px1 = x1; px2 = x2; py1 = y1; py2 = y2;
+                } else {
+                    px1 = 0;  px2 = -1;
+                }
+            }
+            if(px2 >= px1) pixels += sendRect(tft, x, y, px1, py1, px2, py2);
+        }
+
+        for(uint8_t i=0; i<numRects; i++) {
+            const Rect &r = rects[i];
+            for(int16_t ty=r.y1/GFX_DIRTY_TILE; ty<=r.y2/GFX_DIRTY_TILE; ty++) {
+                for(int16_t tx=r.x1/GFX_DIRTY_TILE; tx<=r.x2/GFX_DIRTY_TILE; tx++) {
+                    tileState[ty * tilesX + tx] &= ~(TILE_SEEN | TILE_CHANGED);
+                }
+            }
+        }
+    }
+    if(tft) tft->endWrite();
+
+    numRects = 0;
+    return pixels;
+}
+
+/**************************************************************************/
+/*!
+    @brief   Hash one tile's pixels (FNV-1a over 16-bit values)
+    @param   tx   Tile column
+    @param   ty   Tile row
+    @returns 32-bit hash
+*/
+/**************************************************************************/
+uint32_t GFXcanvas16Dirty::hashTile(int16_t tx, int16_t ty) {
+    uint16_t *buffer = getBuffer();
+    int16_t   x1 = tx * GFX_DIRTY_TILE, y1 = ty * GFX_DIRTY_TILE,
+              x2 = min(x1 + GFX_DIRTY_TILE, WIDTH),
+              y2 = min(y1 + GFX_DIRTY_TILE, HEIGHT);
+    uint32_t  h  = 2166136261UL;
+    for(int16_t y=y1; y<y2; y++) {
+        uint16_t *p = &buffer[y * WIDTH + x1];
+        for(int16_t x=x1; x<x2; x++) {
+            h = (h ^ *p++) * 16777619UL;
+        }
+    }
+    return h;
+}
+
+/**************************************************************************/
+/*!
+    @brief   Send one rectangle of the canvas, clipped to the display.
+             Must be inside a startWrite()/endWrite() pair.
+    @param   tft  Display to copy to, NULL to send nothing
+    @param   x    Display column of the canvas' left edge
+    @param   y    Display row of the canvas' top edge
+    @param   x1   Left edge, unrotated canvas coordinates
+    @param   y1   Top edge
+    @param   x2   Right edge, inclusive
+    @param   y2   Bottom edge, inclusive
+    @returns Number of pixels sent
+*/
+/**************************************************************************/
+uint32_t GFXcanvas16Dirty::sendRect(Adafruit_SPITFT *tft, int16_t x, int16_t y,
+  int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    if(!tft) return 0;
+    if(x + x1 < 0)              x1 = -x;
+    if(y + y1 < 0)              y1 = -y;
+    if(x + x2 >= tft->width())  x2 = tft->width()  - 1 - x;
+    if(y + y2 >= tft->height()) y2 = tft->height() - 1 - y;
+    if((x1 > x2) || (y1 > y2)) return 0;
+
+    uint16_t *buffer = getBuffer();
+    int16_t   w = x2 - x1 + 1;
+    tft->setAddrWindow(x + x1, y + y1, w, y2 - y1 + 1);
+    for(int16_t row=y1; row<=y2; row++) {
+        tft->writePixels(&buffer[row * WIDTH + x1], w);
+    }
+    return (uint32_t)w * (y2 - y1 + 1);
+}
+
+/**************************************************************************/
+/*!
+    @brief   How many unchanged pixels merging two regions would re-send
+    @param   a   First region
+    @param   b   Second region
+    @returns Pixel count, negative if the regions overlap enough that
+             merging sends less than keeping them apart
+*/
+/**************************************************************************/
+int32_t GFXcanvas16Dirty::mergeCost(const Rect &a, const Rect &b) {
+    int32_t ux = (int32_t)max(a.x2, b.x2) - min(a.x1, b.x1) + 1,
+            uy = (int32_t)max(a.y2, b.y2) - min(a.y1, b.y1) + 1;
+    return ux * uy -
+      (int32_t)(a.x2 - a.x1 + 1) * (a.y2 - a.y1 + 1) -
+      (int32_t)(b.x2 - b.x1 + 1) * (b.y2 - b.y1 + 1);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Add a dirty region, merging it into an existing one when that's
+            cheap (or when the list is full)
+    @param  x1  Left edge, unrotated canvas coordinates
+    @param  y1  Top edge
+    @param  x2  Right edge, inclusive
+    @param  y2  Bottom edge, inclusive
+*/
+/**************************************************************************/
+void GFXcanvas16Dirty::addRect(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    Rect    r = { x1, y1, x2, y2 };
+    uint8_t best = 0;
+    int32_t bestCost = INT32_MAX;
+
+    for(uint8_t i=0; i<numRects; i++) {
+        Rect &d = rects[i];
+        if((x1 >= d.x1) && (x2 <= d.x2) && (y1 >= d.y1) && (y2 <= d.y2)) {
+            return; // Already covered, the common case while drawing
+        }
+        int32_t cost = mergeCost(d, r);
+        if(cost < bestCost) {
+            bestCost = cost;
+            best     = i;
+        }
+    }
+
+    if((bestCost > GFX_DIRTY_SLACK) && (numRects < GFX_DIRTY_RECTS)) {
+        rects[numRects++] = r;
+        return;
+    }
+
+    // Grow the cheapest region to cover this one
+    Rect &d = rects[best];
+    d.x1 = min(d.x1, x1);
+    d.y1 = min(d.y1, y1);
+    d.x2 = max(d.x2, x2);
+    d.y2 = max(d.y2, y2);
+    coalesce(best);
+}
+
+/**************************************************************************/
+/*!
+    @brief  After a region grows, fold in any others it now makes cheap
+            to merge
+    @param  i   Index of the region that grew
+*/
+/**************************************************************************/
+void GFXcanvas16Dirty::coalesce(uint8_t i) {
+    bool merged;
+    do {
+        merged = false;
+        for(uint8_t j=0; j<numRects; j++) {
+            if((j == i) || (mergeCost(rects[i], rects[j]) > GFX_DIRTY_SLACK)) {
+                continue;
+            }
+            rects[i].x1 = min(rects[i].x1, rects[j].x1);
+            rects[i].y1 = min(rects[i].y1, rects[j].y1);
+            rects[i].x2 = max(rects[i].x2, rects[j].x2);
+            rects[i].y2 = max(rects[i].y2, rects[j].y2);
+            // Remove j by moving the last region into its slot
+            rects[j] = rects[--numRects];
+            if(i == numRects) i = j; // Region i was the one moved
+            merged = true;
+            break;
+        }
+    } while(merged);
+}
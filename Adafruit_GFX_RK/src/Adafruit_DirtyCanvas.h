@@ -0,0 +1,90 @@
+/*!
+ * @file Adafruit_DirtyCanvas.h
+ *
+ * Part of Adafruit's GFX graphics library. A GFXcanvas16 that remembers
+ * which parts of it changed since it was last copied to an Adafruit_SPITFT
+ * display, so redrawing a whole screen (fillScreen() then everything on
+ * it) only sends the pixels that actually ended up different.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _ADAFRUIT_DIRTYCANVAS_H_
+#define _ADAFRUIT_DIRTYCANVAS_H_
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_SPITFT.h"
+
+#if !defined(GFX_DIRTY_RECTS)
+ #define GFX_DIRTY_RECTS 8  ///< Separate dirty regions kept before forcing merges
+#endif
+#if !defined(GFX_DIRTY_SLACK)
+ #define GFX_DIRTY_SLACK 64 ///< Unchanged pixels a merge may re-send to save an address window
+#endif
+#if !defined(GFX_DIRTY_TILE)
+ #define GFX_DIRTY_TILE  8  ///< Side of the square tiles checked against the last flush
+#endif
+
+/*!
+  @brief  A 16-bit canvas that tracks dirty rectangles as it's drawn on and
+          flushes only those to a display, so the usual "clear the screen
+          and draw it all again" pattern costs little more than the pixels
+          that actually changed.
+
+          Overlapping or nearby regions are merged when doing so re-sends
+          no more than GFX_DIRTY_SLACK unchanged pixels, since every extra
+          region costs an address window (11 bytes on ILI9341) of its own.
+
+          Erasing and redrawing the same thing dirties pixels that end up
+          unchanged, so flush() also keeps a hash of each GFX_DIRTY_TILE
+          square tile as last sent (5 bytes per tile, under 5K for
+          320x240) and skips tiles that hash the same as before.
+
+          Coordinates passed to flush() are display coordinates, so make
+          the canvas the size of the area it covers at the display's current
+          rotation, and rotate the display rather than the canvas.
+*/
+class GFXcanvas16Dirty : public GFXcanvas16 {
+ public:
+  GFXcanvas16Dirty(uint16_t w, uint16_t h);
+  ~GFXcanvas16Dirty(void);
+  void      drawPixel(int16_t x, int16_t y, uint16_t color),
+            fillScreen(uint16_t color),
+            markDirty(int16_t x, int16_t y, int16_t w, int16_t h),
+            markAllDirty(void);
+  uint32_t  flush(Adafruit_SPITFT &tft, int16_t x = 0, int16_t y = 0);
+  /**********************************************************************/
+  /*!
+    @brief    Forget all dirty regions without sending them, e.g. after
+              drawing the same picture straight to the display
+  */
+  /**********************************************************************/
+  void      clearDirty(void) { update(NULL, 0, 0); }
+  /**********************************************************************/
+  /*!
+    @brief    Get the number of separate dirty regions waiting for flush()
+    @returns  0 when the display is up to date
+  */
+  /**********************************************************************/
+  uint8_t   dirtyCount(void) const { return numRects; }
+
+ private:
+  void      addRect(int16_t x1, int16_t y1, int16_t x2, int16_t y2),
+            coalesce(uint8_t i);
+  uint32_t  update(Adafruit_SPITFT *tft, int16_t x, int16_t y),
+            hashTile(int16_t tx, int16_t ty),
+            sendRect(Adafruit_SPITFT *tft, int16_t x, int16_t y,
+              int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+
+  /// Dirty region in unrotated canvas coordinates, corners inclusive
+  struct Rect { int16_t x1, y1, x2, y2; };
+  static int32_t mergeCost(const Rect &a, const Rect &b);
+
+  Rect      rects[GFX_DIRTY_RECTS];
+  uint8_t   numRects;
+  uint32_t *tileHash;       ///< Per tile, hash of the pixels as last sent
+  uint8_t  *tileState;      ///< Per tile, TILE_* flags
+  uint16_t  tilesX, tilesY; ///< Tile grid size
+};
+
+#endif // _ADAFRUIT_DIRTYCANVAS_H_
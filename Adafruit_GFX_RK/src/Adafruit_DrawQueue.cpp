@@ -0,0 +1,264 @@
+/*!
+ * @file Adafruit_DrawQueue.cpp
+ *
+ * Part of Adafruit's GFX graphics library. See Adafruit_DrawQueue.h.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_DrawQueue.h"
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate a drawing queue
+    @param   target  Where flush() sends the drawing, at its current size
+    @param   length  Most fills held before flushing on its own
+*/
+/**************************************************************************/
+GFXdrawQueue::GFXdrawQueue(Adafruit_GFX &target, uint16_t length) :
+  Adafruit_GFX(target.width(), target.height()), target(target) {
+    fills = (Fill *)malloc(length * sizeof(Fill));
+    size  = fills ? length : 0; // No queue, everything goes straight through
+    count = 0;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Delete the queue, dropping anything not flushed
+*/
+/**************************************************************************/
+GFXdrawQueue::~GFXdrawQueue(void) {
+    if(fills) free(fills);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Queue a fill, clipped to the target: drop queued fills it
+             covers, then merge it into a recent fill it continues, if
+             nothing queued after that one overlaps it
+    @param   x      Left edge
+    @param   y      Top edge
+    @param   w      Width, positive
+    @param   h      Height, positive
+    @param   color  16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXdrawQueue::add(int16_t x, int16_t y, int16_t w, int16_t h,
+  uint16_t color) {
+    if(x < 0) { w += x; x = 0; }
+    if(y < 0) { h += y; y = 0; }
+    if(x + w > _width)  w = _width  - x;
+    if(y + h > _height) h = _height - y;
+    if((w <= 0) || (h <= 0)) return;
+
+    if(!size) {
+        target.fillRect(x, y, w, h, color);
+        return;
+    }
+
+    // Whatever this covers is never seen
+    uint16_t keep = 0;
+    for(uint16_t i=0; i<count; i++) {
+        Fill *f = &fills[i];
+        if((f->x < x) || (f->y < y) ||
+           (f->x + f->w > x + w) || (f->y + f->h > y + h)) {
+            fills[keep++] = *f;
+        }
+    }
+    count = keep;
+
+    // Newest first, stopping at the first one it overlaps, as going past
+    // that would change which is drawn on top
+    for(uint16_t i=count, n=0; (i > 0) && (n < GFX_QUEUE_LOOKBACK); n++) {
+        Fill *f = &fills[--i];
+        if(f->color == color) {
+            if((f->x == x) && (f->w == w) &&
+               ((f->y + f->h == y) || (y + h == f->y))) {
+                if(y < f->y) f->y = y;
+                f->h += h;
+                return;
+            }
+            if((f->y == y) && (f->h == h) &&
+               ((f->x + f->w == x) || (x + w == f->x))) {
+                if(x < f->x) f->x = x;
+                f->w += w;
+                return;
+            }
+            if((x >= f->x) && (y >= f->y) &&
+               (x + w <= f->x + f->w) && (y + h <= f->y + f->h)) {
+                return; // Already that color
+            }
+        }
+        if((x < f->x + f->w) && (f->x < x + w) &&
+           (y < f->y + f->h) && (f->y < y + h)) break;
+    }
+
+    if(count == size) flush();
+    Fill *f  = &fills[count++];
+    f->x     = x;
+    f->y     = y;
+    f->w     = w;
+    f->h     = h;
+    f->color = color;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Send everything queued to the target in one transaction
+   @returns  Number of fills sent
+*/
+/**************************************************************************/
+uint16_t GFXdrawQueue::flush(void) {
+    uint16_t n = count;
+    if(!n) return 0;
+    target.startWrite();
+    for(uint16_t i=0; i<n; i++) {
+        Fill *f = &fills[i];
+        if((f->w == 1) && (f->h == 1)) {
+            target.writePixel(f->x, f->y, f->color);
+        } else {
+            target.writeFillRect(f->x, f->y, f->w, f->h, f->color);
+        }
+    }
+    target.endWrite();
+    count = 0;
+    return n;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Set the rotation of the target, and of the queue to match.
+             Fills already queued are flushed first, at the old rotation.
+    @param   r  Rotation, 0 thru 3
+*/
+/**************************************************************************/
+void GFXdrawQueue::setRotation(uint8_t r) {
+    flush();
+    target.setRotation(r);
+    rotation = target.getRotation();
+    _width   = target.width();
+    _height  = target.height();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queue a pixel
+    @param  x   x coordinate
+    @param  y   y coordinate
+    @param  color 16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void GFXdrawQueue::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    add(x, y, 1, 1, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queue a pixel, same as drawPixel()
+    @param  x   x coordinate
+    @param  y   y coordinate
+    @param  color 16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void GFXdrawQueue::writePixel(int16_t x, int16_t y, uint16_t color) {
+    add(x, y, 1, 1, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queue a filled rectangle, same as fillRect()
+    @param  x   Top left corner x coordinate
+    @param  y   Top left corner y coordinate
+    @param  w   Width in pixels, may be negative
+    @param  h   Height in pixels, may be negative
+    @param  color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXdrawQueue::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+  uint16_t color) {
+    fillRect(x, y, w, h, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queue a vertical line, same as drawFastVLine()
+    @param  x   Top-most x coordinate
+    @param  y   Top-most y coordinate
+    @param  h   Height in pixels, may be negative
+    @param  color 16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void GFXdrawQueue::writeFastVLine(int16_t x, int16_t y, int16_t h,
+  uint16_t color) {
+    fillRect(x, y, 1, h, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queue a horizontal line, same as drawFastHLine()
+    @param  x   Left-most x coordinate
+    @param  y   Left-most y coordinate
+    @param  w   Width in pixels, may be negative
+    @param  color 16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void GFXdrawQueue::writeFastHLine(int16_t x, int16_t y, int16_t w,
+  uint16_t color) {
+    fillRect(x, y, w, 1, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queue a vertical line
+    @param  x   Top-most x coordinate
+    @param  y   Top-most y coordinate
+    @param  h   Height in pixels, may be negative
+    @param  color 16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void GFXdrawQueue::drawFastVLine(int16_t x, int16_t y, int16_t h,
+  uint16_t color) {
+    fillRect(x, y, 1, h, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queue a horizontal line
+    @param  x   Left-most x coordinate
+    @param  y   Left-most y coordinate
+    @param  w   Width in pixels, may be negative
+    @param  color 16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void GFXdrawQueue::drawFastHLine(int16_t x, int16_t y, int16_t w,
+  uint16_t color) {
+    fillRect(x, y, w, 1, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queue a filled rectangle
+    @param  x   Top left corner x coordinate
+    @param  y   Top left corner y coordinate
+    @param  w   Width in pixels, may be negative
+    @param  h   Height in pixels, may be negative
+    @param  color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXdrawQueue::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+  uint16_t color) {
+    if(w < 0) { x += w + 1; w = -w; }
+    if(h < 0) { y += h + 1; h = -h; }
+    add(x, y, w, h, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Queue a fill of the whole target, which replaces everything
+            queued so far
+    @param  color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXdrawQueue::fillScreen(uint16_t color) {
+    add(0, 0, _width, _height, color);
+}
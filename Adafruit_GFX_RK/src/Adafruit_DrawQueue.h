@@ -0,0 +1,79 @@
+/*!
+ * @file Adafruit_DrawQueue.h
+ *
+ * Part of Adafruit's GFX graphics library. Collects drawing calls and
+ * sends them to another Adafruit_GFX (usually a display) later, all in one
+ * transaction, after merging what can be merged and dropping what would
+ * be drawn over anyway.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _ADAFRUIT_DRAWQUEUE_H_
+#define _ADAFRUIT_DRAWQUEUE_H_
+
+#include "Adafruit_GFX.h"
+
+#if !defined(GFX_QUEUE_LENGTH)
+ #define GFX_QUEUE_LENGTH 256 ///< Default queue capacity, 10 bytes each
+#endif
+#if !defined(GFX_QUEUE_LOOKBACK)
+ #define GFX_QUEUE_LOOKBACK 8 ///< Queued fills a new one may merge with
+#endif
+
+/*!
+  @brief  A deferred drawing queue in front of another Adafruit_GFX.
+
+          Everything drawn on it (lines, rectangles, circles, text...)
+          arrives as solid fills, pixels being 1x1 fills, which are queued
+          until flush() (or until the queue is full) and then sent to the
+          target between a single startWrite() and endWrite(). On the way:
+
+          - a fill the same color as a recent one and continuing it along a
+            row or a column is merged into it, so stacked lines, line runs
+            and pixel runs become one address window;
+          - a fill completely covers any queued fill inside it, so those
+            are dropped: fillScreen() empties the queue.
+
+          The queue draws in the target's coordinates at the rotation the
+          target had when the queue was made; use setRotation() on the
+          queue to rotate both.
+*/
+class GFXdrawQueue : public Adafruit_GFX {
+ public:
+  GFXdrawQueue(Adafruit_GFX &target, uint16_t length = GFX_QUEUE_LENGTH);
+  ~GFXdrawQueue(void);
+
+  void      drawPixel(int16_t x, int16_t y, uint16_t color),
+            writePixel(int16_t x, int16_t y, uint16_t color),
+            writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+              uint16_t color),
+            writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
+            writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+            drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
+            drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+            fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+              uint16_t color),
+            fillScreen(uint16_t color),
+            setRotation(uint8_t r);
+  uint16_t  flush(void);
+  /**********************************************************************/
+  /*!
+    @brief    Get the number of fills waiting for flush()
+    @returns  Queue length
+  */
+  /**********************************************************************/
+  uint16_t  queued(void) const { return count; }
+
+ private:
+  void      add(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+  /// One queued solid fill
+  struct Fill { int16_t x, y, w, h; uint16_t color; };
+
+  Adafruit_GFX &target;
+  Fill     *fills;
+  uint16_t  size, count;
+};
+
+#endif // _ADAFRUIT_DRAWQUEUE_H_
@@ -11,6 +11,35 @@
  #include "WProgram.h"
 #endif
 #include "gfxfont.h"
+#include "Adafruit_RunFont.h"
+
+#if defined(SPITFT_TRACE)
+/// Primitive ids for bus tracing, see Adafruit_SPITFT::traceReport()
+enum {
+  GFX_TRACE_OTHER = 0,      ///< Outside any primitive (init, user setAddrWindow())
+  GFX_TRACE_PIXEL,          ///< drawPixel(), pushColor()
+  GFX_TRACE_HLINE,          ///< drawFastHLine()
+  GFX_TRACE_VLINE,          ///< drawFastVLine()
+  GFX_TRACE_LINE,           ///< drawLine()
+  GFX_TRACE_RECT,           ///< drawRect()
+  GFX_TRACE_FILLRECT,       ///< fillRect()
+  GFX_TRACE_FILLSCREEN,     ///< fillScreen()
+  GFX_TRACE_CIRCLE,         ///< drawCircle()
+  GFX_TRACE_FILLCIRCLE,     ///< fillCircle()
+  GFX_TRACE_TRIANGLE,       ///< drawTriangle()
+  GFX_TRACE_FILLTRIANGLE,   ///< fillTriangle()
+  GFX_TRACE_ROUNDRECT,      ///< drawRoundRect()
+  GFX_TRACE_FILLROUNDRECT,  ///< fillRoundRect()
+  GFX_TRACE_FILLPOLYGON,    ///< fillPolygon()
+  GFX_TRACE_BITMAP,         ///< 1-bit and grayscale bitmaps
+  GFX_TRACE_RGBBITMAP,      ///< drawRGBBitmap()
+  GFX_TRACE_CHAR,           ///< drawChar(), and so print()
+  GFX_TRACE_COUNT           ///< Number of ids, not an id
+};
+#endif
+
+class GFXglyphCache;
+struct GFXrleImage;
 
 /// A generic graphics superclass that can handle all sorts of drawing. At a minimum you can subclass and provide drawPixel(). At a maximum you can do a ton of overriding to optimize. Used for any/all Adafruit displays!
 class Adafruit_GFX : public Print {
@@ -34,6 +63,11 @@ class Adafruit_GFX : public Print {
   virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
   virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
   virtual void endWrite(void);
+  // Optional block transfer, used by drawChar(). Displays that can take a
+  // rectangle of pixels in one go (Adafruit_SPITFT) override all three.
+  virtual bool writeWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+  virtual void writeWindowPixels(uint16_t *colors, uint32_t len);
+  virtual void writeWindowColor(uint16_t color, uint32_t len);
 
   // CONTROL API
   // These MAY be overridden by the subclass to provide device-specific
@@ -66,6 +100,8 @@ class Adafruit_GFX : public Print {
       int16_t x2, int16_t y2, uint16_t color),
     fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
       int16_t x2, int16_t y2, uint16_t color),
+    fillPolygon(const int16_t *x, const int16_t *y, uint8_t n,
+      uint16_t color),
     drawRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
       int16_t radius, uint16_t color),
     fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
@@ -98,6 +134,7 @@ class Adafruit_GFX : public Print {
       int16_t w, int16_t h),
     drawRGBBitmap(int16_t x, int16_t y,
       uint16_t *bitmap, uint8_t *mask, int16_t w, int16_t h),
+    drawRLEImage(int16_t x, int16_t y, const GFXrleImage *image),
     drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
       uint16_t bg, uint8_t size),
     drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
@@ -110,7 +147,8 @@ class Adafruit_GFX : public Print {
       int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h),
     setTextSize(uint8_t s),
     setTextSize(uint8_t sx, uint8_t sy),
-    setFont(const GFXfont *f = NULL);
+    setFont(const GFXfont *f = NULL),
+    setRunFont(const GFXrunFont *f);
 
   /**********************************************************************/
   /*!
@@ -168,6 +206,15 @@ class Adafruit_GFX : public Print {
   /**********************************************************************/
   void cp437(boolean x=true) { _cp437 = x; }
 
+  /**********************************************************************/
+  /*!
+    @brief  Keep glyphs drawn by drawChar() (and so print()) in a cache,
+            which may be shared with other displays and canvases
+    @param  cache  The cache, see Adafruit_GlyphCache.h, or NULL for none
+  */
+  /**********************************************************************/
+  void setGlyphCache(GFXglyphCache *cache) { glyphCache = cache; }
+
 #if ARDUINO >= 100
   virtual size_t write(uint8_t);
 #else
@@ -240,8 +287,48 @@ class Adafruit_GFX : public Print {
     _cp437;         ///< If set, use correct CP437 charset (default is off)
   GFXfont
     *gfxFont;       ///< Pointer to special font
+  const GFXrunFont
+    *runFont;       ///< gfxFont baked into runs, or NULL
+  GFXglyphCache
+    *glyphCache;    ///< Glyph cache for drawChar(), or NULL
+#if defined(SPITFT_TRACE)
+  uint8_t
+    tracePrim;      ///< Outermost primitive being drawn (GFX_TRACE_*)
+  /**********************************************************************/
+  /*!
+    @brief  Called on entry to each outermost primitive when tracing
+    @param  prim  GFX_TRACE_* id of the primitive
+  */
+  /**********************************************************************/
+  virtual void tracePrimitive(uint8_t prim) { (void)prim; }
+  friend class GFXTraceScope;
+#endif
 };
 
+#if defined(SPITFT_TRACE)
+/// Marks a primitive for the duration of a block. Nested primitives
+/// (fillRoundRect() calling fillRect()...) are charged to the outermost one.
+class GFXTraceScope {
+ public:
+  GFXTraceScope(Adafruit_GFX *gfx, uint8_t prim) :
+    _gfx(gfx), _outer(gfx->tracePrim == GFX_TRACE_OTHER) {
+    if(_outer) {
+      _gfx->tracePrim = prim;
+      _gfx->tracePrimitive(prim);
+    }
+  }
+  ~GFXTraceScope(void) {
+    if(_outer) _gfx->tracePrim = GFX_TRACE_OTHER;
+  }
+ private:
+  Adafruit_GFX *_gfx;
+  bool          _outer;
+};
+ #define GFX_TRACE(prim) GFXTraceScope _gfxTraceScope(this, prim) ///< Charge bus traffic in this block to prim
+#else
+ #define GFX_TRACE(prim) ///< Bus tracing disabled, nothing to do
+#endif
+
 
 /// A simple drawn button UI element
 class Adafruit_GFX_Button {
@@ -303,7 +390,12 @@ class GFXcanvas1 : public Adafruit_GFX {
   GFXcanvas1(uint16_t w, uint16_t h);
   ~GFXcanvas1(void);
   void     drawPixel(int16_t x, int16_t y, uint16_t color),
-           fillScreen(uint16_t color);
+           fillScreen(uint16_t color),
+           drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+           drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
+           writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+           writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
+           setRotation(uint8_t r);
   /**********************************************************************/
   /*!
     @brief    Get a pointer to the internal buffer memory
@@ -313,6 +405,8 @@ class GFXcanvas1 : public Adafruit_GFX {
   uint8_t *getBuffer(void) const { return buffer; }
  private:
   uint8_t *buffer;
+  int32_t  origin, stepX, stepY; ///< Bit of (0, 0), and bits between
+                                 ///< neighbours, at this rotation
 };
 
 
@@ -323,7 +417,11 @@ class GFXcanvas8 : public Adafruit_GFX {
   ~GFXcanvas8(void);
   void     drawPixel(int16_t x, int16_t y, uint16_t color),
            fillScreen(uint16_t color),
-           writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+           drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+           drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
+           writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+           writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
+           setRotation(uint8_t r);
   /**********************************************************************/
   /*!
    @brief    Get a pointer to the internal buffer memory
@@ -333,6 +431,8 @@ class GFXcanvas8 : public Adafruit_GFX {
   uint8_t *getBuffer(void) const { return buffer; }
  private:
   uint8_t *buffer;
+  int32_t  origin, stepX, stepY; ///< Index of (0, 0), and between
+                                 ///< neighbours, at this rotation
 };
 
 
@@ -343,7 +443,18 @@ class GFXcanvas16 : public Adafruit_GFX {
   ~GFXcanvas16(void);
   void      drawPixel(int16_t x, int16_t y, uint16_t color),
             fillScreen(uint16_t color),
-            byteSwap(void);
+            fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+              uint16_t color),
+            byteSwap(void),
+            drawCanvas(int16_t x, int16_t y, const GFXcanvas16 &src),
+            drawCanvas(int16_t x, int16_t y, const GFXcanvas16 &src,
+              uint16_t key),
+            blendCanvas(int16_t x, int16_t y, const GFXcanvas16 &src),
+            drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+            drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
+            writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+            writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
+            setRotation(uint8_t r);
   /**********************************************************************/
   /*!
     @brief    Get a pointer to the internal buffer memory
@@ -351,8 +462,17 @@ class GFXcanvas16 : public Adafruit_GFX {
   */
   /**********************************************************************/
   uint16_t *getBuffer(void) const { return buffer; }
+ protected:
+  bool      direct;  ///< Bulk drawing may skip drawPixel(); a subclass
+                     ///< that must see every pixel clears it
  private:
+  void      blit(int16_t x, int16_t y, const GFXcanvas16 &src, uint8_t mode,
+              uint16_t key);
+  uint16_t *pixel(int16_t x, int16_t y) const;
+
   uint16_t *buffer;
+  int32_t   origin, stepX, stepY; ///< Index of (0, 0), and between
+                                  ///< neighbours, at this rotation
 };
 
 #endif // _ADAFRUIT_GFX_H
@@ -32,6 +32,8 @@ POSSIBILITY OF SUCH DAMAGE.
  */
 
 #include "Adafruit_GFX.h"
+#include "Adafruit_GlyphCache.h"
+#include "Adafruit_Pixel565.h"
 #include "glcdfont.c"
 #ifdef __AVR__
   #include <avr/pgmspace.h>
@@ -94,6 +96,194 @@ inline uint8_t * pgm_read_bitmap_ptr(const GFXfont *gfxFont)
 #define _swap_int16_t(a, b) { int16_t t = a; a = b; b = t; }
 #endif
 
+#if !defined(GFX_CHAR_SPAN)
+ #define GFX_CHAR_SPAN 64 ///< Pixels of stack drawChar() may use per window write
+#endif
+#if !defined(GFX_GLYPH_RECTS)
+ #define GFX_GLYPH_RECTS 32 ///< Most rectangles drawChar() merges a glyph into
+#endif
+#if !defined(GFX_GLYPH_ROWS)
+ #define GFX_GLYPH_ROWS  32 ///< Tallest GFXfont glyph drawChar() merges
+#endif
+#if !defined(GFX_POLYGON_POINTS)
+ #define GFX_POLYGON_POINTS 16 ///< Most vertices fillPolygon() uses
+#endif
+
+/*!
+  @brief  Collects the horizontal spans of a filled shape, given one row at
+          a time moving up or down, and sends rows with the same span as a
+          single rectangle: one address window instead of one per row.
+*/
+class GFXspanRun {
+ public:
+  /// Start with nothing pending
+  GFXspanRun(Adafruit_GFX &gfx, uint16_t color) :
+    gfx(gfx), color(color), h(0) { }
+  /// Send whatever is pending
+  ~GFXspanRun(void) { flush(); }
+  /*!
+    @brief  Add rows y thru y+rows-1 spanning x0 thru x1
+    @param  x0    Left-most x coordinate
+    @param  x1    Right-most x coordinate, nothing is added if it's less
+                  than x0
+    @param  y     Top row
+    @param  rows  Number of rows, positive
+  */
+  void add(int16_t x0, int16_t x1, int16_t y, int16_t rows) {
+    if(x1 < x0) return;
+    if(h && (x0 == left) && (x1 == right)) {
+      if(y == top + h) { h += rows; return; }
+      if(y + rows == top) { top = y; h += rows; return; }
+    }
+    flush();
+    left  = x0;
+    right = x1;
+    top   = y;
+    h     = rows;
+  }
+  /// Send the pending rectangle, a single row as a line as the base
+  /// class fills rectangles a column at a time
+  void flush(void) {
+    if(h == 1) gfx.writeFastHLine(left, top, right - left + 1, color);
+    else if(h) gfx.writeFillRect(left, top, right - left + 1, h, color);
+    h = 0;
+  }
+
+ private:
+  Adafruit_GFX &gfx;
+  uint16_t color;
+  int16_t  left, right, top, h;
+};
+
+/**************************************************************************/
+/*!
+   @brief   Fill a circle stretched into a rounded rectangle, a row at a
+            time, so rows of equal width are filled together
+    @param  x0     Center-point x coordinate of the left corners
+    @param  y0     Center-point y coordinate of the top corners
+    @param  x1     Center-point x coordinate of the right corners, x0 for
+                   a circle, x0-1 at the least
+    @param  y1     Center-point y coordinate of the bottom corners, y0 for
+                   a circle, y0-1 at the least
+    @param  r      Corner radius
+    @param  color  16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+static void fillRounded(Adafruit_GFX &gfx, int16_t x0, int16_t y0,
+  int16_t x1, int16_t y1, int16_t r, uint16_t color) {
+    // Same points as the quarter columns fillCircleHelper() draws. Those
+    // are symmetric about the diagonal, so a column's half-height in that
+    // loop is also the half-width of the row as far from the center.
+    // Rows near the middle come in order moving out, the others moving
+    // in, each kept separate so runs of equal rows can join up.
+    GFXspanRun inTop(gfx, color), inBottom(gfx, color),
+               outTop(gfx, color), outBottom(gfx, color);
+    int16_t f     = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x     = 0;
+    int16_t y     = r;
+    int16_t px    = x;
+    int16_t py    = y;
+
+    if(y1 >= y0) inTop.add(x0-r, x1+r, y0, y1-y0+1);
+    while(x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f     += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f     += ddF_x;
+        if(x < (y + 1)) {
+            inTop.add(x0-y, x1+y, y0-x, 1);
+            inBottom.add(x0-y, x1+y, y1+x, 1);
+        }
+        if(y != py) {
+            outTop.add(x0-px, x1+px, y0-py, 1);
+            outBottom.add(x0-px, x1+px, y1+py, 1);
+            py = y;
+        }
+        px = x;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief   Turn a classic font character, stored a column per byte, into
+            8 rows of 5 bits
+    @param  c     Index of the character in the font
+    @param  rows  The rows, bit i is column i
+*/
+/**************************************************************************/
+static void classicRows(uint8_t c, uint32_t *rows) {
+    for(int8_t j=0; j<8; j++) rows[j] = 0;
+    for(int8_t i=0; i<5; i++) { // Char bitmap = 5 columns
+        uint8_t line = pgm_read_byte(&font[c * 5 + i]);
+        for(int8_t j=0; j<8; j++, line >>= 1) {
+            if(line & 1) rows[j] |= 1 << i;
+        }
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief   Turn a glyph's lit pixels into rectangles: each horizontal run
+            of a row, grown downward while the rows below have the exact
+            same run
+    @param  rows   Glyph rows, bit i is column i, at most 32 wide
+    @param  h      Number of rows
+    @param  xo     Column 0 offset from the character origin
+    @param  yo     Row 0 offset from the character origin
+    @param  out    Rectangles, in font pixels from the character origin
+    @returns Number of rectangles, or -1 if there are more than
+             GFX_GLYPH_RECTS
+*/
+/**************************************************************************/
+static int8_t glyphRects(const uint32_t *rows, uint8_t h, int8_t xo,
+  int8_t yo, GFXglyphRect *out) {
+    uint32_t open[16];  // A 32 bit row has at most 16 runs
+    uint8_t  top[16], numOpen = 0, n = 0;
+    for(uint8_t j=0; j<=h; j++) {
+        uint32_t m = (j < h) ? rows[j] : 0, runs[16];
+        uint8_t  numRuns = 0;
+        while(m) { // Split the row into runs of set bits
+            uint32_t bit = m & -m, run = bit; // Lowest set bit...
+            while(m & (bit << 1)) run |= (bit <<= 1); // ...and up
+            runs[numRuns++] = run;
+            m &= ~run;
+        }
+        uint8_t keep = 0;
+        for(uint8_t o=0; o<numOpen; o++) {
+            int8_t r = numRuns - 1;
+            while((r >= 0) && (runs[r] != open[o])) r--;
+            if(r >= 0) { // Continues into this row
+                runs[r]     = 0;
+                open[keep]  = open[o];
+                top[keep++] = top[o];
+            } else {     // Ends above this row
+                if(n == GFX_GLYPH_RECTS) return -1;
+                uint8_t i0 = 0, w = 0;
+                while(!(open[o] & (1UL << i0))) i0++;
+                while((i0 + w < 32) && (open[o] & (1UL << (i0 + w)))) w++;
+                out[n].x   = xo + i0;
+                out[n].y   = yo + top[o];
+                out[n].w   = w;
+                out[n++].h = j - top[o];
+            }
+        }
+        numOpen = keep;
+        for(uint8_t r=0; r<numRuns; r++) {
+            if(runs[r]) {
+                open[numOpen]  = runs[r];
+                top[numOpen++] = j;
+            }
+        }
+    }
+    return n;
+}
+
 /**************************************************************************/
 /*!
    @brief    Instatiate a GFX context for graphics! Can only be done by a superclass
@@ -113,11 +303,18 @@ WIDTH(w), HEIGHT(h)
     wrap      = true;
     _cp437    = false;
     gfxFont   = NULL;
+    runFont   = NULL;
+    glyphCache = NULL;
+#if defined(SPITFT_TRACE)
+    tracePrim = GFX_TRACE_OTHER;
+#endif
 }
 
 /**************************************************************************/
 /*!
-   @brief    Write a line.  Bresenham's algorithm - thx wikpedia
+   @brief    Write a line.  Bresenham's algorithm - thx wikpedia - taken
+             a run at a time: each stretch of pixels on one row (or column,
+             if steep) goes out as a single fast line.
     @param    x0  Start point x coordinate
     @param    y0  Start point y coordinate
     @param    x1  End point x coordinate
@@ -154,17 +351,38 @@ void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
         ystep = -1;
     }
 
-    for (; x0<=x1; x0++) {
-        if (steep) {
-            writePixel(y0, x0, color);
-        } else {
-            writePixel(x0, y0, color);
+    if (!dy) {
+        // Horizontal or vertical. Pixel by pixel, as the base class fast
+        // lines come back here.
+        for (; x0<=x1; x0++) {
+            if (steep) {
+                writePixel(y0, x0, color);
+            } else {
+                writePixel(x0, y0, color);
+            }
         }
-        err -= dy;
-        if (err < 0) {
-            y0 += ystep;
-            err += dx;
+        return;
+    }
+
+    while (x0 <= x1) {
+        // Pixel by pixel, err would drop by dy each step and y move on
+        // once it went negative, which is err / dy + 1 pixels from here
+        int16_t run = err / dy + 1;
+        if (run > x1 - x0 + 1) run = x1 - x0 + 1;
+        if (run == 1) {
+            if (steep) {
+                writePixel(y0, x0, color);
+            } else {
+                writePixel(x0, y0, color);
+            }
+        } else if (steep) {
+            writeFastVLine(y0, x0, run, color);
+        } else {
+            writeFastHLine(x0, y0, run, color);
         }
+        x0  += run;
+        err += dx - (int32_t)run * dy;
+        y0  += ystep;
     }
 }
 
@@ -246,6 +464,47 @@ void Adafruit_GFX::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
 void Adafruit_GFX::endWrite(){
 }
 
+/**************************************************************************/
+/*!
+   @brief    Start sending a rectangle of pixels row by row with
+             writeWindowPixels(), overwrite in subclasses that can. The
+             rectangle is entirely on screen.
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    w   Width in pixels
+    @param    h   Height in pixels
+    @returns  false, meaning not supported, draw some other way
+*/
+/**************************************************************************/
+bool Adafruit_GFX::writeWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+    (void)x; (void)y; (void)w; (void)h;
+    return false;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Send pixels to the rectangle set up by writeWindow(), overwrite
+             in subclasses along with writeWindow()
+    @param    colors  16-bit 5-6-5 pixel colors, free for reuse on return
+    @param    len     Number of pixels
+*/
+/**************************************************************************/
+void Adafruit_GFX::writeWindowPixels(uint16_t *colors, uint32_t len) {
+    (void)colors; (void)len;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Send pixels all the same color to the rectangle set up by
+             writeWindow(), overwrite in subclasses along with writeWindow()
+    @param    color   16-bit 5-6-5 Color to send
+    @param    len     Number of pixels
+*/
+/**************************************************************************/
+void Adafruit_GFX::writeWindowColor(uint16_t color, uint32_t len) {
+    (void)color; (void)len;
+}
+
 /**************************************************************************/
 /*!
    @brief    Draw a perfectly vertical line (this is often optimized in a subclass!)
@@ -257,6 +516,7 @@ void Adafruit_GFX::endWrite(){
 /**************************************************************************/
 void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y,
         int16_t h, uint16_t color) {
+    GFX_TRACE(GFX_TRACE_VLINE);
     startWrite();
     writeLine(x, y, x, y+h-1, color);
     endWrite();
@@ -273,6 +533,7 @@ void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y,
 /**************************************************************************/
 void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y,
         int16_t w, uint16_t color) {
+    GFX_TRACE(GFX_TRACE_HLINE);
     startWrite();
     writeLine(x, y, x+w-1, y, color);
     endWrite();
@@ -290,6 +551,7 @@ void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y,
 /**************************************************************************/
 void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
         uint16_t color) {
+    GFX_TRACE(GFX_TRACE_FILLRECT);
     startWrite();
     for (int16_t i=x; i<x+w; i++) {
         writeFastVLine(i, y, h, color);
@@ -304,6 +566,7 @@ void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
 */
 /**************************************************************************/
 void Adafruit_GFX::fillScreen(uint16_t color) {
+    GFX_TRACE(GFX_TRACE_FILLSCREEN);
     fillRect(0, 0, _width, _height, color);
 }
 
@@ -319,6 +582,7 @@ void Adafruit_GFX::fillScreen(uint16_t color) {
 /**************************************************************************/
 void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
         uint16_t color) {
+    GFX_TRACE(GFX_TRACE_LINE);
     // Update in subclasses if desired!
     if(x0 == x1){
         if(y0 > y1) _swap_int16_t(y0, y1);
@@ -344,6 +608,7 @@ void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
 /**************************************************************************/
 void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r,
         uint16_t color) {
+    GFX_TRACE(GFX_TRACE_CIRCLE);
 #if defined(ESP8266)
     yield();
 #endif
@@ -438,9 +703,9 @@ void Adafruit_GFX::drawCircleHelper( int16_t x0, int16_t y0,
 /**************************************************************************/
 void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r,
         uint16_t color) {
+    GFX_TRACE(GFX_TRACE_FILLCIRCLE);
     startWrite();
-    writeFastVLine(x0, y0-r, 2*r+1, color);
-    fillCircleHelper(x0, y0, r, 3, 0, color);
+    fillRounded(*this, x0, y0, x0, y0, r, color);
     endWrite();
 }
 
@@ -505,6 +770,7 @@ void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
 /**************************************************************************/
 void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
         uint16_t color) {
+    GFX_TRACE(GFX_TRACE_RECT);
     startWrite();
     writeFastHLine(x, y, w, color);
     writeFastHLine(x, y+h-1, w, color);
@@ -526,6 +792,7 @@ void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
 /**************************************************************************/
 void Adafruit_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w,
   int16_t h, int16_t r, uint16_t color) {
+    GFX_TRACE(GFX_TRACE_ROUNDRECT);
     int16_t max_radius = ((w < h) ? w : h) / 2; // 1/2 minor axis
     if(r > max_radius) r = max_radius;
     // smarter version
@@ -555,14 +822,12 @@ void Adafruit_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w,
 /**************************************************************************/
 void Adafruit_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w,
   int16_t h, int16_t r, uint16_t color) {
+    GFX_TRACE(GFX_TRACE_FILLROUNDRECT);
     int16_t max_radius = ((w < h) ? w : h) / 2; // 1/2 minor axis
     if(r > max_radius) r = max_radius;
     // smarter version
     startWrite();
-    writeFillRect(x+r, y, w-2*r, h, color);
-    // draw four corners
-    fillCircleHelper(x+w-r-1, y+r, r, 1, h-2*r-1, color);
-    fillCircleHelper(x+r    , y+r, r, 2, h-2*r-1, color);
+    fillRounded(*this, x+r, y+r, x+w-r-1, y+h-r-1, r, color);
     endWrite();
 }
 
@@ -580,6 +845,7 @@ void Adafruit_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w,
 /**************************************************************************/
 void Adafruit_GFX::drawTriangle(int16_t x0, int16_t y0,
         int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    GFX_TRACE(GFX_TRACE_TRIANGLE);
     drawLine(x0, y0, x1, y1, color);
     drawLine(x1, y1, x2, y2, color);
     drawLine(x2, y2, x0, y0, color);
@@ -599,8 +865,10 @@ void Adafruit_GFX::drawTriangle(int16_t x0, int16_t y0,
 /**************************************************************************/
 void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0,
         int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    GFX_TRACE(GFX_TRACE_FILLTRIANGLE);
 
     int16_t a, b, y, last;
+    GFXspanRun run(*this, color);
 
     // Sort coordinates by Y order (y2 >= y1 >= y0)
     if (y0 > y1) {
@@ -655,7 +923,7 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0,
         b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
         */
         if(a > b) _swap_int16_t(a,b);
-        writeFastHLine(a, y, b-a+1, color);
+        run.add(a, b, y, 1);
     }
 
     // For lower part of triangle, find scanline crossings for segments
@@ -672,8 +940,67 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0,
         b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
         */
         if(a > b) _swap_int16_t(a,b);
-        writeFastHLine(a, y, b-a+1, color);
+        run.add(a, b, y, 1);
     }
+    run.flush();
+    endWrite();
+}
+
+/**************************************************************************/
+/*!
+   @brief     Draw a polygon with color-fill. Inside is by the even-odd
+              rule, so the polygon may be concave or cross itself.
+    @param    x  Vertex x coordinates
+    @param    y  Vertex y coordinates
+    @param    n  Number of vertices, only the first GFX_POLYGON_POINTS are
+                 used
+    @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void Adafruit_GFX::fillPolygon(const int16_t *x, const int16_t *y,
+  uint8_t n, uint16_t color) {
+    GFX_TRACE(GFX_TRACE_FILLPOLYGON);
+    if(n > GFX_POLYGON_POINTS) n = GFX_POLYGON_POINTS;
+    if(!n) return;
+
+    int16_t top = y[0], bottom = y[0];
+    for(uint8_t i=1; i<n; i++) {
+        if(y[i] < top)    top    = y[i];
+        if(y[i] > bottom) bottom = y[i];
+    }
+
+    // Spans are kept apart by their order along the row, so each of the
+    // first few can join the same one in the rows before
+    GFXspanRun run0(*this, color), run1(*this, color),
+               run2(*this, color), run3(*this, color);
+    GFXspanRun *runs[] = { &run0, &run1, &run2, &run3 };
+    int16_t    cross[GFX_POLYGON_POINTS];
+
+    startWrite();
+    for(int16_t row=top; row<=bottom; row++) {
+        uint8_t count = 0;
+        for(uint8_t i=0, j=n-1; i<n; j=i++) {
+            int16_t xa = x[i], ya = y[i], xb = x[j], yb = y[j];
+            if(ya == yb) continue;
+            if(ya > yb) {
+                _swap_int16_t(xa, xb); _swap_int16_t(ya, yb);
+            }
+            // An edge crosses its top row but not its bottom one, so a
+            // vertex between two edges counts once. The bottom row of
+            // the polygon takes the edges that end there instead.
+            if((row < ya) || (row > yb)) continue;
+            if((row == yb) != (row == bottom)) continue;
+            int16_t c = xa + (int32_t)(xb - xa) * (row - ya) / (yb - ya);
+            uint8_t k = count++;
+            for(; (k > 0) && (cross[k-1] > c); k--) cross[k] = cross[k-1];
+            cross[k] = c;
+        }
+        for(uint8_t k=0; k+1<count; k+=2) {
+            if(k/2 < 4) runs[k/2]->add(cross[k], cross[k+1], row, 1);
+            else writeFastHLine(cross[k], row, cross[k+1]-cross[k]+1, color);
+        }
+    }
+    for(uint8_t k=0; k<4; k++) runs[k]->flush();
     endWrite();
 }
 
@@ -692,6 +1019,7 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0,
 /**************************************************************************/
 void Adafruit_GFX::drawBitmap(int16_t x, int16_t y,
   const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) {
+    GFX_TRACE(GFX_TRACE_BITMAP);
 
     int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
     uint8_t byte = 0;
@@ -722,6 +1050,7 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y,
 void Adafruit_GFX::drawBitmap(int16_t x, int16_t y,
   const uint8_t bitmap[], int16_t w, int16_t h,
   uint16_t color, uint16_t bg) {
+    GFX_TRACE(GFX_TRACE_BITMAP);
 
     int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
     uint8_t byte = 0;
@@ -750,6 +1079,7 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y,
 /**************************************************************************/
 void Adafruit_GFX::drawBitmap(int16_t x, int16_t y,
   uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) {
+    GFX_TRACE(GFX_TRACE_BITMAP);
 
     int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
     uint8_t byte = 0;
@@ -779,6 +1109,7 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y,
 /**************************************************************************/
 void Adafruit_GFX::drawBitmap(int16_t x, int16_t y,
   uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+    GFX_TRACE(GFX_TRACE_BITMAP);
 
     int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
     uint8_t byte = 0;
@@ -811,6 +1142,7 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y,
 /**************************************************************************/
 void Adafruit_GFX::drawXBitmap(int16_t x, int16_t y,
   const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) {
+    GFX_TRACE(GFX_TRACE_BITMAP);
 
     int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
     uint8_t byte = 0;
@@ -842,6 +1174,7 @@ void Adafruit_GFX::drawXBitmap(int16_t x, int16_t y,
 /**************************************************************************/
 void Adafruit_GFX::drawGrayscaleBitmap(int16_t x, int16_t y,
   const uint8_t bitmap[], int16_t w, int16_t h) {
+    GFX_TRACE(GFX_TRACE_BITMAP);
     startWrite();
     for(int16_t j=0; j<h; j++, y++) {
         for(int16_t i=0; i<w; i++ ) {
@@ -864,6 +1197,7 @@ void Adafruit_GFX::drawGrayscaleBitmap(int16_t x, int16_t y,
 /**************************************************************************/
 void Adafruit_GFX::drawGrayscaleBitmap(int16_t x, int16_t y,
   uint8_t *bitmap, int16_t w, int16_t h) {
+    GFX_TRACE(GFX_TRACE_BITMAP);
     startWrite();
     for(int16_t j=0; j<h; j++, y++) {
         for(int16_t i=0; i<w; i++ ) {
@@ -891,6 +1225,7 @@ void Adafruit_GFX::drawGrayscaleBitmap(int16_t x, int16_t y,
 void Adafruit_GFX::drawGrayscaleBitmap(int16_t x, int16_t y,
   const uint8_t bitmap[], const uint8_t mask[],
   int16_t w, int16_t h) {
+    GFX_TRACE(GFX_TRACE_BITMAP);
     int16_t bw   = (w + 7) / 8; // Bitmask scanline pad = whole byte
     uint8_t byte = 0;
     startWrite();
@@ -922,6 +1257,7 @@ void Adafruit_GFX::drawGrayscaleBitmap(int16_t x, int16_t y,
 /**************************************************************************/
 void Adafruit_GFX::drawGrayscaleBitmap(int16_t x, int16_t y,
   uint8_t *bitmap, uint8_t *mask, int16_t w, int16_t h) {
+    GFX_TRACE(GFX_TRACE_BITMAP);
     int16_t bw   = (w + 7) / 8; // Bitmask scanline pad = whole byte
     uint8_t byte = 0;
     startWrite();
@@ -951,6 +1287,7 @@ void Adafruit_GFX::drawGrayscaleBitmap(int16_t x, int16_t y,
 /**************************************************************************/
 void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y,
   const uint16_t bitmap[], int16_t w, int16_t h) {
+    GFX_TRACE(GFX_TRACE_RGBBITMAP);
     startWrite();
     for(int16_t j=0; j<h; j++, y++) {
         for(int16_t i=0; i<w; i++ ) {
@@ -973,6 +1310,7 @@ void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y,
 /**************************************************************************/
 void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y,
   uint16_t *bitmap, int16_t w, int16_t h) {
+    GFX_TRACE(GFX_TRACE_RGBBITMAP);
     startWrite();
     for(int16_t j=0; j<h; j++, y++) {
         for(int16_t i=0; i<w; i++ ) {
@@ -997,6 +1335,7 @@ void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y,
 void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y,
   const uint16_t bitmap[], const uint8_t mask[],
   int16_t w, int16_t h) {
+    GFX_TRACE(GFX_TRACE_RGBBITMAP);
     int16_t bw   = (w + 7) / 8; // Bitmask scanline pad = whole byte
     uint8_t byte = 0;
     startWrite();
@@ -1025,6 +1364,7 @@ void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y,
 /**************************************************************************/
 void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y,
   uint16_t *bitmap, uint8_t *mask, int16_t w, int16_t h) {
+    GFX_TRACE(GFX_TRACE_RGBBITMAP);
     int16_t bw   = (w + 7) / 8; // Bitmask scanline pad = whole byte
     uint8_t byte = 0;
     startWrite();
@@ -1056,6 +1396,7 @@ void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y,
 /**************************************************************************/
 void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
   uint16_t color, uint16_t bg, uint8_t size) {
+    GFX_TRACE(GFX_TRACE_CHAR);
     drawChar(x, y, c, color, bg, size, size);
 }
 
@@ -1074,6 +1415,7 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
 /**************************************************************************/
 void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
   uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y) {
+    GFX_TRACE(GFX_TRACE_CHAR);
 
     if(!gfxFont) { // 'Classic' built-in font
 
@@ -1085,26 +1427,48 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
 
         if(!_cp437 && (c >= 176)) c++; // Handle 'classic' charset behavior
 
+        int16_t cw = 6 * size_x, ch = 8 * size_y; // Whole cell, scaled
+        bool    visible = (x >= 0) && (y >= 0) &&
+                          (x + cw <= _width) && (y + ch <= _height);
+        uint32_t rows[8];
+
         startWrite();
-        for(int8_t i=0; i<5; i++ ) { // Char bitmap = 5 columns
-            uint8_t line = pgm_read_byte(&font[c * 5 + i]);
-            for(int8_t j=0; j<8; j++, line >>= 1) {
-                if(line & 1) {
-                    if(size_x == 1 && size_y == 1)
-                        writePixel(x+i, y+j, color);
-                    else
-                        writeFillRect(x+i*size_x, y+j*size_y, size_x, size_y, color);
-                } else if(bg != color) {
-                    if(size_x == 1 && size_y == 1)
-                        writePixel(x+i, y+j, bg);
-                    else
-                        writeFillRect(x+i*size_x, y+j*size_y, size_x, size_y, bg);
+        if((bg != color) && visible && (cw <= GFX_CHAR_SPAN) &&
+           writeWindow(x, y, cw, ch)) {
+            // Opaque and the display takes pixel blocks: one window for the
+            // whole cell, sent a scaled font row (repeated size_y times if
+            // that fits) at a time
+            uint16_t span[GFX_CHAR_SPAN];
+            uint8_t  reps = min(size_y, GFX_CHAR_SPAN / cw);
+            classicRows(c, rows);
+            for(int8_t j=0; j<8; j++) {
+                uint16_t *p = span;
+                for(int8_t i=0; i<6; i++) {
+                    uint16_t c16 = (rows[j] & (1 << i)) ? color : bg;
+                    for(uint8_t k=0; k<size_x; k++) *p++ = c16;
+                }
+                for(uint8_t r=1; r<reps; r++) memcpy(&span[r * cw], span, cw * 2);
+                for(uint8_t r=0; r<size_y; r+=reps) {
+                    writeWindowPixels(span, (uint32_t)cw * min(reps, size_y - r));
                 }
             }
-        }
-        if(bg != color) { // If opaque, draw vertical line for last column
-            if(size_x == 1 && size_y == 1) writeFastVLine(x+5, y, 8, bg);
-            else          writeFillRect(x+5*size_x, y, size_x, 8*size_y, bg);
+        } else {
+            if(bg != color) writeFillRect(x, y, cw, ch, bg); // Opaque cell
+            // Lit pixels as rectangles, at most 3 a row
+            GFXglyphRect rects[GFX_GLYPH_RECTS];
+            const GFXglyphRect *r = NULL;
+            uint8_t n;
+            if(glyphCache) r = glyphCache->find(NULL, c, &n);
+            if(!r) {
+                classicRows(c, rows);
+                n = glyphRects(rows, 8, 0, 0, rects);
+                if(glyphCache) glyphCache->add(NULL, c, rects, n);
+                r = rects;
+            }
+            for(uint8_t i=0; i<n; i++) {
+                writeFillRect(x + r[i].x * size_x, y + r[i].y * size_y,
+                  r[i].w * size_x, r[i].h * size_y, color);
+            }
         }
         endWrite();
 
@@ -1115,20 +1479,27 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
         // drawChar() directly with 'bad' characters of font may cause mayhem!
 
         c -= (uint8_t)pgm_read_byte(&gfxFont->first);
-        GFXglyph *glyph  = pgm_read_glyph_ptr(gfxFont, c);
-        uint8_t  *bitmap = pgm_read_bitmap_ptr(gfxFont);
-
-        uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
-        uint8_t  w  = pgm_read_byte(&glyph->width),
-                 h  = pgm_read_byte(&glyph->height);
-        int8_t   xo = pgm_read_byte(&glyph->xOffset),
-                 yo = pgm_read_byte(&glyph->yOffset);
-        uint8_t  xx, yy, bits = 0, bit = 0;
-        int16_t  xo16 = 0, yo16 = 0;
-
-        if(size_x > 1 || size_y > 1) {
-            xo16 = xo;
-            yo16 = yo;
+
+        if(runFont) { // Baked: a line per run, no bitmap to unpack
+            const GFXrunGlyph *glyph = &((const GFXrunGlyph *)
+              pgm_read_pointer(&runFont->glyph))[c];
+            const GFXglyphRun *run = &((const GFXglyphRun *)
+              pgm_read_pointer(&runFont->run))[pgm_read_word(&glyph->runOffset)];
+            uint8_t n = pgm_read_byte(&glyph->runCount);
+            startWrite();
+            for(; n--; run++) {
+                int8_t  rx = pgm_read_byte(&run->x),
+                        ry = pgm_read_byte(&run->y);
+                uint8_t rw = pgm_read_byte(&run->w);
+                if(size_x == 1 && size_y == 1) {
+                    writeFastHLine(x + rx, y + ry, rw, color);
+                } else {
+                    writeFillRect(x + rx * size_x, y + ry * size_y,
+                      rw * size_x, size_y, color);
+                }
+            }
+            endWrite();
+            return;
         }
 
         // Todo: Add character clipping here
@@ -1149,22 +1520,76 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
         // displays supporting setAddrWindow() and pushColors()), but haven't
         // implemented this yet.
 
-        startWrite();
-        for(yy=0; yy<h; yy++) {
-            for(xx=0; xx<w; xx++) {
-                if(!(bit++ & 7)) {
-                    bits = pgm_read_byte(&bitmap[bo++]);
+        GFXglyphRect rects[GFX_GLYPH_RECTS];
+        const GFXglyphRect *r = NULL;
+        uint8_t n;
+        if(glyphCache) r = glyphCache->find(gfxFont, c, &n);
+
+        if(!r) {
+            GFXglyph *glyph  = pgm_read_glyph_ptr(gfxFont, c);
+            uint8_t  *bitmap = pgm_read_bitmap_ptr(gfxFont);
+
+            uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
+            uint8_t  w  = pgm_read_byte(&glyph->width),
+                     h  = pgm_read_byte(&glyph->height);
+            int8_t   xo = pgm_read_byte(&glyph->xOffset),
+                     yo = pgm_read_byte(&glyph->yOffset);
+            uint8_t  xx, yy, bits = 0, bit = 0;
+
+            int8_t k = -1;
+            if((w <= 32) && (h <= GFX_GLYPH_ROWS)) {
+                // Unpack to rows, bit xx is column xx, then merge those
+                uint32_t rows[GFX_GLYPH_ROWS];
+                uint16_t b = bo;
+                for(yy=0; yy<h; yy++) {
+                    rows[yy] = 0;
+                    for(xx=0; xx<w; xx++) {
+                        if(!(bit++ & 7)) {
+                            bits = pgm_read_byte(&bitmap[b++]);
+                        }
+                        if(bits & 0x80) rows[yy] |= 1UL << xx;
+                        bits <<= 1;
+                    }
+                }
+                k = glyphRects(rows, h, xo, yo, rects);
+            }
+
+            if(k < 0) { // Too big or too ragged to merge, a pixel at a time
+                int16_t xo16 = 0, yo16 = 0;
+                if(size_x > 1 || size_y > 1) {
+                    xo16 = xo;
+                    yo16 = yo;
                 }
-                if(bits & 0x80) {
-                    if(size_x == 1 && size_y == 1) {
-                        writePixel(x+xo+xx, y+yo+yy, color);
-                    } else {
-                        writeFillRect(x+(xo16+xx)*size_x, y+(yo16+yy)*size_y,
-                          size_x, size_y, color);
+                bit = 0;
+                startWrite();
+                for(yy=0; yy<h; yy++) {
+                    for(xx=0; xx<w; xx++) {
+                        if(!(bit++ & 7)) {
+                            bits = pgm_read_byte(&bitmap[bo++]);
+                        }
+                        if(bits & 0x80) {
+                            if(size_x == 1 && size_y == 1) {
+                                writePixel(x+xo+xx, y+yo+yy, color);
+                            } else {
+                                writeFillRect(x+(xo16+xx)*size_x,
+                                  y+(yo16+yy)*size_y, size_x, size_y, color);
+                            }
+                        }
+                        bits <<= 1;
                     }
                 }
-                bits <<= 1;
+                endWrite();
+                return;
             }
+            n = k;
+            if(glyphCache) glyphCache->add(gfxFont, c, rects, n);
+            r = rects;
+        }
+
+        startWrite();
+        for(uint8_t i=0; i<n; i++) {
+            writeFillRect(x + r[i].x * size_x, y + r[i].y * size_y,
+              r[i].w * size_x, r[i].h * size_y, color);
         }
         endWrite();
 
@@ -1283,6 +1708,25 @@ void Adafruit_GFX::setFont(const GFXfont *f) {
         cursor_y -= 6;
     }
     gfxFont = (GFXfont *)f;
+    runFont = NULL;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Set the font to display when print()ing, a GFXfont baked with
+            GFX_BAKE_FONT(). It draws the same pixels as the GFXfont, a run
+            at a time, and wraps in the same places. getTextBounds()
+            measures differently, though: it returns the box of the pixels
+            the text lights, which can be smaller than the glyph boxes it
+            returns after setFont() with the same font, so text erased or
+            centered by its bounds is erased less or centered a little
+            differently.
+    @param  f  The GFXrunFont object, if NULL use built in 6x8 font
+*/
+/**************************************************************************/
+void Adafruit_GFX::setRunFont(const GFXrunFont *f) {
+    setFont(f ? (const GFXfont *)pgm_read_pointer(&f->font) : NULL);
+    runFont = f;
 }
 
 
@@ -1311,13 +1755,27 @@ void Adafruit_GFX::charBounds(char c, int16_t *x, int16_t *y,
             uint8_t first = pgm_read_byte(&gfxFont->first),
                     last  = pgm_read_byte(&gfxFont->last);
             if((c >= first) && (c <= last)) { // Char present in this font?
-                GFXglyph *glyph = pgm_read_glyph_ptr(gfxFont, c - first);
-                uint8_t gw = pgm_read_byte(&glyph->width),
-                        gh = pgm_read_byte(&glyph->height),
-                        xa = pgm_read_byte(&glyph->xAdvance);
-                int8_t  xo = pgm_read_byte(&glyph->xOffset),
-                        yo = pgm_read_byte(&glyph->yOffset);
-                if(wrap && ((*x+(((int16_t)xo+gw)*textsize_x)) > _width)) {
+                uint8_t gw, gh, xa;
+                int8_t  xo, yo, right;
+                if(runFont) { // Baked: just the lit pixels
+                    const GFXrunGlyph *glyph = &((const GFXrunGlyph *)
+                      pgm_read_pointer(&runFont->glyph))[c - first];
+                    gw = pgm_read_byte(&glyph->w);
+                    gh = pgm_read_byte(&glyph->h);
+                    xa = pgm_read_byte(&glyph->xAdvance);
+                    xo = pgm_read_byte(&glyph->x1);
+                    yo = pgm_read_byte(&glyph->y1);
+                    right = pgm_read_byte(&glyph->right);
+                } else {
+                    GFXglyph *glyph = pgm_read_glyph_ptr(gfxFont, c - first);
+                    gw = pgm_read_byte(&glyph->width);
+                    gh = pgm_read_byte(&glyph->height);
+                    xa = pgm_read_byte(&glyph->xAdvance);
+                    xo = pgm_read_byte(&glyph->xOffset);
+                    yo = pgm_read_byte(&glyph->yOffset);
+                    right = xo + gw;
+                }
+                if(wrap && ((*x+((int16_t)right*textsize_x)) > _width)) {
                     *x  = 0; // Reset x to zero, advance y by one line
                     *y += textsize_y * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
                 }
@@ -1327,10 +1785,12 @@ void Adafruit_GFX::charBounds(char c, int16_t *x, int16_t *y,
                         y1 = *y + yo * tsy,
                         x2 = x1 + gw * tsx - 1,
                         y2 = y1 + gh * tsy - 1;
-                if(x1 < *minx) *minx = x1;
-                if(y1 < *miny) *miny = y1;
-                if(x2 > *maxx) *maxx = x2;
-                if(y2 > *maxy) *maxy = y2;
+                if(gw || !runFont) { // Baked blank glyphs light nothing
+                    if(x1 < *minx) *minx = x1;
+                    if(y1 < *miny) *miny = y1;
+                    if(x2 > *maxx) *maxx = x2;
+                    if(y2 > *maxy) *maxy = y2;
+                }
                 *x += xa * tsx;
             }
         }
@@ -1656,6 +2116,86 @@ boolean Adafruit_GFX_Button::justReleased() { return (!currstate && laststate);
 // scanline pad).
 // NOT EXTENSIVELY TESTED YET.  MAY CONTAIN WORST BUGS KNOWN TO HUMANKIND.
 
+/**************************************************************************/
+/*!
+   @brief   Find where a canvas's pixels are stored at a rotation. Pixel
+            (x, y) is at origin + x * stepX + y * stepY, so drawing needn't
+            look at the rotation, and a line is one step repeated.
+    @param  r       Rotation, 0 to 3
+    @param  w       Canvas width, unrotated
+    @param  h       Canvas height, unrotated
+    @param  pitch   Units (pixels or bits) from one row to the next
+    @param  origin  Set to where (0, 0) is
+    @param  stepX   Set to the units from (x, y) to (x + 1, y)
+    @param  stepY   Set to the units from (x, y) to (x, y + 1)
+*/
+/**************************************************************************/
+static void canvasSteps(uint8_t r, int32_t w, int32_t h, int32_t pitch,
+  int32_t *origin, int32_t *stepX, int32_t *stepY) {
+    switch(r) {
+        case 0:  *origin = 0;                       *stepX = 1;      *stepY = pitch;  break;
+        case 1:  *origin = w - 1;                   *stepX = pitch;  *stepY = -1;     break;
+        case 2:  *origin = (h - 1) * pitch + w - 1; *stepX = -1;     *stepY = -pitch; break;
+        default: *origin = (h - 1) * pitch;         *stepX = -pitch; *stepY = 1;      break;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief   Clip a line's start and length to a canvas edge
+    @param  pos    Start, moved to the top or left end
+    @param  len    Length, negative to go up or left, made positive
+    @param  limit  Canvas width or height
+    @returns False if none of it is on the canvas
+*/
+/**************************************************************************/
+static bool clipSpan(int16_t *pos, int16_t *len, int16_t limit) {
+    if(*len < 0) {       // Negative length goes up or left
+        *pos += *len + 1;
+        *len  = -*len;
+    }
+    int32_t a = *pos, b = (int32_t)*pos + *len;
+    if(a < 0)     a = 0;
+    if(b > limit) b = limit;
+    if(a >= b) return false;
+    *pos = a;
+    *len = b - a;
+    return true;
+}
+
+/**************************************************************************/
+/*!
+   @brief   Set or clear a run of bits, most significant bit first, a
+            whole byte at a time in the middle
+    @param  buffer  Bits
+    @param  first   First bit of the run
+    @param  n       Number of bits
+    @param  set     True to set them, false to clear them
+*/
+/**************************************************************************/
+static void fillBits(uint8_t *buffer, int32_t first, int32_t n, bool set) {
+    uint8_t *p    = &buffer[first >> 3];
+    uint8_t  lead = first & 7, mask;
+    if(lead) {                          // Part of the first byte
+        mask = 0xFF >> lead;
+        if(n < 8 - lead) mask &= ~(0xFF >> (lead + n));
+        if(set) *p |= mask;
+        else    *p &= ~mask;
+        p++;
+        n -= 8 - lead;
+    }
+    if(n >= 8) {
+        memset(p, set ? 0xFF : 0x00, n >> 3);
+        p += n >> 3;
+        n &= 7;
+    }
+    if(n > 0) {                         // Part of the last byte
+        mask = ~(0xFF >> n);
+        if(set) *p |= mask;
+        else    *p &= ~mask;
+    }
+}
+
 /**************************************************************************/
 /*!
    @brief    Instatiate a GFX 1-bit canvas context for graphics
@@ -1668,6 +2208,7 @@ GFXcanvas1::GFXcanvas1(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
     if((buffer = (uint8_t *)malloc(bytes))) {
         memset(buffer, 0, bytes);
     }
+    canvasSteps(0, w, h, ((w + 7) / 8) * 8, &origin, &stepX, &stepY);
 }
 
 /**************************************************************************/
@@ -1698,35 +2239,116 @@ void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
     if(buffer) {
         if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return;
 
-        int16_t t;
-        switch(rotation) {
-            case 1:
-                t = x;
-                x = WIDTH  - 1 - y;
-                y = t;
-                break;
-            case 2:
-                x = WIDTH  - 1 - x;
-                y = HEIGHT - 1 - y;
-                break;
-            case 3:
-                t = x;
-                x = y;
-                y = HEIGHT - 1 - t;
-                break;
-        }
-
-        uint8_t   *ptr  = &buffer[(x / 8) + y * ((WIDTH + 7) / 8)];
+        int32_t  i    = origin + x * stepX + y * stepY;
+        uint8_t *ptr  = &buffer[i >> 3];
 #ifdef __AVR__
-        if(color) *ptr |= pgm_read_byte(&GFXsetBit[x & 7]);
-        else      *ptr &= pgm_read_byte(&GFXclrBit[x & 7]);
+        if(color) *ptr |= pgm_read_byte(&GFXsetBit[i & 7]);
+        else      *ptr &= pgm_read_byte(&GFXclrBit[i & 7]);
 #else
-        if(color) *ptr |=   0x80 >> (x & 7);
-        else      *ptr &= ~(0x80 >> (x & 7));
+        if(color) *ptr |=   0x80 >> (i & 7);
+        else      *ptr &= ~(0x80 >> (i & 7));
 #endif
     }
 }
 
+/**************************************************************************/
+/*!
+   @brief    Draw a perfectly horizontal line straight into the framebuffer
+    @param    x   Left-most x coordinate
+    @param    y   Left-most y coordinate
+    @param    w   Width in pixels, negative to go left
+    @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas1::drawFastHLine(int16_t x, int16_t y, int16_t w,
+  uint16_t color) {
+    GFX_TRACE(GFX_TRACE_HLINE);
+    writeFastHLine(x, y, w, color);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a perfectly vertical line straight into the framebuffer
+    @param    x   Top-most x coordinate
+    @param    y   Top-most y coordinate
+    @param    h   Height in pixels, negative to go up
+    @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas1::drawFastVLine(int16_t x, int16_t y, int16_t h,
+  uint16_t color) {
+    GFX_TRACE(GFX_TRACE_VLINE);
+    writeFastVLine(x, y, h, color);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Write a perfectly horizontal line. At rotation 0 or 2 it's a
+             run of bits, set or cleared a byte at a time.
+    @param    x   Left-most x coordinate
+    @param    y   Left-most y coordinate
+    @param    w   Width in pixels, negative to go left
+    @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas1::writeFastHLine(int16_t x, int16_t y, int16_t w,
+  uint16_t color) {
+    if(!buffer || (y < 0) || (y >= _height) || !clipSpan(&x, &w, _width)) {
+        return;
+    }
+    int32_t i = origin + x * stepX + y * stepY;
+    if(stepX == 1) {
+        fillBits(buffer, i, w, color);
+    } else if(stepX == -1) {
+        fillBits(buffer, i - w + 1, w, color);
+    } else {
+        for(; w--; i += stepX) {
+            if(color) buffer[i >> 3] |=   0x80 >> (i & 7);
+            else      buffer[i >> 3] &= ~(0x80 >> (i & 7));
+        }
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Write a perfectly vertical line. At rotation 1 or 3 it's a
+             run of bits, set or cleared a byte at a time.
+    @param    x   Top-most x coordinate
+    @param    y   Top-most y coordinate
+    @param    h   Height in pixels, negative to go up
+    @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas1::writeFastVLine(int16_t x, int16_t y, int16_t h,
+  uint16_t color) {
+    if(!buffer || (x < 0) || (x >= _width) || !clipSpan(&y, &h, _height)) {
+        return;
+    }
+    int32_t i = origin + x * stepX + y * stepY;
+    if(stepY == 1) {
+        fillBits(buffer, i, h, color);
+    } else if(stepY == -1) {
+        fillBits(buffer, i - h + 1, h, color);
+    } else {
+        for(; h--; i += stepY) {
+            if(color) buffer[i >> 3] |=   0x80 >> (i & 7);
+            else      buffer[i >> 3] &= ~(0x80 >> (i & 7));
+        }
+    }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Set rotation, and where pixels are stored at it
+    @param  r   Rotation, 0 thru 3
+*/
+/**************************************************************************/
+void GFXcanvas1::setRotation(uint8_t r) {
+    Adafruit_GFX::setRotation(r);
+    canvasSteps(rotation, WIDTH, HEIGHT, ((WIDTH + 7) / 8) * 8, &origin,
+      &stepX, &stepY);
+}
+
 /**************************************************************************/
 /*!
     @brief  Fill the framebuffer completely with one color
@@ -1752,6 +2374,7 @@ GFXcanvas8::GFXcanvas8(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
     if((buffer = (uint8_t *)malloc(bytes))) {
         memset(buffer, 0, bytes);
     }
+    canvasSteps(0, w, h, w, &origin, &stepX, &stepY);
 }
 
 /**************************************************************************/
@@ -1775,25 +2398,7 @@ void GFXcanvas8::drawPixel(int16_t x, int16_t y, uint16_t color) {
     if(buffer) {
         if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return;
 
-        int16_t t;
-        switch(rotation) {
-            case 1:
-                t = x;
-                x = WIDTH  - 1 - y;
-                y = t;
-                break;
-            case 2:
-                x = WIDTH  - 1 - x;
-                y = HEIGHT - 1 - y;
-                break;
-            case 3:
-                t = x;
-                x = y;
-                y = HEIGHT - 1 - t;
-                break;
-        }
-
-        buffer[x + y * WIDTH] = color;
+        buffer[origin + x * stepX + y * stepY] = color;
     }
 }
 
@@ -1809,39 +2414,95 @@ void GFXcanvas8::fillScreen(uint16_t color) {
     }
 }
 
-void GFXcanvas8::writeFastHLine(int16_t x, int16_t y,
-  int16_t w, uint16_t color) {
+/**************************************************************************/
+/*!
+   @brief    Draw a perfectly horizontal line straight into the framebuffer
+    @param    x   Left-most x coordinate
+    @param    y   Left-most y coordinate
+    @param    w   Width in pixels, negative to go left
+    @param    color 8-bit Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas8::drawFastHLine(int16_t x, int16_t y, int16_t w,
+  uint16_t color) {
+    GFX_TRACE(GFX_TRACE_HLINE);
+    writeFastHLine(x, y, w, color);
+}
 
-    if((x >= _width) || (y < 0) || (y >= _height)) return;
-    int16_t x2 = x + w - 1;
-    if(x2 < 0) return;
+/**************************************************************************/
+/*!
+   @brief    Draw a perfectly vertical line straight into the framebuffer
+    @param    x   Top-most x coordinate
+    @param    y   Top-most y coordinate
+    @param    h   Height in pixels, negative to go up
+    @param    color 8-bit Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas8::drawFastVLine(int16_t x, int16_t y, int16_t h,
+  uint16_t color) {
+    GFX_TRACE(GFX_TRACE_VLINE);
+    writeFastVLine(x, y, h, color);
+}
 
-    // Clip left/right
-    if(x < 0) {
-        x = 0;
-        w = x2 + 1;
+/**************************************************************************/
+/*!
+   @brief    Write a perfectly horizontal line, one memset() at rotation 0
+             or 2
+    @param    x   Left-most x coordinate
+    @param    y   Left-most y coordinate
+    @param    w   Width in pixels, negative to go left
+    @param    color 8-bit Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas8::writeFastHLine(int16_t x, int16_t y,
+  int16_t w, uint16_t color) {
+    if(!buffer || (y < 0) || (y >= _height) || !clipSpan(&x, &w, _width)) {
+        return;
+    }
+    uint8_t *p = &buffer[origin + x * stepX + y * stepY];
+    if(stepX == 1) {
+        memset(p, color, w);
+    } else if(stepX == -1) {
+        memset(p - w + 1, color, w);
+    } else {
+        for(; w--; p += stepX) *p = color;
     }
-    if(x2 >= _width) w = _width - x;
+}
 
-    int16_t t;
-    switch(rotation) {
-        case 1:
-            t = x;
-            x = WIDTH  - 1 - y;
-            y = t;
-            break;
-        case 2:
-            x = WIDTH  - 1 - x;
-            y = HEIGHT - 1 - y;
-            break;
-        case 3:
-            t = x;
-            x = y;
-            y = HEIGHT - 1 - t;
-            break;
+/**************************************************************************/
+/*!
+   @brief    Write a perfectly vertical line, one memset() at rotation 1
+             or 3
+    @param    x   Top-most x coordinate
+    @param    y   Top-most y coordinate
+    @param    h   Height in pixels, negative to go up
+    @param    color 8-bit Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas8::writeFastVLine(int16_t x, int16_t y,
+  int16_t h, uint16_t color) {
+    if(!buffer || (x < 0) || (x >= _width) || !clipSpan(&y, &h, _height)) {
+        return;
     }
+    uint8_t *p = &buffer[origin + x * stepX + y * stepY];
+    if(stepY == 1) {
+        memset(p, color, h);
+    } else if(stepY == -1) {
+        memset(p - h + 1, color, h);
+    } else {
+        for(; h--; p += stepY) *p = color;
+    }
+}
 
-    memset(buffer + y * WIDTH + x, color, w);
+/**************************************************************************/
+/*!
+    @brief  Set rotation, and where pixels are stored at it
+    @param  r   Rotation, 0 thru 3
+*/
+/**************************************************************************/
+void GFXcanvas8::setRotation(uint8_t r) {
+    Adafruit_GFX::setRotation(r);
+    canvasSteps(rotation, WIDTH, HEIGHT, WIDTH, &origin, &stepX, &stepY);
 }
 
 /**************************************************************************/
@@ -1851,11 +2512,13 @@ void GFXcanvas8::writeFastHLine(int16_t x, int16_t y,
    @param    h   Display height, in pixels
 */
 /**************************************************************************/
-GFXcanvas16::GFXcanvas16(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
+GFXcanvas16::GFXcanvas16(uint16_t w, uint16_t h) : Adafruit_GFX(w, h),
+  direct(true) {
     uint32_t bytes = w * h * 2;
     if((buffer = (uint16_t *)malloc(bytes))) {
         memset(buffer, 0, bytes);
     }
+    canvasSteps(0, w, h, w, &origin, &stepX, &stepY);
 }
 
 /**************************************************************************/
@@ -1879,28 +2542,109 @@ void GFXcanvas16::drawPixel(int16_t x, int16_t y, uint16_t color) {
     if(buffer) {
         if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return;
 
-        int16_t t;
-        switch(rotation) {
-            case 1:
-                t = x;
-                x = WIDTH  - 1 - y;
-                y = t;
-                break;
-            case 2:
-                x = WIDTH  - 1 - x;
-                y = HEIGHT - 1 - y;
-                break;
-            case 3:
-                t = x;
-                x = y;
-                y = HEIGHT - 1 - t;
-                break;
-        }
+        buffer[origin + x * stepX + y * stepY] = color;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a perfectly horizontal line straight into the framebuffer
+    @param    x   Left-most x coordinate
+    @param    y   Left-most y coordinate
+    @param    w   Width in pixels, negative to go left
+    @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas16::drawFastHLine(int16_t x, int16_t y, int16_t w,
+  uint16_t color) {
+    GFX_TRACE(GFX_TRACE_HLINE);
+    writeFastHLine(x, y, w, color);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a perfectly vertical line straight into the framebuffer
+    @param    x   Top-most x coordinate
+    @param    y   Top-most y coordinate
+    @param    h   Height in pixels, negative to go up
+    @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas16::drawFastVLine(int16_t x, int16_t y, int16_t h,
+  uint16_t color) {
+    GFX_TRACE(GFX_TRACE_VLINE);
+    writeFastVLine(x, y, h, color);
+}
 
-        buffer[x + y * WIDTH] = color;
+/**************************************************************************/
+/*!
+   @brief    Write a perfectly horizontal line, one gfx565Fill() at
+             rotation 0 or 2
+    @param    x   Left-most x coordinate
+    @param    y   Left-most y coordinate
+    @param    w   Width in pixels, negative to go left
+    @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas16::writeFastHLine(int16_t x, int16_t y, int16_t w,
+  uint16_t color) {
+    if(!buffer || (y < 0) || (y >= _height) || !clipSpan(&x, &w, _width)) {
+        return;
+    }
+    if(!direct) {
+        for(; w--; x++) drawPixel(x, y, color);
+        return;
+    }
+    uint16_t *p = &buffer[origin + x * stepX + y * stepY];
+    if(stepX == 1) {
+        gfx565Fill(p, color, w);
+    } else if(stepX == -1) {
+        gfx565Fill(p - w + 1, color, w);
+    } else {
+        for(; w--; p += stepX) *p = color;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Write a perfectly vertical line, one gfx565Fill() at rotation
+             1 or 3
+    @param    x   Top-most x coordinate
+    @param    y   Top-most y coordinate
+    @param    h   Height in pixels, negative to go up
+    @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas16::writeFastVLine(int16_t x, int16_t y, int16_t h,
+  uint16_t color) {
+    if(!buffer || (x < 0) || (x >= _width) || !clipSpan(&y, &h, _height)) {
+        return;
+    }
+    if(!direct) {
+        for(; h--; y++) drawPixel(x, y, color);
+        return;
+    }
+    uint16_t *p = &buffer[origin + x * stepX + y * stepY];
+    if(stepY == 1) {
+        gfx565Fill(p, color, h);
+    } else if(stepY == -1) {
+        gfx565Fill(p - h + 1, color, h);
+    } else {
+        for(; h--; p += stepY) *p = color;
     }
 }
 
+/**************************************************************************/
+/*!
+    @brief  Set rotation, and where pixels are stored at it
+    @param  r   Rotation, 0 thru 3
+*/
+/**************************************************************************/
+void GFXcanvas16::setRotation(uint8_t r) {
+    Adafruit_GFX::setRotation(r);
+    canvasSteps(rotation, WIDTH, HEIGHT, WIDTH, &origin, &stepX, &stepY);
+}
+
 /**************************************************************************/
 /*!
     @brief  Fill the framebuffer completely with one color
@@ -1909,13 +2653,49 @@ void GFXcanvas16::drawPixel(int16_t x, int16_t y, uint16_t color) {
 /**************************************************************************/
 void GFXcanvas16::fillScreen(uint16_t color) {
     if(buffer) {
-        uint8_t hi = color >> 8, lo = color & 0xFF;
-        if(hi == lo) {
-            memset(buffer, lo, WIDTH * HEIGHT * 2);
-        } else {
-            uint32_t i, pixels = WIDTH * HEIGHT;
-            for(i=0; i<pixels; i++) buffer[i] = color;
-        }
+        gfx565Fill(buffer, color, (uint32_t)WIDTH * HEIGHT);
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Fill a rectangle, a row of the framebuffer at a time
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    w   Width in pixels
+    @param    h   Height in pixels
+    @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas16::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+  uint16_t color) {
+    if(!direct) {
+        Adafruit_GFX::fillRect(x, y, w, h, color);
+        return;
+    }
+    if(!buffer) return;
+    int32_t x1 = x, y1 = y, x2 = (int32_t)x + w, y2 = (int32_t)y + h;
+    if(w < 0) { x1 = x2 + 1; x2 = x + 1; } // Negative size goes left/up
+    if(h < 0) { y1 = y2 + 1; y2 = y + 1; }
+    if(x1 < 0) x1 = 0;
+    if(y1 < 0) y1 = 0;
+    if(x2 > _width)  x2 = _width;
+    if(y2 > _height) y2 = _height;
+    if((x1 >= x2) || (y1 >= y2)) return;
+
+    // The same rectangle in the unrotated buffer
+    int32_t rx, ry, rw, rh;
+    switch(rotation) {
+        case 0:  rx = x1;          ry = y1;           rw = x2 - x1; rh = y2 - y1; break;
+        case 1:  rx = WIDTH - y2;  ry = x1;           rw = y2 - y1; rh = x2 - x1; break;
+        case 2:  rx = WIDTH - x2;  ry = HEIGHT - y2;  rw = x2 - x1; rh = y2 - y1; break;
+        default: rx = y1;          ry = HEIGHT - x2;  rw = y2 - y1; rh = x2 - x1; break;
+    }
+    uint16_t *row = &buffer[ry * WIDTH + rx];
+    if(rw == WIDTH) {
+        gfx565Fill(row, color, rw * rh); // Whole rows, all one run
+    } else {
+        for(; rh--; row += WIDTH) gfx565Fill(row, color, rw);
     }
 }
 
@@ -1934,7 +2714,99 @@ void GFXcanvas16::fillScreen(uint16_t color) {
 /**************************************************************************/
 void GFXcanvas16::byteSwap(void) {
     if(buffer) {
-        uint32_t i, pixels = WIDTH * HEIGHT;
-        for(i=0; i<pixels; i++) buffer[i] = __builtin_bswap16(buffer[i]);
+        gfx565Swap(buffer, buffer, (uint32_t)WIDTH * HEIGHT);
     }
 }
+
+/**************************************************************************/
+/*!
+    @brief  Copy another canvas onto this one, clipped to this one
+    @param  x    Where src's top left corner goes
+    @param  y    Where src's top left corner goes
+    @param  src  Canvas to copy, as stored (at rotation 0); not this one
+*/
+/**************************************************************************/
+void GFXcanvas16::drawCanvas(int16_t x, int16_t y, const GFXcanvas16 &src) {
+    blit(x, y, src, 0, 0);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Copy another canvas onto this one, except pixels of a
+            transparent color, clipped to this one
+    @param  x    Where src's top left corner goes
+    @param  y    Where src's top left corner goes
+    @param  src  Canvas to copy, as stored (at rotation 0); not this one
+    @param  key  16-bit 5-6-5 color left out
+*/
+/**************************************************************************/
+void GFXcanvas16::drawCanvas(int16_t x, int16_t y, const GFXcanvas16 &src,
+  uint16_t key) {
+    blit(x, y, src, 1, key);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Mix another canvas half and half into this one, clipped to
+            this one
+    @param  x    Where src's top left corner goes
+    @param  y    Where src's top left corner goes
+    @param  src  Canvas to mix in, as stored (at rotation 0); not this one
+*/
+/**************************************************************************/
+void GFXcanvas16::blendCanvas(int16_t x, int16_t y, const GFXcanvas16 &src) {
+    blit(x, y, src, 2, 0);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Copy, key or blend another canvas onto this one. At rotation 0
+            each row is one run for the pixel kernels; otherwise it goes a
+            pixel at a time.
+    @param  x     Where src's top left corner goes
+    @param  y     Where src's top left corner goes
+    @param  src   Canvas to draw
+    @param  mode  0 to copy, 1 to leave out key, 2 to blend
+    @param  key   16-bit 5-6-5 color left out in mode 1
+*/
+/**************************************************************************/
+void GFXcanvas16::blit(int16_t x, int16_t y, const GFXcanvas16 &src,
+  uint8_t mode, uint16_t key) {
+    if(!buffer || !src.buffer || (&src == this)) return;
+    int32_t sw = src.WIDTH,
+            x1 = (x < 0) ? 0 : x, y1 = (y < 0) ? 0 : y,
+            x2 = min((int32_t)x + sw, (int32_t)_width),
+            y2 = min((int32_t)y + src.HEIGHT, (int32_t)_height);
+    if((x1 >= x2) || (y1 >= y2)) return;
+
+    for(int32_t row=y1; row<y2; row++) {
+        const uint16_t *s = &src.buffer[(row - y) * sw + (x1 - x)];
+        if(direct && !rotation) {
+            uint16_t *d = &buffer[row * WIDTH + x1];
+            switch(mode) {
+                case 0:  gfx565Copy(d, s, x2 - x1);         break;
+                case 1:  gfx565CopyKey(d, s, x2 - x1, key); break;
+                default: gfx565Blend(d, s, x2 - x1);        break;
+            }
+        } else {
+            for(int32_t col=x1; col<x2; col++, s++) {
+                uint16_t c = *s;
+                if((mode == 1) && (c == key)) continue;
+                if(mode == 2) c = gfx565Average(*pixel(col, row), c);
+                drawPixel(col, row, c);
+            }
+        }
+    }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Find a pixel in the framebuffer
+    @param  x   x coordinate, on the canvas
+    @param  y   y coordinate, on the canvas
+    @returns Where it's stored
+*/
+/**************************************************************************/
+uint16_t *GFXcanvas16::pixel(int16_t x, int16_t y) const {
+    return &buffer[origin + x * stepX + y * stepY];
+}
@@ -0,0 +1,117 @@
+/*!
+ * @file Adafruit_GlyphCache.cpp
+ *
+ * Part of Adafruit's GFX graphics library. See Adafruit_GlyphCache.h.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_GlyphCache.h"
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate a glyph cache
+    @param   bytes  Arena size; glyphs take 4 bytes per rectangle, about
+                    40 for a classic font character and 40-150 for a
+                    12 point GFXfont one
+*/
+/**************************************************************************/
+GFXglyphCache::GFXglyphCache(uint16_t bytes) {
+    arena     = (uint8_t *)malloc(bytes);
+    arenaSize = arena ? bytes : 0; // No arena, nothing is ever found
+    clear();
+}
+
+/**************************************************************************/
+/*!
+   @brief    Delete the cache and free its arena
+*/
+/**************************************************************************/
+GFXglyphCache::~GFXglyphCache(void) {
+    if(arena) free(arena);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Forget every glyph, e.g. after changing a font in RAM
+*/
+/**************************************************************************/
+void GFXglyphCache::clear(void) {
+    arenaUsed = 0;
+    numSlots  = 0;
+    tick      = 0;
+    numHits   = numMisses = 0;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Look up a glyph, marking it as most recently used
+    @param   font  Font the glyph is from, NULL for the classic font
+    @param   c     Character, as indexed in the font
+    @param   n     Set to the number of rectangles on a hit
+    @returns The glyph's rectangles (valid until the next add()), or NULL
+             if it isn't cached
+*/
+/**************************************************************************/
+const GFXglyphRect *GFXglyphCache::find(const GFXfont *font, uint8_t c,
+  uint8_t *n) {
+    for(uint8_t i=0; i<numSlots; i++) {
+        if((slots[i].c == c) && (slots[i].font == font)) {
+            slots[i].stamp = ++tick;
+            *n = slots[i].n;
+            numHits++;
+            return (const GFXglyphRect *)&arena[slots[i].offset];
+        }
+    }
+    numMisses++;
+    return NULL;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Add a glyph that find() didn't have, evicting the least
+             recently used ones to make room
+    @param   font   Font the glyph is from, NULL for the classic font
+    @param   c      Character, as indexed in the font
+    @param   rects  The glyph's rectangles
+    @param   n      Number of rectangles, 0 for a blank glyph such as space
+*/
+/**************************************************************************/
+void GFXglyphCache::add(const GFXfont *font, uint8_t c,
+  const GFXglyphRect *rects, uint8_t n) {
+    uint16_t bytes = n * sizeof(GFXglyphRect);
+    if(!arena || (bytes > arenaSize)) return;
+    while((numSlots >= GFX_GLYPH_SLOTS) || (arenaUsed + bytes > arenaSize)) {
+        evict();
+    }
+    Slot *s   = &slots[numSlots++];
+    s->font   = font;
+    s->c      = c;
+    s->n      = n;
+    s->offset = arenaUsed;
+    s->stamp  = ++tick;
+    memcpy(&arena[arenaUsed], rects, bytes);
+    arenaUsed += bytes;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Remove the least recently used glyph and move the arena
+             contents after it down over the gap
+*/
+/**************************************************************************/
+void GFXglyphCache::evict(void) {
+    uint8_t lru = 0;
+    for(uint8_t i=1; i<numSlots; i++) {
+        if((int32_t)(slots[i].stamp - slots[lru].stamp) < 0) lru = i;
+    }
+    uint16_t offset = slots[lru].offset,
+             bytes  = slots[lru].n * sizeof(GFXglyphRect);
+    memmove(&arena[offset], &arena[offset + bytes],
+      arenaUsed - offset - bytes);
+    arenaUsed -= bytes;
+    slots[lru] = slots[--numSlots]; // Slot order doesn't matter
+    for(uint8_t i=0; i<numSlots; i++) {
+        if(slots[i].offset > offset) slots[i].offset -= bytes;
+    }
+}
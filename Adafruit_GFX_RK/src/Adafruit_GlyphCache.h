@@ -0,0 +1,97 @@
+/*!
+ * @file Adafruit_GlyphCache.h
+ *
+ * Part of Adafruit's GFX graphics library. Keeps recently drawn font glyphs
+ * as ready-made lists of rectangles so drawing the same characters again
+ * (clock digits, labels) skips reading and unpacking the font bitmap.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _ADAFRUIT_GLYPHCACHE_H_
+#define _ADAFRUIT_GLYPHCACHE_H_
+
+#include "Adafruit_GFX.h"
+
+#if !defined(GFX_GLYPH_CACHE)
+ #define GFX_GLYPH_CACHE 2048 ///< Default cache arena size in bytes
+#endif
+#if !defined(GFX_GLYPH_SLOTS)
+ #define GFX_GLYPH_SLOTS 48   ///< Most glyphs a cache holds, whatever their size
+#endif
+
+/// One rectangle of lit pixels in a glyph, in unscaled font pixels from
+/// the character origin (top left for the classic font, baseline for
+/// GFXfonts)
+typedef struct {
+  int8_t  x;  ///< Left edge
+  int8_t  y;  ///< Top edge
+  uint8_t w;  ///< Width
+  uint8_t h;  ///< Height
+} GFXglyphRect;
+
+/*!
+  @brief  LRU cache of glyphs as rectangle lists, shared by any number of
+          Adafruit_GFX objects through setGlyphCache().
+
+          drawChar() merges each glyph's lit pixels into rectangles (runs
+          of a row, grown down while the rows below repeat them) before
+          drawing it; with a cache that work is done once per character
+          instead of once per draw. Entries are kept in unscaled font
+          pixels and hold no color, so one entry serves every text size
+          and color a glyph is drawn in.
+
+          The arena is allocated once, in the constructor. Adding a glyph
+          that doesn't fit evicts the least recently drawn ones and closes
+          the gaps they leave, so the arena never fragments.
+*/
+class GFXglyphCache {
+ public:
+  GFXglyphCache(uint16_t bytes = GFX_GLYPH_CACHE);
+  ~GFXglyphCache(void);
+  const GFXglyphRect *find(const GFXfont *font, uint8_t c, uint8_t *n);
+  void      add(const GFXfont *font, uint8_t c, const GFXglyphRect *rects,
+              uint8_t n),
+            clear(void);
+  /**********************************************************************/
+  /*!
+    @brief    Get the number of find() calls that found their glyph
+    @returns  Hit count since construction or clear()
+  */
+  /**********************************************************************/
+  uint32_t  hits(void) const { return numHits; }
+  /**********************************************************************/
+  /*!
+    @brief    Get the number of find() calls that didn't
+    @returns  Miss count since construction or clear()
+  */
+  /**********************************************************************/
+  uint32_t  misses(void) const { return numMisses; }
+  /**********************************************************************/
+  /*!
+    @brief    Get how much of the arena is in use
+    @returns  Bytes used
+  */
+  /**********************************************************************/
+  uint16_t  used(void) const { return arenaUsed; }
+
+ private:
+  void      evict(void);
+
+  /// One cached glyph, its rectangles at arena + offset
+  struct Slot {
+    const GFXfont *font;    ///< NULL for the classic font
+    uint32_t       stamp;   ///< tick of the last find() hit or add()
+    uint16_t       offset;  ///< Byte offset in the arena
+    uint8_t        c;       ///< Character, as indexed in the font
+    uint8_t        n;       ///< Number of rectangles
+  };
+
+  uint8_t  *arena;
+  uint16_t  arenaSize, arenaUsed;
+  Slot      slots[GFX_GLYPH_SLOTS];
+  uint8_t   numSlots;
+  uint32_t  tick, numHits, numMisses;
+};
+
+#endif // _ADAFRUIT_GLYPHCACHE_H_
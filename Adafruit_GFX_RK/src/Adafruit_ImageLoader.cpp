@@ -0,0 +1,196 @@
+/*!
+ * @file Adafruit_ImageLoader.cpp
+ *
+ * Part of Adafruit's GFX graphics library. See Adafruit_ImageLoader.h.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_ImageLoader.h"
+
+#ifndef min
+ #define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef max
+ #define max(a,b) (((a) > (b)) ? (a) : (b))
+#endif
+
+#define BMP_HEADER 54 ///< File header and BITMAPINFOHEADER, the least a BMP has
+
+/// Little-endian value from a BMP header
+static uint32_t readLE(const uint8_t *p, uint8_t bytes) {
+    uint32_t v = 0;
+    while(bytes--) v = (v << 8) | p[bytes];
+    return v;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate an image loader
+    @param   gfx  Where to draw, usually an Adafruit_SPITFT display
+*/
+/**************************************************************************/
+GFXimageLoader::GFXimageLoader(Adafruit_GFX &gfx) : gfx(gfx) { }
+
+/**************************************************************************/
+/*!
+   @brief    Draw an uncompressed 24- or 32-bit BMP file
+    @param   file  The file, read from the start of the BMP
+    @param   x     Top left corner x coordinate
+    @param   y     Top left corner y coordinate
+    @returns True if the file was a BMP of that kind and was read to the
+             last row that shows. The file is left part way through.
+*/
+/**************************************************************************/
+bool GFXimageLoader::drawBMP(GFXimageSource &file, int16_t x, int16_t y) {
+    for(int got = 0, n; got < BMP_HEADER; got += n) {
+        if((n = file.read(&chunk[got], BMP_HEADER - got)) <= 0) return false;
+    }
+    uint32_t offset      = readLE(&chunk[10], 4),
+             compression = readLE(&chunk[30], 4);
+    int32_t  w           = (int32_t)readLE(&chunk[18], 4),
+             h           = (int32_t)readLE(&chunk[22], 4);
+    uint8_t  bpp         = readLE(&chunk[28], 2) / 8;
+    bool     bottomUp    = h > 0;
+    if(!bottomUp) h = -h;
+    // Compression 3 (bit fields) is how 32-bit files with alpha say so
+    if((chunk[0] != 'B') || (chunk[1] != 'M') || (offset < BMP_HEADER) ||
+       ((bpp != 3) && (bpp != 4)) || ((compression != 0) && (compression != 3))
+       || (w <= 0) || (w > 0xFFFF) || (h == 0) || (h > 0xFFFF)) return false;
+    return draw(file, x, y, w, h, bpp, false, offset - BMP_HEADER,
+      (4 - (w * bpp) % 4) % 4, bottomUp);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a file of raw 16-bit 5-6-5 pixels, left to right and top
+             to bottom, such as ffmpeg's rgb565le or rgb565be output
+    @param   file       The file, read from the first pixel
+    @param   x          Top left corner x coordinate
+    @param   y          Top left corner y coordinate
+    @param   w          Width in pixels
+    @param   h          Height in pixels
+    @param   bigEndian  True if each pixel's high byte comes first
+    @returns True if the file was read to the last row that shows
+*/
+/**************************************************************************/
+bool GFXimageLoader::drawRaw(GFXimageSource &file, int16_t x, int16_t y,
+  uint16_t w, uint16_t h, bool bigEndian) {
+    return draw(file, x, y, w, h, 2, bigEndian, 0, 0, false);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Read and draw the rows of pixels. Each chunk is read outside
+             any transaction, since an SD card is usually on the same bus.
+    @param   file       The file, where the skipped bytes start
+    @param   x          Top left corner x coordinate
+    @param   y          Top left corner y coordinate
+    @param   w          Width in pixels
+    @param   h          Height in pixels
+    @param   bpp        Bytes per pixel: 2 for 5-6-5, 3 or 4 for BGR(A)
+    @param   bigEndian  With 2 bytes per pixel, whether the high one is first
+    @param   skip       Bytes before the first pixel
+    @param   rowPad     Bytes after each row
+    @param   bottomUp   True if the file has the bottom row first
+    @returns True if the file was read to the last row that shows
+*/
+/**************************************************************************/
+bool GFXimageLoader::draw(GFXimageSource &file, int16_t x, int16_t y,
+  uint16_t w, uint16_t h, uint8_t bpp, bool bigEndian, uint32_t skip,
+  uint8_t rowPad, bool bottomUp) {
+    left   = max(x, 0);
+    right  = (int16_t)min((int32_t)x + w, (int32_t)gfx.width());
+    int16_t top = max(y, 0);
+    bottom = (int16_t)min((int32_t)y + h, (int32_t)gfx.height());
+    if((left >= right) || (top >= bottom)) return true;
+
+    uint16_t row = 0, col = 0, carry = 0;
+    uint32_t pad = skip;
+    while(row < h) {
+        int n = file.read(&chunk[carry], GFX_LOADER_CHUNK - carry);
+        if(n <= 0) return false;
+        uint16_t end = carry + n, i = 0;
+        windowEnd = INT16_MIN; // A new transaction needs a new window
+        gfx.startWrite();
+        while(row < h) {
+            if(pad) {
+                uint16_t k = min(pad, (uint32_t)(end - i));
+                i   += k;
+                pad -= k;
+                if(pad) break;
+                continue;
+            }
+            uint16_t k = min((uint16_t)(w - col), (uint16_t)((end - i) / bpp));
+            if(!k) break; // Part of a pixel, goes with the next chunk
+            int16_t sy = y + (bottomUp ? (h - 1 - row) : row);
+            int32_t a  = max((int32_t)x + col, (int32_t)left),
+                    b  = min((int32_t)x + col + k, (int32_t)right);
+            if((sy >= top) && (sy < bottom) && (a < b)) {
+                const uint8_t *p = &chunk[i + (a - x - col) * bpp];
+                uint16_t len = b - a;
+                if(bpp > 2) {
+                    for(uint16_t j=0; j<len; j++, p+=bpp) {
+                        pixels[j] = ((uint16_t)(p[2] & 0xF8) << 8) |
+                                    ((p[1] & 0xFC) << 3) | (p[0] >> 3);
+                    }
+                } else if(bigEndian) {
+                    for(uint16_t j=0; j<len; j++, p+=2) {
+                        pixels[j] = ((uint16_t)p[0] << 8) | p[1];
+                    }
+                } else {
+                    for(uint16_t j=0; j<len; j++, p+=2) {
+                        pixels[j] = ((uint16_t)p[1] << 8) | p[0];
+                    }
+                }
+                send(a, sy, len, bottomUp);
+            }
+            i   += k * bpp;
+            col += k;
+            if(col == w) {
+                col = 0;
+                pad = rowPad;
+                // Stop once the last row that shows is done
+                row = (bottomUp ? (sy <= top) : (sy + 1 >= bottom)) ?
+                  h : (row + 1);
+            }
+        }
+        gfx.endWrite();
+        carry = end - i;
+        memmove(chunk, &chunk[i], carry);
+    }
+    return true;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Send the converted span, in the open window if it carries on
+             from where that is up to, else in a new one: to the bottom of
+             the image for top-down files, else just to the end of the row.
+             Without writeWindow() (canvases) it draws pixels.
+    @param   x         Span's first pixel x coordinate, on screen
+    @param   y         Span's row, on screen
+    @param   len       Pixels in the span
+    @param   bottomUp  True if the rows are going up
+*/
+/**************************************************************************/
+void GFXimageLoader::send(int16_t x, int16_t y, uint16_t len,
+  bool bottomUp) {
+    if((x != nextX) || (y != nextY) || (y >= windowEnd)) {
+        int16_t rows = (bottomUp || (x != left)) ? 1 : (bottom - y);
+        if(!gfx.writeWindow(x, y, right - x, rows)) {
+            for(uint16_t j=0; j<len; j++) gfx.writePixel(x + j, y, pixels[j]);
+            return;
+        }
+        windowEnd = y + rows;
+    }
+    // Returns with pixels free to refill; a display still sending them
+    // finishes before the next window's commands
+    gfx.writeWindowPixels(pixels, len);
+    nextX = x + len;
+    nextY = y;
+    if(nextX == right) {
+        nextX = left;
+        nextY++;
+    }
+}
@@ -0,0 +1,87 @@
+/*!
+ * @file Adafruit_ImageLoader.h
+ *
+ * Part of Adafruit's GFX graphics library. Draws uncompressed BMP and raw
+ * 5-6-5 image files a chunk at a time as they are read, from an SD card or
+ * anything else with a read(buffer, length), so only two small buffers are
+ * needed however big the image.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _ADAFRUIT_IMAGELOADER_H_
+#define _ADAFRUIT_IMAGELOADER_H_
+
+#include "Adafruit_GFX.h"
+
+#if !defined(GFX_LOADER_CHUNK)
+ #define GFX_LOADER_CHUNK 512 ///< Bytes read at a time, one SD card block
+#endif
+
+/*!
+  @brief  Where GFXimageLoader reads a file from. For an SD card file use
+          GFXfileSource.
+*/
+class GFXimageSource {
+ public:
+  /*!
+    @brief  Read the next bytes of the file
+    @param  buf  Where to put them
+    @param  len  Most bytes wanted
+    @returns Bytes read, 0 or less at the end of the file or on an error
+  */
+  virtual int read(uint8_t *buf, size_t len) = 0;
+};
+
+/*!
+  @brief  A GFXimageSource for any file class with an
+          int read(void *buf, size_t len), such as SdFat's File and FsFile
+          or a Particle TCPClient. The file is read from where it is.
+*/
+template <class F> class GFXfileSource : public GFXimageSource {
+ public:
+  /// @param  file  An open file, at the start of the image
+  GFXfileSource(F &file) : file(file) { }
+  int read(uint8_t *buf, size_t len) { return file.read(buf, len); }
+
+ private:
+  F &file;
+};
+
+/*!
+  @brief  Draws image files as they are read.
+
+          Each chunk of GFX_LOADER_CHUNK bytes is read, then converted to
+          5-6-5 a span of pixels at a time and sent in one startWrite() /
+          endWrite() through writeWindow(). On Adafruit_SPITFT on Particle
+          a span goes out by DMA while the next one is converted. The SD
+          card usually shares the SPI bus with the display, so reading
+          the next chunk waits for the last span to go.
+
+          BMP files are stored bottom row first and are drawn that way,
+          a row per address window, since the file is only read forwards.
+          Top-down BMP files and raw files are drawn in one window per
+          chunk. Parts off the display are read but not sent.
+*/
+class GFXimageLoader {
+ public:
+  GFXimageLoader(Adafruit_GFX &gfx);
+  bool drawBMP(GFXimageSource &file, int16_t x, int16_t y),
+       drawRaw(GFXimageSource &file, int16_t x, int16_t y, uint16_t w,
+         uint16_t h, bool bigEndian = false);
+
+ private:
+  bool draw(GFXimageSource &file, int16_t x, int16_t y, uint16_t w,
+         uint16_t h, uint8_t bpp, bool bigEndian, uint32_t skip,
+         uint8_t rowPad, bool bottomUp);
+  void send(int16_t x, int16_t y, uint16_t len, bool bottomUp);
+
+  Adafruit_GFX &gfx;
+  int16_t  left, right, bottom;  ///< On screen part: columns, + 1, last row + 1
+  int16_t  nextX, nextY;         ///< Next pixel of the open window
+  int16_t  windowEnd;            ///< Last row of the open window, + 1
+  uint8_t  chunk[GFX_LOADER_CHUNK];       ///< File bytes
+  uint16_t pixels[GFX_LOADER_CHUNK / 2];  ///< Converted span
+};
+
+#endif // _ADAFRUIT_IMAGELOADER_H_
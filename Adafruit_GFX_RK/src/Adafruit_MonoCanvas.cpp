@@ -0,0 +1,72 @@
+/*!
+ * @file Adafruit_MonoCanvas.cpp
+ *
+ * Part of Adafruit's GFX graphics library. See Adafruit_MonoCanvas.h.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_MonoCanvas.h"
+#include "Adafruit_Pixel565.h"
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate a two-color 1-bit canvas. Every row starts out
+             dirty, as nothing is known about what the display shows.
+    @param   w          Canvas width, in pixels
+    @param   h          Canvas height, in pixels
+    @param   fg         16-bit 5-6-5 color set pixels are shown in
+    @param   bg         16-bit 5-6-5 color clear pixels are shown in
+    @param   trackRows  True to send only rows drawn on, false to always
+                        send the whole canvas
+*/
+/**************************************************************************/
+GFXcanvas1Mono::GFXcanvas1Mono(uint16_t w, uint16_t h, uint16_t fg,
+  uint16_t bg, bool trackRows) : GFXrowCanvas<GFXcanvas1>(w, h, trackRows),
+  fg(fg), bg(bg) {
+}
+
+/**************************************************************************/
+/*!
+    @brief  Change the colors the canvas is shown in, at the next flush()
+    @param  fg  16-bit 5-6-5 color for set pixels
+    @param  bg  16-bit 5-6-5 color for clear pixels
+*/
+/**************************************************************************/
+void GFXcanvas1Mono::setColors(uint16_t fg, uint16_t bg) {
+    if((fg != this->fg) || (bg != this->bg)) {
+        this->fg = fg;
+        this->bg = bg;
+        markAllDirty();
+    }
+}
+
+/**************************************************************************/
+/*!
+    @brief   Copy the rows that changed since the last flush() to a display,
+             in the two colors, or the whole canvas without row tracking.
+             Parts off the display are left out.
+    @param   tft  Display to copy to
+    @param   x    Display column of the canvas' left edge
+    @param   y    Display row of the canvas' top edge
+    @returns Number of pixels sent
+*/
+/**************************************************************************/
+uint32_t GFXcanvas1Mono::flush(Adafruit_SPITFT &tft, int16_t x, int16_t y) {
+    uint16_t line[GFX_MONO_LINE];
+    return flushRows(tft, x, y, line, GFX_MONO_LINE);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Expand part of a row to the two colors
+    @param  line  Where to put them
+    @param  row   Unrotated row
+    @param  x     Unrotated column of the first pixel
+    @param  n     Number of pixels
+*/
+/**************************************************************************/
+void GFXcanvas1Mono::expandLine(uint16_t *line, int16_t row, int16_t x,
+  int16_t n) {
+    gfx565Expand1(line, &getBuffer()[row * ((WIDTH + 7) / 8)], x, n, fg, bg);
+}
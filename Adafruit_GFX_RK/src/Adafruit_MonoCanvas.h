@@ -0,0 +1,54 @@
+/*!
+ * @file Adafruit_MonoCanvas.h
+ *
+ * Part of Adafruit's GFX graphics library. A GFXcanvas1 shown on an
+ * Adafruit_SPITFT display in a foreground and a background color, for
+ * screens that are mostly text: 9.6K for 320x240. Each row is expanded to
+ * 5-6-5 as it's sent, and only rows drawn on since the last send need go.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _ADAFRUIT_MONOCANVAS_H_
+#define _ADAFRUIT_MONOCANVAS_H_
+
+#include "Adafruit_RowCanvas.h"
+
+#if !defined(GFX_MONO_LINE)
+ #define GFX_MONO_LINE 160 ///< Pixels flush() expands before sending them, on the stack
+#endif
+
+/*!
+  @brief  A 1-bit canvas shown in two colors.
+
+          Draw as on any GFXcanvas1: nonzero colors set pixels, 0 clears
+          them. flush() expands set pixels to the foreground color and
+          clear ones to the background color with gfx565Expand1(), a
+          GFX_MONO_LINE pixel buffer at a time handed to writePixels(), so
+          a whole canvas goes through a single address window instead of a
+          drawBitmap() pixel at a time.
+
+          With row tracking on (the default) the canvas also remembers
+          which of its rows were drawn on since the last flush(), a byte
+          per row (see GFXrowCanvas), and flush() sends only those, each
+          run of them through one address window. Changing the colors
+          marks every row.
+
+          Coordinates passed to flush() are display coordinates, so make
+          the canvas the size of the area it covers at the display's current
+          rotation, and rotate the display rather than the canvas.
+*/
+class GFXcanvas1Mono : public GFXrowCanvas<GFXcanvas1> {
+ public:
+  GFXcanvas1Mono(uint16_t w, uint16_t h, uint16_t fg = 0xFFFF,
+    uint16_t bg = 0x0000, bool trackRows = true);
+  void      setColors(uint16_t fg, uint16_t bg);
+  uint32_t  flush(Adafruit_SPITFT &tft, int16_t x = 0, int16_t y = 0);
+
+ private:
+  void      expandLine(uint16_t *line, int16_t row, int16_t x, int16_t n);
+
+  uint16_t  fg, bg;
+};
+
+#endif // _ADAFRUIT_MONOCANVAS_H_
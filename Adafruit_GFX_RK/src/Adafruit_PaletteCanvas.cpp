@@ -0,0 +1,91 @@
+/*!
+ * @file Adafruit_PaletteCanvas.cpp
+ *
+ * Part of Adafruit's GFX graphics library. See Adafruit_PaletteCanvas.h.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_PaletteCanvas.h"
+
+#ifndef min
+#define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate an 8-bit palette canvas, with the 3-3-2 RGB
+             palette. Every row starts out dirty, as nothing is known about
+             what the display shows.
+    @param   w   Canvas width, in pixels
+    @param   h   Canvas height, in pixels
+*/
+/**************************************************************************/
+GFXcanvas8Palette::GFXcanvas8Palette(uint16_t w, uint16_t h) :
+  GFXrowCanvas<GFXcanvas8>(w, h) {
+    for(uint16_t i=0; i<256; i++) {
+        uint16_t r = i >> 5, g = (i >> 2) & 7, b = i & 3;
+        palette[i] = (((r << 2) | (r >> 1)) << 11) | (((g << 3) | g) << 5) |
+                     (b << 3) | (b << 1) | (b >> 1);
+    }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Replace some or all of the palette. What's on the canvas shows
+            in the new colors at the next flush().
+    @param  colors  16-bit 5-6-5 colors
+    @param  n       Number of colors, no more than 256 - first
+    @param  first   Palette index of the first one
+*/
+/**************************************************************************/
+void GFXcanvas8Palette::setPalette(const uint16_t *colors, uint16_t n,
+  uint8_t first) {
+    n = min(n, (uint16_t)(256 - first));
+    for(uint16_t i=0; i<n; i++) palette[first + i] = colors[i];
+    markAllDirty();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Replace one palette color
+    @param  index  Palette index
+    @param  color  16-bit 5-6-5 color
+*/
+/**************************************************************************/
+void GFXcanvas8Palette::setPaletteColor(uint8_t index, uint16_t color) {
+    if(palette[index] != color) {
+        palette[index] = color;
+        markAllDirty();
+    }
+}
+
+/**************************************************************************/
+/*!
+    @brief   Copy the rows that changed since the last flush() to a display,
+             in the palette's colors. Parts off the display are left out.
+    @param   tft  Display to copy to
+    @param   x    Display column of the canvas' left edge
+    @param   y    Display row of the canvas' top edge
+    @returns Number of pixels sent
+*/
+/**************************************************************************/
+uint32_t GFXcanvas8Palette::flush(Adafruit_SPITFT &tft, int16_t x, int16_t y) {
+    uint16_t line[GFX_PALETTE_LINE];
+    return flushRows(tft, x, y, line, GFX_PALETTE_LINE);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Look part of a row up in the palette
+    @param  line  Where to put the colors
+    @param  row   Unrotated row
+    @param  x     Unrotated column of the first pixel
+    @param  n     Number of pixels
+*/
+/**************************************************************************/
+void GFXcanvas8Palette::expandLine(uint16_t *line, int16_t row, int16_t x,
+  int16_t n) {
+    const uint8_t *src = &getBuffer()[row * WIDTH + x];
+    for(int16_t i=0; i<n; i++) line[i] = palette[*src++];
+}
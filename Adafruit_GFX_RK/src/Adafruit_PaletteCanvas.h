@@ -0,0 +1,73 @@
+/*!
+ * @file Adafruit_PaletteCanvas.h
+ *
+ * Part of Adafruit's GFX graphics library. A GFXcanvas8 whose pixels are
+ * indexes into a palette of 256 16-bit 5-6-5 colors, copied to an
+ * Adafruit_SPITFT display a row at a time through the palette. It takes
+ * half the memory of a GFXcanvas16: 75K for 320x240.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _ADAFRUIT_PALETTECANVAS_H_
+#define _ADAFRUIT_PALETTECANVAS_H_
+
+#include "Adafruit_RowCanvas.h"
+
+#if !defined(GFX_PALETTE_LINE)
+ #define GFX_PALETTE_LINE 160 ///< Pixels flush() expands before sending them, on the stack
+#endif
+
+/*!
+  @brief  An 8-bit canvas drawn in palette indexes and shown in the
+          palette's colors.
+
+          Draw with an index (0 to 255) wherever a color is asked for. The
+          palette starts out as 3-3-2 RGB (see color332()), so a 5-6-5 color
+          passed through color332() draws the nearest of those; setPalette()
+          replaces any part of it.
+
+          The canvas remembers which of its rows changed since the last
+          flush() (a byte per row, see GFXrowCanvas), and flush() sends
+          only those, looking each pixel up in the palette into a
+          GFX_PALETTE_LINE pixel buffer handed to writePixels(). Runs of
+          changed rows share one address window. Changing the palette marks
+          every row changed.
+
+          Coordinates passed to flush() are display coordinates, so make
+          the canvas the size of the area it covers at the display's current
+          rotation, and rotate the display rather than the canvas.
+*/
+class GFXcanvas8Palette : public GFXrowCanvas<GFXcanvas8> {
+ public:
+  GFXcanvas8Palette(uint16_t w, uint16_t h);
+  void      setPalette(const uint16_t *colors, uint16_t n = 256,
+              uint8_t first = 0),
+            setPaletteColor(uint8_t index, uint16_t color);
+  uint32_t  flush(Adafruit_SPITFT &tft, int16_t x = 0, int16_t y = 0);
+  /**********************************************************************/
+  /*!
+    @brief    Get the palette
+    @returns  256 16-bit 5-6-5 colors
+  */
+  /**********************************************************************/
+  const uint16_t *getPalette(void) const { return palette; }
+  /**********************************************************************/
+  /*!
+    @brief    Convert a 16-bit 5-6-5 color to its index in the 3-3-2
+              palette the canvas starts out with
+    @param    color  16-bit 5-6-5 color
+    @returns  Palette index, red in the top 3 bits, then green, then blue
+  */
+  /**********************************************************************/
+  static uint8_t color332(uint16_t color) {
+    return ((color >> 8) & 0xE0) | ((color >> 6) & 0x1C) | ((color >> 3) & 0x03);
+  }
+
+ private:
+  void      expandLine(uint16_t *line, int16_t row, int16_t x, int16_t n);
+
+  uint16_t  palette[256];
+};
+
+#endif // _ADAFRUIT_PALETTECANVAS_H_
@@ -0,0 +1,215 @@
+/*!
+ * @file Adafruit_Pixel565.cpp
+ *
+ * Part of Adafruit's GFX graphics library. See Adafruit_Pixel565.h.
+ *
+ * Each function handles two pixels per 32-bit word, unrolled, with the
+ * odd pixel at the end done on its own. Words are loaded and stored with
+ * memcpy() so the runs can start at any pixel: Cortex-M3 and later (and
+ * x86) load and store unaligned words, so it compiles to a plain LDR or
+ * STR, and the byte swap's masks to REV16. Host builds with SSE2 do eight
+ * pixels at a time first. Cortex-M has no NEON, and the word-wide code is
+ * already limited by memory there.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_Pixel565.h"
+#include <string.h>
+#if defined(__SSE2__)
+ #include <emmintrin.h>
+#endif
+
+/// Two pixels from anywhere
+static inline uint32_t load2(const uint16_t *p) {
+    uint32_t w;
+    memcpy(&w, p, 4);
+    return w;
+}
+
+/// Two pixels to anywhere
+static inline void store2(uint16_t *p, uint32_t w) {
+    memcpy(p, &w, 4);
+}
+
+#if defined(__SSE2__)
+/// Eight pixels from anywhere
+static inline __m128i load8(const uint16_t *p) {
+    return _mm_loadu_si128((const __m128i *)p);
+}
+
+/// Eight pixels to anywhere
+static inline void store8(uint16_t *p, __m128i v) {
+    _mm_storeu_si128((__m128i *)p, v);
+}
+#endif
+
+/**************************************************************************/
+/*!
+   @brief    Set a run of pixels to one color
+    @param   dst    Pixels
+    @param   color  16-bit 5-6-5 color
+    @param   n      Number of pixels
+*/
+/**************************************************************************/
+void gfx565Fill(uint16_t *dst, uint16_t color, uint32_t n) {
+    if((color >> 8) == (color & 0xFF)) { // Black, white...
+        memset(dst, color & 0xFF, n * 2);
+        return;
+    }
+#if defined(__SSE2__)
+    __m128i v = _mm_set1_epi16(color);
+    for(; n>=8; n-=8, dst+=8) store8(dst, v);
+#endif
+    uint32_t two = color * 0x00010001UL;
+    for(; n>=8; n-=8, dst+=8) {
+        store2(dst, two);
+        store2(dst + 2, two);
+        store2(dst + 4, two);
+        store2(dst + 6, two);
+    }
+    for(; n>=2; n-=2, dst+=2) store2(dst, two);
+    if(n) *dst = color;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Copy a run of pixels
+    @param   dst  Pixels to set; may overlap src
+    @param   src  Pixels to copy
+    @param   n    Number of pixels
+*/
+/**************************************************************************/
+void gfx565Copy(uint16_t *dst, const uint16_t *src, uint32_t n) {
+    memmove(dst, src, n * 2);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Copy a run of pixels, except those of a transparent color
+    @param   dst  Pixels to set; mustn't overlap src
+    @param   src  Pixels to copy
+    @param   n    Number of pixels
+    @param   key  16-bit 5-6-5 color left out
+*/
+/**************************************************************************/
+void gfx565CopyKey(uint16_t *dst, const uint16_t *src, uint32_t n,
+  uint16_t key) {
+#if defined(__SSE2__)
+    __m128i k = _mm_set1_epi16(key);
+    for(; n>=8; n-=8, src+=8, dst+=8) {
+        __m128i s = load8(src), keep = _mm_cmpeq_epi16(s, k);
+        store8(dst, _mm_or_si128(_mm_and_si128(keep, load8(dst)),
+                                 _mm_andnot_si128(keep, s)));
+    }
+#endif
+    uint32_t keys = key * 0x00010001UL;
+    for(; n>=2; n-=2, src+=2, dst+=2) {
+        uint32_t diff = load2(src) ^ keys;
+        if(!diff) continue;                     // Both transparent
+        if((diff & 0xFFFF) && (diff >> 16)) {   // Neither
+            store2(dst, diff ^ keys);
+        } else {
+            if(src[0] != key) dst[0] = src[0];
+            if(src[1] != key) dst[1] = src[1];
+        }
+    }
+    if(n && (*src != key)) *dst = *src;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Copy a run of pixels, swapping the two bytes of each, e.g. to
+             or from the display's big-endian order
+    @param   dst  Pixels to set; may be src itself, but not overlap it
+                  otherwise
+    @param   src  Pixels to copy
+    @param   n    Number of pixels
+*/
+/**************************************************************************/
+void gfx565Swap(uint16_t *dst, const uint16_t *src, uint32_t n) {
+#if defined(__SSE2__)
+    for(; n>=8; n-=8, src+=8, dst+=8) {
+        __m128i v = load8(src);
+        store8(dst, _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)));
+    }
+#endif
+    for(; n>=4; n-=4, src+=4, dst+=4) {
+        uint32_t a = load2(src), b = load2(src + 2);
+        store2(dst, ((a & 0xFF00FF00UL) >> 8) | ((a & 0x00FF00FFUL) << 8));
+        store2(dst + 2, ((b & 0xFF00FF00UL) >> 8) | ((b & 0x00FF00FFUL) << 8));
+    }
+    for(; n; n--) *dst++ = __builtin_bswap16(*src++);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Mix a run of pixels half and half into another, as
+             gfx565Average() does
+    @param   dst  Pixels to mix into; may be src itself, but not overlap it
+                  otherwise
+    @param   src  Pixels to mix in
+    @param   n    Number of pixels
+*/
+/**************************************************************************/
+void gfx565Blend(uint16_t *dst, const uint16_t *src, uint32_t n) {
+    // The low bit of each of red, green and blue is masked off before
+    // halving, so none spills into the next, or into the other pixel
+#if defined(__SSE2__)
+    __m128i mask = _mm_set1_epi16((short)0xF7DE);
+    for(; n>=8; n-=8, src+=8, dst+=8) {
+        __m128i a = load8(dst), b = load8(src);
+        store8(dst, _mm_add_epi16(_mm_and_si128(a, b), _mm_srli_epi16(
+          _mm_and_si128(_mm_xor_si128(a, b), mask), 1)));
+    }
+#endif
+    for(; n>=2; n-=2, src+=2, dst+=2) {
+        uint32_t a = load2(dst), b = load2(src);
+        store2(dst, (a & b) + (((a ^ b) & 0xF7DEF7DEUL) >> 1));
+    }
+    if(n) *dst = gfx565Average(*dst, *src);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Expand a run of 1-bit pixels, most significant bit on the left
+             as in a GFXcanvas1, to two colors. Bytes all one color are a
+             fill; others go two pixels per word from a table of four.
+    @param   dst    Pixels to set
+    @param   src    Bits
+    @param   first  Bit of src to start at, e.g. a column
+    @param   n      Number of pixels
+    @param   fg     16-bit 5-6-5 color for set bits
+    @param   bg     16-bit 5-6-5 color for clear bits
+*/
+/**************************************************************************/
+void gfx565Expand1(uint16_t *dst, const uint8_t *src, uint32_t first,
+  uint32_t n, uint16_t fg, uint16_t bg) {
+    src += first >> 3;
+    uint8_t bit = first & 7;
+    for(; bit && n; n--) {                  // Up to the next whole byte
+        *dst++ = (*src & (0x80 >> bit)) ? fg : bg;
+        if(++bit == 8) {
+            bit = 0;
+            src++;
+        }
+    }
+
+    uint32_t pairs[4];                      // Two bits to two pixels
+    for(uint8_t i=0; i<4; i++) {
+        uint16_t two[2] = { (i & 2) ? fg : bg, (i & 1) ? fg : bg };
+        memcpy(&pairs[i], two, 4);          // In memory order, any endian
+    }
+    for(; n>=8; n-=8, dst+=8) {
+        uint8_t b = *src++;
+        if(!b || (b == 0xFF)) {
+            gfx565Fill(dst, b ? fg : bg, 8);
+        } else {
+            store2(dst,     pairs[b >> 6]);
+            store2(dst + 2, pairs[(b >> 4) & 3]);
+            store2(dst + 4, pairs[(b >> 2) & 3]);
+            store2(dst + 6, pairs[b & 3]);
+        }
+    }
+    for(bit=0; n; n--, bit++) *dst++ = (*src & (0x80 >> bit)) ? fg : bg;
+}
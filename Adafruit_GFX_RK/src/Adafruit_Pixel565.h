@@ -0,0 +1,42 @@
+/*!
+ * @file Adafruit_Pixel565.h
+ *
+ * Part of Adafruit's GFX graphics library. Bulk operations on runs of
+ * 16-bit 5-6-5 pixels: fill, copy, copy with a transparent key color,
+ * byte swap, 50% blend, and expanding 1-bit pixels to two colors. They
+ * work two pixels per 32-bit word (eight per SSE2 register on a host
+ * build) rather than a pixel at a time, and are what GFXcanvas16's fills
+ * and canvas copies and Adafruit_SPITFT's DMA buffer preparation are
+ * built on.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _ADAFRUIT_PIXEL565_H_
+#define _ADAFRUIT_PIXEL565_H_
+
+#include <stdint.h>
+
+void gfx565Fill(uint16_t *dst, uint16_t color, uint32_t n),
+     gfx565Copy(uint16_t *dst, const uint16_t *src, uint32_t n),
+     gfx565CopyKey(uint16_t *dst, const uint16_t *src, uint32_t n,
+       uint16_t key),
+     gfx565Swap(uint16_t *dst, const uint16_t *src, uint32_t n),
+     gfx565Blend(uint16_t *dst, const uint16_t *src, uint32_t n),
+     gfx565Expand1(uint16_t *dst, const uint8_t *src, uint32_t first,
+       uint32_t n, uint16_t fg, uint16_t bg);
+
+/**************************************************************************/
+/*!
+   @brief    Average two 5-6-5 colors, each of red, green and blue rounded
+             down, the same as gfx565Blend()
+    @param   a  16-bit 5-6-5 color
+    @param   b  16-bit 5-6-5 color
+    @returns The color halfway between
+*/
+/**************************************************************************/
+inline uint16_t gfx565Average(uint16_t a, uint16_t b) {
+  return (a & b) + (((a ^ b) & 0xF7DE) >> 1);
+}
+
+#endif // _ADAFRUIT_PIXEL565_H_
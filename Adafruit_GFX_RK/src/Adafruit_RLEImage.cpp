@@ -0,0 +1,198 @@
+/*!
+ * @file Adafruit_RLEImage.cpp
+ *
+ * Part of Adafruit's GFX graphics library. See Adafruit_RLEImage.h.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_RLEImage.h"
+#ifdef __AVR__
+  #include <avr/pgmspace.h>
+#elif defined(ESP8266) || defined(ESP32)
+  #include <pgmspace.h>
+#endif
+
+#ifndef pgm_read_byte
+ #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#endif
+#ifndef pgm_read_word
+ #define pgm_read_word(addr) (*(const unsigned short *)(addr))
+#endif
+#ifndef pgm_read_dword
+ #define pgm_read_dword(addr) (*(const unsigned long *)(addr))
+#endif
+
+#if !defined(__INT_MAX__) || (__INT_MAX__ > 0xFFFF)
+ #define pgm_read_pointer(addr) ((void *)pgm_read_dword(addr))
+#else
+ #define pgm_read_pointer(addr) ((void *)pgm_read_word(addr))
+#endif
+
+#ifndef min
+ #define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef max
+ #define max(a,b) (((a) > (b)) ? (a) : (b))
+#endif
+
+/*!
+  @brief  Takes an image's pixels in order, drops those off screen and
+          sends the rest through one address window: runs of a color as a
+          single writeWindowColor(), anything else a span at a time. On
+          displays without writeWindow() it draws lines and pixels instead.
+*/
+class GFXrleWriter {
+ public:
+  /*!
+    @brief  Start at the top left of the image
+    @param  gfx     Where to draw
+    @param  x       Left edge of the image on the display
+    @param  y       Top edge of the image on the display
+    @param  w       Image width
+    @param  left    First column of the image on screen
+    @param  right   Last column on screen, plus one
+    @param  top     First row on screen
+    @param  bottom  Last row on screen, plus one
+    @param  window  Whether writeWindow() succeeded for the on-screen part
+  */
+  GFXrleWriter(Adafruit_GFX &gfx, int16_t x, int16_t y, uint16_t w,
+    int16_t left, int16_t right, int16_t top, int16_t bottom, bool window) :
+    gfx(gfx), x(x), y(y), w(w), col(0), row(0), left(left), right(right),
+    top(top), bottom(bottom), window(window), spanLen(0), runLen(0) { }
+
+  /// Whether every pixel that shows has been taken
+  bool done(void) const { return row >= bottom; }
+
+  /*!
+    @brief  Take count pixels of one color
+    @param  color  16-bit 5-6-5 color
+    @param  count  Pixels
+  */
+  void solid(uint16_t color, uint16_t count) {
+    while(count && (row < bottom)) {
+      uint16_t k = min(count, (uint16_t)(w - col));
+      int16_t  a = max((int16_t)col, left), b = min((int16_t)(col + k), right);
+      if((row >= top) && (b > a)) {
+        if(!window) {
+          gfx.writeFastHLine(x + a, y + row, b - a, color);
+        } else {
+          sendSpan();
+          if(runLen && (runColor != color)) sendRun();
+          runColor = color;
+          runLen  += b - a;
+        }
+      }
+      count -= k;
+      if((col += k) == w) { col = 0; row++; }
+    }
+  }
+
+  /*!
+    @brief  Take one pixel
+    @param  color  16-bit 5-6-5 color
+  */
+  void pixel(uint16_t color) {
+    if((row >= top) && (row < bottom) &&
+       ((int16_t)col >= left) && ((int16_t)col < right)) {
+      if(!window) {
+        gfx.writePixel(x + col, y + row, color);
+      } else if(runLen && (runColor == color)) {
+        runLen++;
+      } else {
+        sendRun();
+        span[spanLen++] = color;
+        if(spanLen == GFX_IMAGE_SPAN) sendSpan();
+      }
+    }
+    if(++col == w) { col = 0; row++; }
+  }
+
+  /// Send whatever is waiting
+  void flush(void) {
+    sendSpan();
+    sendRun();
+  }
+
+ private:
+  void sendSpan(void) {
+    if(spanLen) gfx.writeWindowPixels(span, spanLen);
+    spanLen = 0;
+  }
+  void sendRun(void) {
+    if(runLen) gfx.writeWindowColor(runColor, runLen);
+    runLen = 0;
+  }
+
+  Adafruit_GFX &gfx;
+  int16_t  x, y;
+  uint16_t w, col, row;               // Image width, next pixel's place
+  int16_t  left, right, top, bottom;  // On screen part, in image pixels
+  bool     window;
+  uint16_t span[GFX_IMAGE_SPAN];      // Pixels waiting, different colors
+  uint16_t spanLen;
+  uint16_t runColor;                  // Pixels waiting, all one color
+  uint32_t runLen;
+};
+
+/**************************************************************************/
+/*!
+   @brief   Draw a run-length encoded image. The runs are decoded as they
+            are sent, so nothing the size of the image is needed in RAM.
+    @param  x      Top left corner x coordinate
+    @param  y      Top left corner y coordinate
+    @param  image  The image, see GFXrleImage
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawRLEImage(int16_t x, int16_t y,
+  const GFXrleImage *image) {
+    GFX_TRACE(GFX_TRACE_BITMAP);
+    const uint8_t  *p = (const uint8_t *)pgm_read_pointer(&image->data);
+    const uint16_t *palette =
+      (const uint16_t *)pgm_read_pointer(&image->palette);
+    uint16_t w    = pgm_read_word(&image->width),
+             h    = pgm_read_word(&image->height);
+    uint8_t  bits = pgm_read_byte(&image->bits);
+
+    int16_t x0 = max(x, 0), y0 = max(y, 0),
+            x1 = (int16_t)min((int32_t)x + w, (int32_t)_width),
+            y1 = (int16_t)min((int32_t)y + h, (int32_t)_height);
+    if((x0 >= x1) || (y0 >= y1)) return;
+
+    startWrite();
+    GFXrleWriter out(*this, x, y, w, x0 - x, x1 - x, y0 - y, y1 - y,
+      writeWindow(x0, y0, x1 - x0, y1 - y0));
+    while(!out.done()) { // Rows below the screen aren't decoded
+        uint8_t n = pgm_read_byte(p++), count = (n & 0x7F) + 1;
+        if(n & 0x80) {
+            uint16_t color;
+            if(bits == 16) {
+                color = ((uint16_t)pgm_read_byte(p) << 8) |
+                        pgm_read_byte(p + 1);
+                p += 2;
+            } else {
+                uint8_t i = pgm_read_byte(p++);
+                color = pgm_read_word(&palette[(bits == 4) ? (i >> 4) : i]);
+            }
+            out.solid(color, count);
+        } else if(bits == 16) {
+            for(uint8_t i=0; i<count; i++, p+=2) {
+                out.pixel(((uint16_t)pgm_read_byte(p) << 8) |
+                  pgm_read_byte(p + 1));
+            }
+        } else if(bits == 8) {
+            for(uint8_t i=0; i<count; i++) {
+                out.pixel(pgm_read_word(&palette[pgm_read_byte(p++)]));
+            }
+        } else {
+            for(uint8_t i=0; i<count; i++) {
+                uint8_t b = pgm_read_byte(&p[i >> 1]);
+                out.pixel(pgm_read_word(
+                  &palette[(i & 1) ? (b & 0x0F) : (b >> 4)]));
+            }
+            p += (count + 1) / 2;
+        }
+    }
+    out.flush();
+    endWrite();
+}
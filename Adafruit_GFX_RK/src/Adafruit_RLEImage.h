@@ -0,0 +1,44 @@
+/*!
+ * @file Adafruit_RLEImage.h
+ *
+ * Part of Adafruit's GFX graphics library. Compressed images: runs of
+ * pixels, either colors or indexes into a palette of up to 16 or 256
+ * colors, made from BMP files with imageconvert/imageconvert.cpp and drawn
+ * with Adafruit_GFX::drawRLEImage().
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _ADAFRUIT_RLEIMAGE_H_
+#define _ADAFRUIT_RLEIMAGE_H_
+
+#include "Adafruit_GFX.h"
+
+#if !defined(GFX_IMAGE_SPAN)
+ #define GFX_IMAGE_SPAN 64 ///< Pixels of stack drawRLEImage() decodes into
+#endif
+
+/*!
+  @brief  A run-length encoded image.
+
+          The pixels, left to right and top to bottom as one stream with
+          runs carrying on from one row to the next, are stored as
+          packets, each a count byte n and then values:
+
+          - n < 128: n + 1 values, one per pixel;
+          - n >= 128: one value, for n - 127 pixels.
+
+          A value is a 16-bit 5-6-5 color, high byte first, if there's no
+          palette, else an index into it: a byte for 8-bit images, or for
+          4-bit ones a nibble, packed high nibble first from the start of
+          each packet.
+*/
+struct GFXrleImage {
+  const uint8_t  *data;    ///< Packets, as above
+  const uint16_t *palette; ///< 16-bit 5-6-5 colors, NULL for direct color
+  uint16_t width;          ///< Width in pixels
+  uint16_t height;         ///< Height in pixels
+  uint8_t  bits;           ///< Bits per value: 4, 8 or 16
+};
+
+#endif // _ADAFRUIT_RLEIMAGE_H_
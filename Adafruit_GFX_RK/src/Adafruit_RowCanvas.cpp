@@ -0,0 +1,232 @@
+/*!
+ * @file Adafruit_RowCanvas.cpp
+ *
+ * Part of Adafruit's GFX graphics library. See Adafruit_RowCanvas.h.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_RowCanvas.h"
+
+#ifndef min
+#define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef max
+#define max(a,b) (((a) > (b)) ? (a) : (b))
+#endif
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate a row tracking canvas. Every row starts out dirty,
+             as nothing is known about what the display shows.
+    @param   w          Canvas width, in pixels
+    @param   h          Canvas height, in pixels
+    @param   trackRows  True to send only rows drawn on, false to always
+                        send the whole canvas
+*/
+/**************************************************************************/
+template <class Canvas>
+GFXrowCanvas<Canvas>::GFXrowCanvas(uint16_t w, uint16_t h, bool trackRows) :
+  Canvas(w, h) {
+    // Without it, every row is sent
+    rowDirty = trackRows ? (uint8_t *)malloc(h) : NULL;
+    setRotation(0);
+    markAllDirty();
+}
+
+/**************************************************************************/
+/*!
+   @brief    Delete the canvas, free memory
+*/
+/**************************************************************************/
+template <class Canvas>
+GFXrowCanvas<Canvas>::~GFXrowCanvas(void) {
+    if(rowDirty) free(rowDirty);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw a pixel to the canvas framebuffer, marking its row dirty
+    @param  x      x coordinate
+    @param  y      y coordinate
+    @param  color  Color as the canvas takes it
+*/
+/**************************************************************************/
+template <class Canvas>
+void GFXrowCanvas<Canvas>::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if((x < 0) || (y < 0) || (x >= this->_width) || (y >= this->_height))
+        return;
+    Canvas::drawPixel(x, y, color);
+    int32_t row = rowOrigin + x * rowStepX + y * rowStepY;
+    markRows(row, row);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fill the framebuffer completely with one color
+    @param  color  Color as the canvas takes it
+*/
+/**************************************************************************/
+template <class Canvas>
+void GFXrowCanvas<Canvas>::fillScreen(uint16_t color) {
+    Canvas::fillScreen(color);
+    markAllDirty();
+}
+
+/**************************************************************************/
+/*!
+   @brief    Write a perfectly horizontal line, marking the rows it's on
+    @param    x      Left-most x coordinate
+    @param    y      Left-most y coordinate
+    @param    w      Width in pixels, negative to go left
+    @param    color  Color as the canvas takes it
+*/
+/**************************************************************************/
+template <class Canvas>
+void GFXrowCanvas<Canvas>::writeFastHLine(int16_t x, int16_t y, int16_t w,
+  uint16_t color) {
+    int32_t x1 = x, x2 = (int32_t)x + w - 1;
+    if(w < 0) { x1 = (int32_t)x + w + 1; x2 = x; }
+    if(!w || (y < 0) || (y >= this->_height) || (x2 < 0) ||
+      (x1 >= this->_width)) return;
+    Canvas::writeFastHLine(x, y, w, color);
+    x1 = max(x1, (int32_t)0);
+    x2 = min(x2, (int32_t)this->_width - 1);
+    markRows(rowOrigin + x1 * rowStepX + y * rowStepY,
+             rowOrigin + x2 * rowStepX + y * rowStepY);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Write a perfectly vertical line, marking the rows it's on
+    @param    x      Top-most x coordinate
+    @param    y      Top-most y coordinate
+    @param    h      Height in pixels, negative to go up
+    @param    color  Color as the canvas takes it
+*/
+/**************************************************************************/
+template <class Canvas>
+void GFXrowCanvas<Canvas>::writeFastVLine(int16_t x, int16_t y, int16_t h,
+  uint16_t color) {
+    int32_t y1 = y, y2 = (int32_t)y + h - 1;
+    if(h < 0) { y1 = (int32_t)y + h + 1; y2 = y; }
+    if(!h || (x < 0) || (x >= this->_width) || (y2 < 0) ||
+      (y1 >= this->_height)) return;
+    Canvas::writeFastVLine(x, y, h, color);
+    y1 = max(y1, (int32_t)0);
+    y2 = min(y2, (int32_t)this->_height - 1);
+    markRows(rowOrigin + x * rowStepX + y1 * rowStepY,
+             rowOrigin + x * rowStepX + y2 * rowStepY);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Set rotation, and which row pixels are in at it
+    @param  r   Rotation, 0 thru 3
+*/
+/**************************************************************************/
+template <class Canvas>
+void GFXrowCanvas<Canvas>::setRotation(uint8_t r) {
+    Canvas::setRotation(r);
+    int16_t last = this->HEIGHT - 1;
+    switch(this->rotation) {
+        case 0:  rowOrigin = 0;    rowStepX =  0; rowStepY =  1; break;
+        case 1:  rowOrigin = 0;    rowStepX =  1; rowStepY =  0; break;
+        case 2:  rowOrigin = last; rowStepX =  0; rowStepY = -1; break;
+        default: rowOrigin = last; rowStepX = -1; rowStepY =  0; break;
+    }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Make the next flush() send the whole canvas, e.g. when
+            something else drew over that part of the display
+*/
+/**************************************************************************/
+template <class Canvas>
+void GFXrowCanvas<Canvas>::markAllDirty(void) {
+    if(rowDirty) memset(rowDirty, 1, this->HEIGHT);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Forget which rows changed without sending them, e.g. after
+            drawing the same picture straight to the display
+*/
+/**************************************************************************/
+template <class Canvas>
+void GFXrowCanvas<Canvas>::clearDirty(void) {
+    if(rowDirty) memset(rowDirty, 0, this->HEIGHT);
+}
+
+/**************************************************************************/
+/*!
+    @brief   Copy the rows that changed since the last flush to a display,
+             or the whole canvas without row tracking, expanding them with
+             expandLine(). Parts off the display are left out.
+    @param   tft      Display to copy to
+    @param   x        Display column of the canvas' left edge
+    @param   y        Display row of the canvas' top edge
+    @param   line     Buffer for the expanded pixels
+    @param   lineLen  Number of pixels line holds
+    @returns Number of pixels sent
+*/
+/**************************************************************************/
+template <class Canvas>
+uint32_t GFXrowCanvas<Canvas>::flushRows(Adafruit_SPITFT &tft, int16_t x,
+  int16_t y, uint16_t *line, int16_t lineLen) {
+    if(!this->getBuffer()) return 0;
+    int16_t x1 = max(0, -x), x2 = min((int16_t)this->WIDTH,  (int16_t)(tft.width()  - x)),
+            y1 = max(0, -y), y2 = min((int16_t)this->HEIGHT, (int16_t)(tft.height() - y));
+    uint32_t pixels = 0;
+
+    if((x1 < x2) && (y1 < y2)) {
+        int16_t w = x2 - x1;
+        tft.startWrite();
+        for(int16_t row=y1; row<y2; ) {
+            if(rowDirty && !rowDirty[row]) {
+                row++;
+                continue;
+            }
+            int16_t end = row + 1; // Run of changed rows, one window
+            while((end < y2) && (!rowDirty || rowDirty[end])) end++;
+            tft.setAddrWindow(x + x1, y + row, w, end - row);
+            pixels += (uint32_t)w * (end - row);
+            for(; row<end; row++) {
+                for(int16_t done=0; done<w; ) {
+                    int16_t n = min((int16_t)(w - done), lineLen);
+                    expandLine(line, row, x1 + done, n);
+                    tft.writePixels(line, n);
+                    done += n;
+                }
+            }
+        }
+        tft.endWrite();
+    }
+    clearDirty();
+    return pixels;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Mark rows dirty
+    @param  a   One end of the rows, unrotated, may be off the canvas
+    @param  b   The other end
+*/
+/**************************************************************************/
+template <class Canvas>
+void GFXrowCanvas<Canvas>::markRows(int32_t a, int32_t b) {
+    if(!rowDirty) return;
+    if(a > b) {
+        int32_t t = a;
+        a = b;
+        b = t;
+    }
+    if((b < 0) || (a >= this->HEIGHT)) return;
+    a = max(a, (int32_t)0);
+    b = min(b, (int32_t)this->HEIGHT - 1);
+    memset(&rowDirty[a], 1, b - a + 1);
+}
+
+template class GFXrowCanvas<GFXcanvas1>;
+template class GFXrowCanvas<GFXcanvas8>;
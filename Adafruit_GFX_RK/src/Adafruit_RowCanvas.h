@@ -0,0 +1,66 @@
+/*!
+ * @file Adafruit_RowCanvas.h
+ *
+ * Part of Adafruit's GFX graphics library. The row tracking shared by the
+ * canvases that are expanded to 5-6-5 a row at a time as they're sent to
+ * an Adafruit_SPITFT display (GFXcanvas1Mono and GFXcanvas8Palette): a
+ * byte per row saying whether it was drawn on, and a flush that sends runs
+ * of those rows through one address window each.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _ADAFRUIT_ROWCANVAS_H_
+#define _ADAFRUIT_ROWCANVAS_H_
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_SPITFT.h"
+
+/*!
+  @brief  A canvas that remembers which of its rows were drawn on since
+          they were last sent.
+
+          Canvas is GFXcanvas1 or GFXcanvas8 (the two are instantiated in
+          Adafruit_RowCanvas.cpp). Drawing marks the unrotated rows it
+          touches, whatever the rotation; flushRows() sends each run of
+          marked rows through one address window, a line buffer at a time
+          filled by the subclass' expandLine(). Without row tracking every
+          row is sent.
+*/
+template <class Canvas> class GFXrowCanvas : public Canvas {
+ public:
+  GFXrowCanvas(uint16_t w, uint16_t h, bool trackRows = true);
+  ~GFXrowCanvas(void);
+  void      drawPixel(int16_t x, int16_t y, uint16_t color),
+            fillScreen(uint16_t color),
+            writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+            writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
+            setRotation(uint8_t r),
+            markAllDirty(void),
+            clearDirty(void);
+
+ protected:
+  uint32_t  flushRows(Adafruit_SPITFT &tft, int16_t x, int16_t y,
+              uint16_t *line, int16_t lineLen);
+  /**********************************************************************/
+  /*!
+    @brief  Expand part of a row to 16-bit 5-6-5 colors
+    @param  line  Where to put them
+    @param  row   Unrotated row
+    @param  x     Unrotated column of the first pixel
+    @param  n     Number of pixels, no more than the line buffer holds
+  */
+  /**********************************************************************/
+  virtual void expandLine(uint16_t *line, int16_t row, int16_t x,
+              int16_t n) = 0;
+
+ private:
+  void      markRows(int32_t a, int32_t b);
+
+  uint8_t  *rowDirty;    ///< A byte per unrotated row, set if it changed,
+                         ///< NULL to send every row
+  int16_t   rowOrigin, rowStepX, rowStepY; ///< Unrotated row of (x, y) is
+                         ///< rowOrigin + x * rowStepX + y * rowStepY
+};
+
+#endif // _ADAFRUIT_ROWCANVAS_H_
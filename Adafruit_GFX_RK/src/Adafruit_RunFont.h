@@ -0,0 +1,168 @@
+/*!
+ * @file Adafruit_RunFont.h
+ *
+ * Part of Adafruit's GFX graphics library. A GFXfont baked, by the
+ * compiler, into horizontal runs of lit pixels and a tight box per glyph,
+ * so drawChar() draws a line per run instead of unpacking the bitmap a bit
+ * at a time, and getTextBounds() reads the boxes. The baked tables are
+ * constants, kept in flash like the font itself.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _ADAFRUIT_RUNFONT_H_
+#define _ADAFRUIT_RUNFONT_H_
+
+#include <stdint.h>
+#include "gfxfont.h"
+
+/// One run of lit pixels along a glyph row, in font pixels from the
+/// character origin (left end of the baseline)
+typedef struct {
+  int8_t  x;  ///< Left end
+  int8_t  y;  ///< Row
+  uint8_t w;  ///< Length
+} GFXglyphRun;
+
+/// A glyph's runs, advance and tight bounding box
+typedef struct {
+  uint16_t runOffset; ///< Index of its first run in GFXrunFont::run
+  uint8_t  runCount;  ///< Number of runs, 0 for a blank glyph
+  uint8_t  xAdvance;  ///< Distance to advance cursor (x axis)
+  int8_t   x1;        ///< Left edge of the lit pixels, from the origin
+  int8_t   y1;        ///< Top edge of the lit pixels, from the origin
+  uint8_t  w;         ///< Width of the lit pixels, 0 for a blank glyph
+  uint8_t  h;         ///< Height of the lit pixels
+  int8_t   right;     ///< Right edge of the GFXglyph's box, where text wraps
+} GFXrunGlyph;
+
+/// A GFXfont with its glyphs as runs, see GFX_BAKE_FONT()
+typedef struct {
+  const GFXfont     *font;  ///< The font baked, for first, last and yAdvance
+  const GFXrunGlyph *glyph; ///< Glyph array, first to last
+  const GFXglyphRun *run;   ///< Runs of every glyph, one after another
+} GFXrunFont;
+
+#if (__cplusplus >= 201402L) || defined(DOXYGEN)
+
+/// Not defined: a call to it, left in gfxFontRuns() or gfxBakeFont() by a
+/// glyph too big for the baked tables, stops GFX_BAKE_FONT() compiling
+void gfxFontTooBigToBake(void);
+
+/// Baked glyphs and runs of a font of G glyphs and R runs
+template<uint16_t G, uint16_t R> struct GFXbakedFont {
+  GFXrunGlyph glyph[G];        ///< Glyphs
+  GFXglyphRun run[R ? R : 1];  ///< Runs
+};
+
+/**************************************************************************/
+/*!
+    @brief    Count the runs of lit pixels in a font's glyphs, to size
+              the table gfxBakeFont() fills in. Fonts with more than 65535
+              runs don't compile.
+    @param    bitmap  The font's bitmap array, constexpr
+    @param    glyphs  The font's glyph array, constexpr
+    @param    count   Number of glyphs
+    @returns  Number of runs
+*/
+/**************************************************************************/
+constexpr uint16_t gfxFontRuns(const uint8_t *bitmap, const GFXglyph *glyphs,
+  uint16_t count) {
+  uint16_t n = 0;
+  for(uint16_t i=0; i<count; i++) {
+    uint32_t bit = (uint32_t)glyphs[i].bitmapOffset * 8;
+    for(uint8_t yy=0; yy<glyphs[i].height; yy++) {
+      bool prev = false;
+      for(uint8_t xx=0; xx<glyphs[i].width; xx++, bit++) {
+        bool on = bitmap[bit >> 3] & (0x80 >> (bit & 7));
+        if(on && !prev) {
+          if(n == 0xFFFF) gfxFontTooBigToBake();
+          n++;
+        }
+        prev = on;
+      }
+    }
+  }
+  return n;
+}
+
+/**************************************************************************/
+/*!
+    @brief    Bake a font's glyphs into runs and tight boxes. Evaluated by
+              the compiler through GFX_BAKE_FONT(). Runs and boxes are
+              bytes from the character origin, so a glyph reaching more
+              than 127 pixels right of or below it, or with more than 255
+              runs, doesn't compile.
+    @param    bitmap  The font's bitmap array, constexpr
+    @param    glyphs  The font's glyph array, constexpr
+    @returns  The baked glyphs and runs
+*/
+/**************************************************************************/
+template<uint16_t G, uint16_t R>
+constexpr GFXbakedFont<G, R> gfxBakeFont(const uint8_t *bitmap,
+  const GFXglyph *glyphs) {
+  GFXbakedFont<G, R> f{};
+  uint16_t r = 0;
+  for(uint16_t i=0; i<G; i++) {
+    const GFXglyph &g = glyphs[i];
+    if((g.xOffset + g.width > 127) || (g.yOffset + g.height > 128)) {
+      gfxFontTooBigToBake();
+    }
+    int8_t   x1 = 127, y1 = 127, x2 = -128, y2 = -128;
+    uint32_t bit = (uint32_t)g.bitmapOffset * 8;
+    f.glyph[i].runOffset = r;
+    f.glyph[i].xAdvance  = g.xAdvance;
+    f.glyph[i].right     = g.xOffset + g.width;
+    for(uint8_t yy=0; yy<g.height; yy++) {
+      bool prev = false;
+      for(uint8_t xx=0; xx<g.width; xx++, bit++) {
+        bool on = bitmap[bit >> 3] & (0x80 >> (bit & 7));
+        if(on) {
+          if(!prev) { // A run starts
+            f.run[r].x = g.xOffset + xx;
+            f.run[r].y = g.yOffset + yy;
+            f.run[r].w = 0;
+            r++;
+          }
+          f.run[r - 1].w++;
+          int8_t px = g.xOffset + xx, py = g.yOffset + yy;
+          if(px < x1) x1 = px;
+          if(px > x2) x2 = px;
+          if(py < y1) y1 = py;
+          if(py > y2) y2 = py;
+        }
+        prev = on;
+      }
+    }
+    if(r - f.glyph[i].runOffset > 255) gfxFontTooBigToBake();
+    f.glyph[i].runCount = r - f.glyph[i].runOffset;
+    if(f.glyph[i].runCount) {
+      f.glyph[i].x1 = x1;
+      f.glyph[i].y1 = y1;
+      f.glyph[i].w  = x2 - x1 + 1;
+      f.glyph[i].h  = y2 - y1 + 1;
+    }
+  }
+  return f;
+}
+
+/*!
+  @brief  Bake a GFXfont into a GFXrunFont called name, for setRunFont(). The
+          font's bitmap and glyph arrays must be constexpr, as the FreeMono
+          7-bit fonts here are. Needs C++14, which Particle builds with.
+  @param  name    Name of the GFXrunFont to define
+  @param  font    The GFXfont
+  @param  bitmap  Its bitmap array
+  @param  glyphs  Its glyph array
+*/
+#define GFX_BAKE_FONT(name, font, bitmap, glyphs)                         \
+  static constexpr auto name##Baked PROGMEM = gfxBakeFont<               \
+    sizeof(glyphs) / sizeof(glyphs[0]),                                   \
+    gfxFontRuns(bitmap, glyphs, sizeof(glyphs) / sizeof(glyphs[0]))>(     \
+    bitmap, glyphs);                                                      \
+  static const GFXrunFont name PROGMEM = {                               \
+    &font, name##Baked.glyph, name##Baked.run }
+
+#endif // C++14
+
+#endif // _ADAFRUIT_RUNFONT_H_
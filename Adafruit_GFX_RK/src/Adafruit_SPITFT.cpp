@@ -34,6 +34,7 @@
 #if !defined(__AVR_ATtiny85__) // Not for ATtiny, at all
 
 #include "Adafruit_SPITFT.h"
+#include "Adafruit_Pixel565.h"
 
 #if defined(__AVR__)
 #if defined(__AVR_XMEGA__)  //only tested with __AVR_ATmega4809__
@@ -93,11 +94,44 @@
 
 #endif // end USE_SPI_DMA
 
+#if defined(USE_SPI_ASYNC)
+ #define SPITFT_ASYNC_MIN 16 ///< Shorter runs aren't worth a DMA setup
+
+    // Background transfer-in-progress indicator and callback. Particle's
+    // callback gets no arguments, so this is shared by all displays; fine,
+    // as a transfer is always waited for before the next one starts.
+    static volatile bool spi_async_busy = false;
+    static void spi_async_callback(void) {
+        spi_async_busy = false;
+    }
+ #if !defined(SPI_ASYNC_POLL)
+  #define SPI_ASYNC_POLL() ///< Nothing to do while waiting, the DMA runs itself
+ #endif
+ // Any other use of the bus, or change of D/C, has to wait for the
+ // background transfer
+ #define SPI_ASYNC_FENCE() while(spi_async_busy) SPI_ASYNC_POLL()
+#else
+ #define SPI_ASYNC_FENCE() ///< No background transfers, nothing to wait for
+#endif
+
 // Possible values for Adafruit_SPITFT.connection:
 #define TFT_HARD_SPI 0  ///< Display interface = hardware SPI
 #define TFT_SOFT_SPI 1  ///< Display interface = software SPI
 #define TFT_PARALLEL 2  ///< Display interface = 8- or 16-bit parallel
 
+#if defined(SPITFT_TRACE)
+ #define SPITFT_CASET 0x2A ///< MIPI DCS column address set, as on ILI9341 etc.
+ #define SPITFT_PASET 0x2B ///< MIPI DCS page address set
+ #define SPITFT_RAMWR 0x2C ///< MIPI DCS memory write, ends every address window
+ // Charge n to one counter of the primitive being drawn
+ #define TRACE_COUNT(field, n) \
+    if(!traceMute) traceCur.prim[tracePrim].field += (n)
+#else
+ #define TRACE_COUNT(field, n) ///< Bus tracing disabled, nothing to do
+#endif
+
+#define SPITFT_RAMRD 0x2E ///< MIPI DCS memory read, from the address window's start
+
 
 // CONSTRUCTORS ------------------------------------------------------------
 
@@ -544,6 +578,8 @@ void Adafruit_SPITFT::initSPI(uint32_t freq, uint8_t spiMode) {
         hwspi._freq    = freq;    // Save freq value for later
 #endif
         hwspi._mode    = spiMode; // Save spiMode value for later
+        writeFreq      = freq;
+        readFreq       = (freq < SPITFT_READ_SAFE) ? freq : SPITFT_READ_SAFE;
         // Call hwspi._spi->begin() ONLY if this is among the 'established'
         // SPI interfaces in variant.h. For DIY roll-your-own SERCOM SPIs,
         // begin() and pinPeripheral() calls MUST be made in one's calling
@@ -581,6 +617,18 @@ void Adafruit_SPITFT::initSPI(uint32_t freq, uint8_t spiMode) {
         ) {
             hwspi._spi->begin();
         }
+#if defined(USE_SPI_ASYNC)
+        if(!asyncBuf[0]) {
+            // One block holding both buffers, each a scanline on the major
+            // axis. If it can't be had, everything still works, unbuffered.
+            asyncLen = (WIDTH > HEIGHT) ? WIDTH : HEIGHT;
+            if((asyncBuf[0] = (uint16_t *)malloc(asyncLen * 4))) {
+                asyncBuf[1] = asyncBuf[0] + asyncLen;
+            }
+            asyncIdx     = 0;
+            asyncFillLen = 0;
+        }
+#endif
     } else if(connection == TFT_SOFT_SPI) {
 
         pinMode(swspi._mosi, OUTPUT);
@@ -906,6 +954,7 @@ void Adafruit_SPITFT::startWrite(void) {
             for all display types; not an SPI-specific function.
 */
 void Adafruit_SPITFT::endWrite(void) {
+    SPI_ASYNC_FENCE(); // Don't deselect mid-transfer
     if(_cs >= 0) SPI_CS_HIGH();
     SPI_END_TRANSACTION();
 }
@@ -965,6 +1014,7 @@ void Adafruit_SPITFT::writePixels(uint16_t *colors, uint32_t len,
   bool block, bool bigEndian) {
 
     if(!len) return; // Avoid 0-byte transfers
+    TRACE_COUNT(pixelBytes, len * 2);
 
 #if defined(ESP32) // ESP32 has a special SPI pixel-writing function...
     if(connection == TFT_HARD_SPI) {
@@ -1055,13 +1105,50 @@ void Adafruit_SPITFT::writePixels(uint16_t *colors, uint32_t len,
         }
         return;
     }
+#elif defined(USE_SPI_ASYNC)
+    if((connection == TFT_HARD_SPI) && asyncBuf[0] &&
+       (len >= SPITFT_ASYNC_MIN)) {
+        if(!bigEndian) {
+            asyncFillLen = 0; // Buffers are about to be sullied
+            while(len) {
+                uint32_t  count = (len < asyncLen) ? len : asyncLen;
+                uint16_t *buf   = asyncBuf[asyncIdx];
+                // Byte-swap into the buffer that isn't going out right now,
+                // while the other one (the previous span) is
+                gfx565Swap(buf, colors, count);
+                colors += count;
+                SPI_ASYNC_FENCE(); // Wait for the previous span
+                spi_async_busy = true;
+                hwspi._spi->transfer((void *)buf, NULL, count * 2,
+                  spi_async_callback);
+                asyncIdx = 1 - asyncIdx;
+                len     -= count;
+            }
+        } else {
+            // Already in display order, send straight from 'colors'.
+            // If not blocking, it must not change until dmaWait().
+            SPI_ASYNC_FENCE();
+            spi_async_busy = true;
+            hwspi._spi->transfer((void *)colors, NULL, len * 2,
+              spi_async_callback);
+        }
+        if(block) SPI_ASYNC_FENCE();
+        return;
+    }
 #endif // end USE_SPI_DMA
 
     // All other cases (bitbang SPI or non-DMA hard SPI or parallel),
     // use a loop with the normal 16-bit data write function:
+#if defined(SPITFT_TRACE)
+    bool wasMuted = traceMute;
+    traceMute     = true; // Already counted as writePixels() traffic
+#endif
     while(len--) {
         SPI_WRITE16(*colors++);
     }
+#if defined(SPITFT_TRACE)
+    traceMute = wasMuted;
+#endif
 }
 
 /*!
@@ -1071,7 +1158,9 @@ void Adafruit_SPITFT::writePixels(uint16_t *colors, uint32_t len,
             was used (as is the default case).
 */
 void Adafruit_SPITFT::dmaWait(void) {
-#if defined(USE_SPI_DMA)
+#if defined(USE_SPI_ASYNC)
+    SPI_ASYNC_FENCE();
+#elif defined(USE_SPI_DMA)
     while(dma_busy);
  #if defined(__SAMD51__) || defined(_SAMD21_)
     if(connection == TFT_HARD_SPI) {
@@ -1084,6 +1173,49 @@ void Adafruit_SPITFT::dmaWait(void) {
 #endif
 }
 
+/*!
+    @brief  Set up an address window for Adafruit_GFX functions that send
+            a rectangle of pixels at once (see drawChar()). Not self-
+            contained; should follow a startWrite() call.
+    @param  x  Horizontal position of top-left corner, on screen.
+    @param  y  Vertical position of top-left corner, on screen.
+    @param  w  Width in pixels.
+    @param  h  Height in pixels.
+    @return Always true, any SPITFT display can do this.
+*/
+bool Adafruit_SPITFT::writeWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+    setAddrWindow(x, y, w, h);
+    return true;
+}
+
+/*!
+    @brief  Send pixels to the window set by writeWindow(). The colors may
+            be reused on return. On Particle they're copied into the DMA
+            buffers first, so it doesn't wait for the DMA to finish; the
+            next command does. Elsewhere DMA reads them in place, so it
+            waits.
+    @param  colors  Pointer to array of 16-bit pixel values in '565' RGB
+                    format.
+    @param  len     Number of elements in 'colors' array.
+*/
+void Adafruit_SPITFT::writeWindowPixels(uint16_t *colors, uint32_t len) {
+#if defined(USE_SPI_ASYNC)
+    writePixels(colors, len, false);
+#else
+    writePixels(colors, len);
+#endif
+}
+
+/*!
+    @brief  Send pixels all the same color to the window set by
+            writeWindow().
+    @param  color  16-bit pixel color in '565' RGB format.
+    @param  len    Number of pixels.
+*/
+void Adafruit_SPITFT::writeWindowColor(uint16_t color, uint32_t len) {
+    writeColor(color, len);
+}
+
 /*!
     @brief  Issue a series of pixels, all the same color. Not self-
             contained; should follow startWrite() and setAddrWindow() calls.
@@ -1093,6 +1225,7 @@ void Adafruit_SPITFT::dmaWait(void) {
 void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len) {
 
     if(!len) return; // Avoid 0-byte transfers
+    TRACE_COUNT(colorBytes, len * 2);
 
     uint8_t hi = color >> 8, lo = color;
 
@@ -1111,11 +1244,18 @@ void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len) {
             temp[t] = c32;
         }
         // Issue pixels in blocks from temp buffer
+ #if defined(SPITFT_TRACE)
+        bool wasMuted = traceMute;
+        traceMute     = true; // Already counted as writeColor() traffic
+ #endif
         while(len) {                                 // While pixels remain
             xferLen = (bufLen < len) ? bufLen : len; // How many this pass?
             writePixels((uint16_t *)temp, xferLen);
             len -= xferLen;
         }
+ #if defined(SPITFT_TRACE)
+        traceMute = wasMuted;
+ #endif
         return;
     }
 #else  // !ESP32
@@ -1209,6 +1349,35 @@ void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len) {
   #endif // end __SAMD51__
         return;
     }
+ #elif defined(USE_SPI_ASYNC)
+    if((connection == TFT_HARD_SPI) && asyncBuf[0] &&
+       (len >= SPITFT_ASYNC_MIN)) {
+        // Both buffers are one block, so fills go out in chunks of both,
+        // and only what isn't already this color needs filling
+        uint16_t *buf     = asyncBuf[0];
+        uint32_t  maxLen  = asyncLen * 2,
+                  fillLen = (len < maxLen) ? len : maxLen;
+        SPI_ASYNC_FENCE(); // A writePixels() span may still be going out
+        if(color != asyncFillColor) asyncFillLen = 0;
+        if(fillLen > asyncFillLen) {
+            gfx565Fill(&buf[asyncFillLen], __builtin_bswap16(color),
+              fillLen - asyncFillLen);
+        }
+        if(fillLen > asyncFillLen) asyncFillLen = fillLen;
+        asyncFillColor = color;
+
+        while(len) {
+            uint32_t count = (len < maxLen) ? len : maxLen;
+            SPI_ASYNC_FENCE();
+            spi_async_busy = true;
+            hwspi._spi->transfer((void *)buf, NULL, count * 2,
+              spi_async_callback);
+            len -= count;
+        }
+        // Blocking, so writePixels() can have either buffer right away
+        SPI_ASYNC_FENCE();
+        return;
+    }
  #endif // end USE_SPI_DMA
 #endif // end !ESP32
 
@@ -1480,6 +1649,7 @@ inline void Adafruit_SPITFT::writeFillRectPreclipped(int16_t x, int16_t y,
     @param  color  16-bit pixel color in '565' RGB format.
 */
 void Adafruit_SPITFT::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    GFX_TRACE(GFX_TRACE_PIXEL);
     // Clip first...
     if((x >= 0) && (x < _width) && (y >= 0) && (y < _height)) {
         // THEN set up transaction (if needed) and draw...
@@ -1511,6 +1681,7 @@ void Adafruit_SPITFT::drawPixel(int16_t x, int16_t y, uint16_t color) {
 */
 void Adafruit_SPITFT::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
   uint16_t color) {
+    GFX_TRACE(GFX_TRACE_FILLRECT);
     if(w && h) {                            // Nonzero width and height?
         if(w < 0) {                         // If negative width...
             x +=  w + 1;                    //   Move X to left edge
@@ -1559,6 +1730,7 @@ void Adafruit_SPITFT::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
 */
 void Adafruit_SPITFT::drawFastHLine(int16_t x, int16_t y, int16_t w,
   uint16_t color) {
+    GFX_TRACE(GFX_TRACE_HLINE);
     if((y >= 0) && (y < _height) && w) { // Y on screen, nonzero width
         if(w < 0) {                      // If negative width...
             x +=  w + 1;                 //   Move X to left edge
@@ -1595,6 +1767,7 @@ void Adafruit_SPITFT::drawFastHLine(int16_t x, int16_t y, int16_t w,
 */
 void Adafruit_SPITFT::drawFastVLine(int16_t x, int16_t y, int16_t h,
   uint16_t color) {
+    GFX_TRACE(GFX_TRACE_VLINE);
     if((x >= 0) && (x < _width) && h) { // X on screen, nonzero height
         if(h < 0) {                     // If negative height...
             y +=  h + 1;                //   Move Y to top edge
@@ -1622,6 +1795,7 @@ void Adafruit_SPITFT::drawFastVLine(int16_t x, int16_t y, int16_t h,
     @param  color  16-bit pixel color in '565' RGB format.
 */
 void Adafruit_SPITFT::pushColor(uint16_t color) {
+    GFX_TRACE(GFX_TRACE_PIXEL);
     startWrite();
     SPI_WRITE16(color);
     endWrite();
@@ -1645,6 +1819,7 @@ void Adafruit_SPITFT::pushColor(uint16_t color) {
 */
 void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y,
   uint16_t *pcolors, int16_t w, int16_t h) {
+    GFX_TRACE(GFX_TRACE_RGBBITMAP);
 
     int16_t x2, y2; // Lower-right coord
     if(( x             >= _width ) ||      // Off-edge right
@@ -1671,7 +1846,15 @@ void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y,
     startWrite();
     setAddrWindow(x, y, w, h); // Clipped area
     while(h--) { // For each (clipped) scanline...
+#if defined(USE_SPI_ASYNC)
+      // Not blocking: the row is swapped into the other async buffer
+      // while the one before goes out, and endWrite() waits for the last
+      writePixels(pcolors, w, false); // Push one (clipped) row
+#else
+      // Blocking: SAMD DMA restarts at pixelBuf[0] on every call, and
+      // endWrite() doesn't wait for it
       writePixels(pcolors, w); // Push one (clipped) row
+#endif
       pcolors += saveW; // Advance pointer by one full (unclipped) line
     }
     endWrite();
@@ -1716,7 +1899,9 @@ void Adafruit_SPITFT::sendCommand(uint8_t commandByte, uint8_t *dataBytes, uint8
     SPI_BEGIN_TRANSACTION();
     if(_cs >= 0) SPI_CS_LOW();
   
+    SPI_ASYNC_FENCE(); // Pixels still going out are data
     SPI_DC_LOW(); // Command mode
+    TRACE_COUNT(commands, 1);
     spiWrite(commandByte); // Send the command byte
   
     SPI_DC_HIGH();
@@ -1727,6 +1912,7 @@ void Adafruit_SPITFT::sendCommand(uint8_t commandByte, uint8_t *dataBytes, uint8
   
     if(_cs >= 0) SPI_CS_HIGH();
     SPI_END_TRANSACTION();
+    invalidateAddrWindow(); // Could have been anything
 }
 
 /*!
@@ -1739,7 +1925,9 @@ void Adafruit_SPITFT::sendCommand(uint8_t commandByte, const uint8_t *dataBytes,
     SPI_BEGIN_TRANSACTION();
     if(_cs >= 0) SPI_CS_LOW();
   
+    SPI_ASYNC_FENCE(); // Pixels still going out are data
     SPI_DC_LOW(); // Command mode
+    TRACE_COUNT(commands, 1);
     spiWrite(commandByte); // Send the command byte
   
     SPI_DC_HIGH();
@@ -1749,6 +1937,7 @@ void Adafruit_SPITFT::sendCommand(uint8_t commandByte, const uint8_t *dataBytes,
   
     if(_cs >= 0) SPI_CS_HIGH();
     SPI_END_TRANSACTION();
+    invalidateAddrWindow(); // Could have been anything
 }
 
 /*!
@@ -1764,17 +1953,242 @@ void Adafruit_SPITFT::sendCommand(uint8_t commandByte, const uint8_t *dataBytes,
 /**************************************************************************/
 uint8_t Adafruit_SPITFT::readcommand8(uint8_t commandByte, uint8_t index) {
   uint8_t result;
+  useReadClock(true);
   startWrite();
+  SPI_ASYNC_FENCE(); // Pixels still going out are data
   SPI_DC_LOW();     // Command mode
+  TRACE_COUNT(commands, 1);
   spiWrite(commandByte);
   SPI_DC_HIGH();    // Data mode
   do {
     result = spiRead();
   } while(index--); // Discard bytes up to index'th
   endWrite();
+  useReadClock(false);
+  invalidateAddrWindow();
   return result;
 }
 
+/*!
+    @brief  Set the hardware SPI clocks, e.g. from a datasheet. Reads are
+            slower than writes on most controllers.
+    @param  writeFreq  Clock for commands and pixels, in Hz.
+    @param  readFreq   Clock for readcommand8() and reading pixels, in Hz.
+*/
+void Adafruit_SPITFT::setSPISpeed(uint32_t writeFreq, uint32_t readFreq) {
+    this->writeFreq = writeFreq;
+    this->readFreq  = readFreq;
+    useReadClock(false);
+}
+
+/*!
+    @brief   Use clocks calibrateSPI() found on an earlier boot, which saves
+             doing it again. Call after begin().
+    @param   speed  As filled in by calibrateSPI().
+    @return  true if they were used, false if speed was never calibrated
+             (e.g. EEPROM that was never written) or isn't hardware SPI.
+*/
+bool Adafruit_SPITFT::setBusSpeed(const SPITFT_BusSpeed &speed) {
+    if((connection != TFT_HARD_SPI) || (speed.magic != SPITFT_SPEED_MAGIC) ||
+       !speed.writeFreq || (speed.writeFreq > SPITFT_CALIBRATE_MAX) ||
+       !speed.readFreq || (speed.readFreq > SPITFT_CALIBRATE_MAX)) {
+        return false;
+    }
+    setSPISpeed(speed.writeFreq, speed.readFreq);
+    return true;
+}
+
+/*!
+    @brief   Find the fastest clocks this display and its wiring work at.
+             Raises the write clock a step at a time, writing a test
+             pattern and reading it back with RAMRD at SPITFT_READ_SAFE,
+             until a step fails; then does the same with the read clock.
+             Each step has to pass SPITFT_CALIBRATE_PASSES times in a row,
+             and the clocks kept are a step below the last that passed (or
+             the slowest step), for a margin against temperature and
+             supply changes once they're saved.
+             Takes a fraction of a second and draws over the top row's
+             first SPITFT_CALIBRATE_PIXELS pixels, so call it after begin()
+             and before drawing the screen. Needs the display's MISO (SDO)
+             line connected.
+    @param   speed  Filled in with the clocks found, to keep for
+                    setBusSpeed() on the next boot.
+    @return  true if both clocks were found and are now used. false if even
+             the slowest step failed, e.g. with nothing on MISO, and the
+             clocks are unchanged.
+*/
+bool Adafruit_SPITFT::calibrateSPI(SPITFT_BusSpeed *speed) {
+    static const uint32_t clocks[] = {
+        4000000, 6000000, 8000000, 12000000, 16000000, 20000000, 24000000,
+        32000000, 40000000, 50000000, 60000000, 80000000 };
+    if(connection != TFT_HARD_SPI) return false;
+    uint32_t oldWrite = writeFreq, oldRead = readFreq, write = 0, read = 0;
+    int8_t   last = -1; // Fastest step that passed
+
+    readFreq = SPITFT_READ_SAFE;
+    for(uint8_t i=0; (i<sizeof clocks/sizeof clocks[0]) &&
+      (clocks[i] <= SPITFT_CALIBRATE_MAX); i++) {
+        writeFreq = clocks[i];
+        if(!busTest()) break;
+        last = i;
+    }
+    if(last >= 0) {
+        write = clocks[last ? (last - 1) : 0]; // A step of margin
+        writeFreq = write;
+        last = -1;
+        for(uint8_t i=0; (i<sizeof clocks/sizeof clocks[0]) &&
+          (clocks[i] <= SPITFT_CALIBRATE_MAX); i++) {
+            readFreq = clocks[i];
+            if(!busTest()) break;
+            last = i;
+        }
+        if(last >= 0) read = clocks[last ? (last - 1) : 0];
+    }
+    if(!read) {
+        setSPISpeed(oldWrite, oldRead);
+        return false;
+    }
+    setSPISpeed(write, read);
+    speed->magic     = SPITFT_SPEED_MAGIC;
+    speed->writeFreq = write;
+    speed->readFreq  = read;
+    return true;
+}
+
+/*!
+    @brief   Write a test pattern, and its inverse, at the write clock and
+             check they read back at the read clock, SPITFT_CALIBRATE_PASSES
+             times.
+    @return  true if every one came back intact.
+*/
+bool Adafruit_SPITFT::busTest(void) {
+    uint16_t pattern[SPITFT_CALIBRATE_PIXELS], back[SPITFT_CALIBRATE_PIXELS];
+    for(uint8_t i=0; i<SPITFT_CALIBRATE_PIXELS; i++) {
+        // Alternating bits, walking ones, all set, then pseudo-random
+        pattern[i] = (i < 2) ? (0xAAAA >> i) : (i < 18) ? (1 << (i - 2)) :
+                     (i == 18) ? 0xFFFF : (uint16_t)(i * 0x9E37);
+    }
+    useReadClock(false); // Just changed
+    for(uint8_t pass=0; pass<2*SPITFT_CALIBRATE_PASSES; pass++) {
+        if(pass) {
+            for(uint8_t i=0; i<SPITFT_CALIBRATE_PIXELS; i++) pattern[i] ^= 0xFFFF;
+        }
+        startWrite();
+        setAddrWindow(0, 0, SPITFT_CALIBRATE_PIXELS, 1);
+        writePixels(pattern, SPITFT_CALIBRATE_PIXELS);
+        endWrite();
+        readPixels(0, 0, SPITFT_CALIBRATE_PIXELS, 1, back);
+        if(memcmp(pattern, back, sizeof pattern)) return false;
+    }
+    return true;
+}
+
+/*!
+    @brief  Read pixels from display memory with RAMRD, at the read clock.
+            The controller sends 18-bit color, a byte each for red, green
+            and blue with the value in the top bits, converted here to 565.
+            Self-contained, no transaction setup required; an area partly
+            off the display is read a row at a time.
+    @param  x    Left edge, on the display at its rotation.
+    @param  y    Top edge.
+    @param  w    Width.
+    @param  h    Height.
+    @param  dst  Filled with w * h pixels, a row at a time; 0 for any off
+                 the display.
+*/
+void Adafruit_SPITFT::readPixels(int16_t x, int16_t y, int16_t w, int16_t h,
+  uint16_t *dst) {
+    if((w <= 0) || (h <= 0)) return;
+    int32_t x1 = (x < 0) ? 0 : x, y1 = (y < 0) ? 0 : y,
+            x2 = ((int32_t)x + w > _width)  ? _width  : ((int32_t)x + w),
+            y2 = ((int32_t)y + h > _height) ? _height : ((int32_t)y + h);
+    if((x1 != x) || (y1 != y) || (x2 != x + w) || (y2 != y + h)) {
+        memset(dst, 0, (uint32_t)w * h * 2);
+        if(x1 < x2) {
+            for(int32_t row=y1; row<y2; row++) {
+                readPixels(x1, row, x2 - x1, 1,
+                  &dst[(row - y) * w + (x1 - x)]);
+            }
+        }
+        return;
+    }
+    startWrite();
+    setAddrWindow(x, y, w, h); // Ends with RAMWR, which nothing follows
+    endWrite();
+    useReadClock(true);
+    startWrite();
+    writeCommand(SPITFT_RAMRD);
+    spiRead(); // Dummy byte first
+    for(uint32_t i=0, n=(uint32_t)w * h; i<n; i++) {
+        uint8_t r = spiRead(), g = spiRead(), b = spiRead();
+        dst[i] = color565(r, g, b);
+    }
+    endWrite();
+    useReadClock(false);
+}
+
+/*!
+    @brief   Write what the display shows, at its rotation, as a 24-bit BMP
+             file, e.g. to an open SD card file or to Serial. Reads
+             SPITFT_SHOT_CHUNK pixels at a time, each in a transaction of
+             its own, and writes them out before reading more, so it needs
+             no frame buffer and an SD card on the same bus gets it between
+             reads.
+    @param   out  Where the file goes.
+    @return  true if all of it was written, false if out took less.
+*/
+bool Adafruit_SPITFT::writeScreenshot(Print &out) {
+    uint16_t w = _width, h = _height, pad = (4 - ((w * 3) & 3)) & 3;
+    uint32_t size = (uint32_t)(w * 3 + pad) * h;
+    const uint32_t fields[][2] = { // Offset and value, the rest are 0
+        { 2, 54 + size }, { 10, 54 }, { 14, 40 }, { 18, w }, { 22, h },
+        { 26, 1 | (24 << 16) }, { 34, size }, { 38, 2835 }, { 42, 2835 } };
+    uint8_t  header[54] = { 'B', 'M' };
+    for(uint8_t i=0; i<sizeof fields/sizeof fields[0]; i++) {
+        for(uint8_t b=0; b<4; b++) { // Little-endian
+            header[fields[i][0] + b] = fields[i][1] >> (b * 8);
+        }
+    }
+    if(out.write(header, sizeof header) != sizeof header) return false;
+
+    uint16_t pixels[SPITFT_SHOT_CHUNK];
+    uint8_t  bytes[SPITFT_SHOT_CHUNK * 3];
+    for(int16_t y=h-1; y>=0; y--) { // Bottom row first
+        for(int16_t x=0; x<w; x+=SPITFT_SHOT_CHUNK) {
+            uint16_t n = ((w - x) < SPITFT_SHOT_CHUNK) ? (w - x) :
+                         SPITFT_SHOT_CHUNK;
+            readPixels(x, y, n, 1, pixels);
+            for(uint16_t i=0; i<n; i++) { // Blue, green, red, low bits filled
+                uint16_t c = pixels[i];
+                bytes[i * 3]     = (c << 3) | ((c >> 2) & 0x07);
+                bytes[i * 3 + 1] = ((c >> 3) & 0xFC) | ((c >> 9) & 0x03);
+                bytes[i * 3 + 2] = ((c >> 8) & 0xF8) | (c >> 13);
+            }
+            if(out.write(bytes, n * 3) != (size_t)(n * 3)) return false;
+        }
+        if(pad) {
+            const uint8_t zeros[3] = { 0 };
+            if(out.write(zeros, pad) != pad) return false;
+        }
+    }
+    return true;
+}
+
+/*!
+    @brief  Switch the hardware SPI clock between the read and write ones,
+            for the next transaction.
+    @param  read  true for the read clock, false for the write clock.
+*/
+void Adafruit_SPITFT::useReadClock(bool read) {
+    if(connection != TFT_HARD_SPI) return;
+    uint32_t freq = read ? readFreq : writeFreq;
+#if defined(SPI_HAS_TRANSACTION)
+    hwspi.settings = SPISettings(freq, MSBFIRST, hwspi._mode);
+#else
+    hwspi._freq    = freq;
+#endif
+}
+
 // -------------------------------------------------------------------------
 // Lowest-level hardware-interfacing functions. Many of these are inline and
 // compile to different things based on #defines -- typically just a few
@@ -1790,6 +2204,7 @@ uint8_t Adafruit_SPITFT::readcommand8(uint8_t commandByte, uint8_t index) {
             encapsulated both actions.
 */
 inline void Adafruit_SPITFT::SPI_BEGIN_TRANSACTION(void) {
+    TRACE_COUNT(transactions, 1);
     if(connection == TFT_HARD_SPI) {
 #if defined(SPI_HAS_TRANSACTION)
         hwspi._spi->beginTransaction(hwspi.settings);
@@ -1835,7 +2250,9 @@ inline void Adafruit_SPITFT::SPI_END_TRANSACTION(void) {
     @param  b  8-bit value to write.
 */
 void Adafruit_SPITFT::spiWrite(uint8_t b) {
+    TRACE_COUNT(spiWriteBytes, 1);
     if(connection == TFT_HARD_SPI) {
+        SPI_ASYNC_FENCE();
 #if defined(__AVR__)
         AVR_WRITESPI(b);
 #elif defined(ESP8266) || defined(ESP32)
@@ -1871,6 +2288,12 @@ void Adafruit_SPITFT::spiWrite(uint8_t b) {
     @param  cmd  8-bit command to write.
 */
 void Adafruit_SPITFT::writeCommand(uint8_t cmd) {
+#if defined(SPITFT_TRACE)
+    TRACE_COUNT(commands, 1);
+    if(cmd == SPITFT_RAMWR) TRACE_COUNT(windows, 1);
+    traceCmd = cmd;
+#endif
+    SPI_ASYNC_FENCE(); // Pixels still going out are data, not this command
     SPI_DC_LOW();
     spiWrite(cmd);
     SPI_DC_HIGH();
@@ -1890,6 +2313,7 @@ uint8_t Adafruit_SPITFT::spiRead(void) {
     uint8_t  b = 0;
     uint16_t w = 0;
     if(connection == TFT_HARD_SPI) {
+        SPI_ASYNC_FENCE();
         return hwspi._spi->transfer((uint8_t)0);
     } else if(connection == TFT_SOFT_SPI) {
         if(swspi._miso >= 0) {
@@ -2062,7 +2486,9 @@ inline bool Adafruit_SPITFT::SPI_MISO_READ(void) {
     @param  w  16-bit value to write.
 */
 void Adafruit_SPITFT::SPI_WRITE16(uint16_t w) {
+    TRACE_COUNT(write16Bytes, 2);
     if(connection == TFT_HARD_SPI) {
+        SPI_ASYNC_FENCE();
 #if defined(__AVR__)
         AVR_WRITESPI(w >> 8);
         AVR_WRITESPI(w);
@@ -2109,7 +2535,12 @@ void Adafruit_SPITFT::SPI_WRITE16(uint16_t w) {
     @param  l  32-bit value to write.
 */
 void Adafruit_SPITFT::SPI_WRITE32(uint32_t l) {
+#if defined(SPITFT_TRACE)
+    TRACE_COUNT(write32Bytes, 4);
+    traceRange(l);
+#endif
     if(connection == TFT_HARD_SPI) {
+        SPI_ASYNC_FENCE();
 #if defined(__AVR__)
         AVR_WRITESPI(l >> 24);
         AVR_WRITESPI(l >> 16);
@@ -2215,4 +2646,159 @@ inline void Adafruit_SPITFT::TFT_RD_LOW(void) {
 #endif // end !USE_FAST_PINIO
 }
 
+// -------------------------------------------------------------------------
+// Bus tracing. Compiled only with SPITFT_TRACE defined, see the notes at
+// the top of Adafruit_SPITFT.h.
+
+#if defined(SPITFT_TRACE)
+
+static const char * const traceNames[GFX_TRACE_COUNT] = {
+    "other", "drawPixel", "drawFastHLine", "drawFastVLine", "drawLine",
+    "drawRect", "fillRect", "fillScreen", "drawCircle", "fillCircle",
+    "drawTriangle", "fillTriangle", "drawRoundRect", "fillRoundRect",
+    "fillPolygon", "drawBitmap", "drawRGBBitmap", "drawChar"
+};
+
+// Right-align a number in a column of the given width
+static void tracePrintColumn(Print &out, uint32_t value, uint8_t width) {
+    uint8_t digits = 1;
+    for(uint32_t v=value; v >= 10; v /= 10) digits++;
+    while(width-- > digits) out.print(' ');
+    out.print(value);
+}
+
+/*!
+    @brief  Clear the frame in progress and all saved frames, and restart
+            frame numbering from zero.
+*/
+void Adafruit_SPITFT::traceReset(void) {
+    memset(&traceCur, 0, sizeof(traceCur));
+    traceHead  = traceCount = 0;
+    traceCaset = tracePaset = 0xFFFFFFFF;
+    traceStart = micros();
+}
+
+/*!
+    @brief  End the current frame: save its counts in the ring buffer
+            (overwriting the oldest once SPITFT_TRACE_FRAMES are kept),
+            optionally print a report, and start counting the next frame.
+    @param  out  Where to print the report (e.g. &Serial), or NULL to only
+                 save the frame for later traceHistory() access.
+*/
+void Adafruit_SPITFT::traceFrame(Print *out) {
+    uint32_t now = micros();
+
+    traceCur.micros      = now - traceStart;
+    traceRing[traceHead] = traceCur;
+    if(out) traceReport(*out, traceCur);
+    traceHead = (traceHead + 1) % SPITFT_TRACE_FRAMES;
+    if(traceCount < SPITFT_TRACE_FRAMES) traceCount++;
+
+    uint32_t next = traceCur.frame + 1;
+    memset(&traceCur, 0, sizeof(traceCur));
+    traceCur.frame = next;
+    traceStart     = now;
+}
+
+/*!
+    @brief   Get a frame saved by traceFrame().
+    @param   age  0 for the most recently completed frame, 1 for the one
+                  before that, and so on.
+    @return  Pointer to the frame, or NULL if that many aren't saved.
+*/
+const SPITFT_TraceFrame *Adafruit_SPITFT::traceHistory(uint8_t age) const {
+    if(age >= traceCount) return NULL;
+    return &traceRing[(traceHead + SPITFT_TRACE_FRAMES - 1 - age) %
+      SPITFT_TRACE_FRAMES];
+}
+
+/*!
+    @brief   Total bytes on the wire for one set of counts.
+    @param   c  Counts for one primitive.
+    @return  Bytes, commands and address windows included.
+*/
+uint32_t Adafruit_SPITFT::traceBytes(const SPITFT_TraceCounts &c) {
+    return c.spiWriteBytes + c.write16Bytes + c.write32Bytes +
+      c.colorBytes + c.pixelBytes;
+}
+
+/*!
+    @brief  Print one frame as a table, one row per primitive that did
+            anything, worst offenders easy to spot in the 'bytes' and
+            'repeat' (wasted address window bytes) columns.
+    @param  out    Where to print, e.g. Serial.
+    @param  frame  Frame from traceCurrent() or traceHistory().
+*/
+void Adafruit_SPITFT::traceReport(Print &out, const SPITFT_TraceFrame &frame) {
+    static const uint8_t widths[] = { 8, 7, 8, 8, 7, 9, 9, 8, 8, 9, 9 };
+    SPITFT_TraceCounts   total;
+
+    memset(&total, 0, sizeof(total));
+    out.print("Frame ");
+    out.print(frame.frame);
+    out.print(", ");
+    out.print(frame.micros);
+    out.println(" us");
+    out.println("primitive        calls  xfers    cmds windows repeat"
+      "    bytes spiWrite write16 write32    color   pixels");
+
+    for(uint8_t p=0; p<=GFX_TRACE_COUNT; p++) {
+        const SPITFT_TraceCounts &c = (p < GFX_TRACE_COUNT) ?
+          frame.prim[p] : total;
+        uint32_t bytes = traceBytes(c);
+        if(!c.calls && !bytes) continue;
+
+        const char *name = (p < GFX_TRACE_COUNT) ? traceNames[p] : "total";
+        out.print(name);
+        for(size_t n=strlen(name); n<13; n++) out.print(' ');
+        uint32_t cols[] = { c.calls, c.transactions, c.commands, c.windows,
+          c.repeatBytes, bytes, c.spiWriteBytes, c.write16Bytes,
+          c.write32Bytes, c.colorBytes, c.pixelBytes };
+        for(uint8_t i=0; i<sizeof(widths); i++) {
+            tracePrintColumn(out, cols[i], widths[i]);
+        }
+        out.println();
+
+        if(p < GFX_TRACE_COUNT) {
+            total.calls         += c.calls;
+            total.transactions  += c.transactions;
+            total.commands      += c.commands;
+            total.windows       += c.windows;
+            total.repeatBytes   += c.repeatBytes;
+            total.spiWriteBytes += c.spiWriteBytes;
+            total.write16Bytes  += c.write16Bytes;
+            total.write32Bytes  += c.write32Bytes;
+            total.colorBytes    += c.colorBytes;
+            total.pixelBytes    += c.pixelBytes;
+        }
+    }
+}
+
+/*!
+    @brief  Count a call of an outermost primitive (see GFXTraceScope).
+    @param  prim  GFX_TRACE_* id.
+*/
+void Adafruit_SPITFT::tracePrimitive(uint8_t prim) {
+    traceCur.prim[prim].calls++;
+}
+
+/*!
+    @brief  Spot CASET/PASET ranges that match what the display already
+            has. Only sees ranges sent as one SPI_WRITE32() (as ILI9341
+            does); displays sending two SPI_WRITE16()s won't report repeats.
+    @param  range  32-bit value just written.
+*/
+void Adafruit_SPITFT::traceRange(uint32_t range) {
+    if(traceCmd == SPITFT_CASET) {
+        if(range == traceCaset) TRACE_COUNT(repeatBytes, 5); // Cmd + range
+        traceCaset = range;
+    } else if(traceCmd == SPITFT_PASET) {
+        if(range == tracePaset) TRACE_COUNT(repeatBytes, 5);
+        tracePaset = range;
+    }
+    traceCmd = 0; // Anything else written after this isn't a range
+}
+
+#endif // end SPITFT_TRACE
+
 #endif // end __AVR_ATtiny85__
@@ -71,6 +71,34 @@ typedef volatile  ADAGFX_PORT_t* PORTreg_t; ///< PORT register type
  #define DEFAULT_SPI_FREQ 16000000L  ///< Hardware SPI default speed
 #endif
 
+// calibrateSPI() raises the write clock until a test pattern no longer
+// reads back intact SPITFT_CALIBRATE_PASSES times in a row, then does the
+// same for the read clock, and keeps a step below the last that passed of
+// each. Writes are checked at SPITFT_READ_SAFE, about what the ILI9341
+// datasheet's 150 ns read cycle allows; it's also the read clock until one
+// is calibrated.
+#if !defined(SPITFT_CALIBRATE_MAX)
+ #define SPITFT_CALIBRATE_MAX 80000000L ///< Fastest clock calibrateSPI() tries
+#endif
+#if !defined(SPITFT_READ_SAFE)
+ #define SPITFT_READ_SAFE      6000000L ///< Read clock before calibration
+#endif
+#if !defined(SPITFT_CALIBRATE_PASSES)
+ #define SPITFT_CALIBRATE_PASSES 4 ///< Round trips a clock must pass in a row
+#endif
+#define SPITFT_CALIBRATE_PIXELS 64       ///< Test pattern length, one row
+#if !defined(SPITFT_SHOT_CHUNK)
+ #define SPITFT_SHOT_CHUNK 64 ///< Pixels writeScreenshot() reads at a time
+#endif
+#define SPITFT_SPEED_MAGIC  0x53504431UL ///< Marks a calibrated SPITFT_BusSpeed
+
+/// Clocks found by calibrateSPI(), to keep (e.g. in EEPROM) for setBusSpeed()
+typedef struct {
+  uint32_t magic;     ///< SPITFT_SPEED_MAGIC once calibrated
+  uint32_t writeFreq; ///< Fastest write clock that passed
+  uint32_t readFreq;  ///< Fastest read clock that passed
+} SPITFT_BusSpeed;
+
 #if defined(ADAFRUIT_PYPORTAL) || defined(ADAFRUIT_PYBADGE_M4_EXPRESS) || defined(ADAFRUIT_PYGAMER_M4_EXPRESS)
  #define USE_SPI_DMA                 ///< Auto DMA if using PyPortal
 #else
@@ -90,6 +118,48 @@ typedef volatile  ADAGFX_PORT_t* PORTreg_t; ///< PORT register type
  #include <Adafruit_ZeroDMA.h>
 #endif
 
+// Particle's SPI.transfer() takes a completion callback and runs the
+// transfer by DMA in the background, so writePixels() and writeColor() use
+// that through a pair of scanline buffers (4 bytes/pixel on the display
+// major axis, e.g. 1,280 bytes for 320x240). Define SPITFT_NO_ASYNC to use
+// plain byte-at-a-time transfers instead.
+#if defined(PARTICLE) && !defined(SPITFT_NO_ASYNC)
+ #define USE_SPI_ASYNC               ///< Background DMA via SPI.transfer()
+#endif
+
+// Define SPITFT_TRACE (project-wide, it changes Adafruit_GFX too) to count
+// the bus traffic of each GFX primitive: commands, address windows and
+// bytes through spiWrite(), SPI_WRITE16(), SPI_WRITE32(), writeColor() and
+// writePixels(). Call traceFrame() once per frame to keep the last few
+// frames in a ring buffer and/or print a report. Each saved frame costs
+// about 0.7K of RAM, so leave this off in production builds.
+#if defined(SPITFT_TRACE)
+ #if !defined(SPITFT_TRACE_FRAMES)
+  #define SPITFT_TRACE_FRAMES 4 ///< Completed frames kept by traceFrame()
+ #endif
+
+/// Bus traffic charged to one primitive (one GFX_TRACE_* id)
+typedef struct {
+  uint32_t calls;         ///< Outermost calls of the primitive
+  uint32_t transactions;  ///< SPI transactions started
+  uint32_t commands;      ///< Command bytes (D/C low)
+  uint32_t windows;       ///< Address windows set (RAMWR commands)
+  uint32_t repeatBytes;   ///< CASET/PASET bytes re-sending an unchanged range
+  uint32_t spiWriteBytes; ///< Bytes via spiWrite(), command bytes included
+  uint32_t write16Bytes;  ///< Bytes via SPI_WRITE16()
+  uint32_t write32Bytes;  ///< Bytes via SPI_WRITE32()
+  uint32_t colorBytes;    ///< Bytes via writeColor()
+  uint32_t pixelBytes;    ///< Bytes via writePixels()
+} SPITFT_TraceCounts;
+
+/// One frame of tracing, as kept by traceFrame()
+typedef struct {
+  uint32_t           frame;                   ///< Frame number since traceReset()
+  uint32_t           micros;                  ///< Frame duration
+  SPITFT_TraceCounts prim[GFX_TRACE_COUNT];   ///< Indexed by GFX_TRACE_* id
+} SPITFT_TraceFrame;
+#endif
+
 // This is kind of a kludge. Needed a way to disambiguate the software SPI
 // and parallel constructors via their argument lists. Originally tried a
 // bool as the first argument to the parallel constructor (specifying 8-bit
@@ -199,6 +269,15 @@ class Adafruit_SPITFT : public Adafruit_GFX {
     */
     virtual void setAddrWindow(
                    uint16_t x, uint16_t y, uint16_t w, uint16_t h) = 0;
+    /*!
+        @brief  Forget the address window last sent to the display, so the
+                next setAddrWindow() sends both ranges in full. Subclasses
+                skip a CASET or PASET whose range hasn't changed; call this
+                after anything that may have changed them behind their
+                back. sendCommand(), readcommand8() and setRotation() do.
+    */
+    void         invalidateAddrWindow(void) {
+                   addrColumns = addrRows = 0xFFFFFFFF; }
 
     // Remaining functions do not need to be declared in subclasses
     // unless they wish to provide hardware-specific optimizations.
@@ -217,6 +296,15 @@ class Adafruit_SPITFT : public Adafruit_GFX {
     void         sendCommand(uint8_t commandByte, uint8_t *dataBytes = NULL, uint8_t numDataBytes = 0);
     void         sendCommand(uint8_t commandByte, const uint8_t *dataBytes, uint8_t numDataBytes);
     uint8_t      readcommand8(uint8_t commandByte, uint8_t index = 0);
+    // Bus clocks, hardware SPI only: set by hand, or calibrated once and
+    // kept so later boots go straight to them
+    void         setSPISpeed(uint32_t writeFreq, uint32_t readFreq);
+    bool         calibrateSPI(SPITFT_BusSpeed *speed),
+                 setBusSpeed(const SPITFT_BusSpeed &speed);
+    // Reading display memory back, e.g. for screenshots. Needs MISO.
+    void         readPixels(int16_t x, int16_t y, int16_t w, int16_t h,
+                   uint16_t *dst);
+    bool         writeScreenshot(Print &out);
 
     // These functions require a chip-select and/or SPI transaction
     // around them. Higher-level graphics primitives might start a
@@ -244,6 +332,11 @@ class Adafruit_SPITFT : public Adafruit_GFX {
     // Another new function, companion to the new non-blocking
     // writePixels() variant.
     void dmaWait(void);
+    // Adafruit_GFX block transfer hooks: setAddrWindow(), writePixels()
+    // and writeColor()
+    bool         writeWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+    void         writeWindowPixels(uint16_t *colors, uint32_t len);
+    void         writeWindowColor(uint16_t color, uint32_t len);
 
 
     // These functions are similar to the 'write' functions above, but with
@@ -269,6 +362,21 @@ class Adafruit_SPITFT : public Adafruit_GFX {
     void         invertDisplay(bool i);
     uint16_t     color565(uint8_t r, uint8_t g, uint8_t b);
 
+#if defined(SPITFT_TRACE)
+    // Bus tracing, see SPITFT_TRACE at the top of this file
+    void         traceReset(void);
+    void         traceFrame(Print *out = NULL);
+    void         traceReport(Print &out, const SPITFT_TraceFrame &frame);
+    const SPITFT_TraceFrame *traceHistory(uint8_t age = 0) const;
+    /*!
+        @brief   Counts for the frame in progress (since the last
+                 traceFrame() or traceReset()).
+        @return  Frame structure, indexed by GFX_TRACE_* id.
+    */
+    const SPITFT_TraceFrame &traceCurrent(void) const { return traceCur; }
+    static uint32_t traceBytes(const SPITFT_TraceCounts &c);
+#endif
+
     // Despite parallel additions, function names kept for compatibility:
     void         spiWrite(uint8_t b);       // Write single byte as DATA
     void         writeCommand(uint8_t cmd); // Write single byte as COMMAND
@@ -390,6 +498,8 @@ class Adafruit_SPITFT : public Adafruit_GFX {
     inline void  TFT_WR_STROBE(void); // Parallel interface write strobe
     inline void  TFT_RD_HIGH(void);   // Parallel interface read high
     inline void  TFT_RD_LOW(void);    // Parallel interface read low
+    void         useReadClock(bool read); // Read or write SPI clock
+    bool         busTest(void);
 
     // CLASS INSTANCE VARIABLES --------------------------------------------
 
@@ -508,6 +618,13 @@ class Adafruit_SPITFT : public Adafruit_GFX {
     uint32_t         lastFillLen   = 0;    ///< # of pixels w/last fill
     uint8_t          onePixelBuf;          ///< For hi==lo fill
 #endif
+#if defined(USE_SPI_ASYNC)
+    uint16_t        *asyncBuf[2]   = { NULL, NULL }; ///< Ping-pong buffers
+    uint16_t         asyncLen      = 0;    ///< Pixels per buffer
+    uint8_t          asyncIdx      = 0;    ///< Buffer the CPU fills next
+    uint16_t         asyncFillColor = 0;   ///< Color last filled by writeColor()
+    uint32_t         asyncFillLen  = 0;    ///< # of pixels of that color
+#endif
 #if defined(USE_FAST_PINIO)
 #if defined(HAS_PORT_SET_CLR)
  #if !defined(KINETISK)
@@ -532,6 +649,24 @@ class Adafruit_SPITFT : public Adafruit_GFX {
     uint8_t       invertOffCommand = 0; ///< Command to disable invert mode
 
     uint32_t      _freq = 0;       ///< Dummy var to keep subclasses happy
+    uint32_t      writeFreq = 0;   ///< Hardware SPI clock for writes
+    uint32_t      readFreq  = 0;   ///< Hardware SPI clock for reads
+    uint32_t      addrColumns = 0xFFFFFFFF; ///< CASET range the display has
+    uint32_t      addrRows    = 0xFFFFFFFF; ///< PASET range the display has
+
+#if defined(SPITFT_TRACE)
+    void          tracePrimitive(uint8_t prim);
+    void          traceRange(uint32_t range);
+    SPITFT_TraceFrame traceCur = {};                       ///< Frame in progress
+    SPITFT_TraceFrame traceRing[SPITFT_TRACE_FRAMES] = {}; ///< Completed frames
+    uint8_t       traceHead  = 0;          ///< Next traceRing slot to fill
+    uint8_t       traceCount = 0;          ///< Valid frames in traceRing
+    uint8_t       traceCmd   = 0;          ///< Last command byte written
+    bool          traceMute  = false;      ///< Already counted by caller
+    uint32_t      traceCaset = 0xFFFFFFFF; ///< Last CASET range sent
+    uint32_t      tracePaset = 0xFFFFFFFF; ///< Last PASET range sent
+    uint32_t      traceStart = 0;          ///< micros() at frame start
+#endif
 };
 
 #endif // end __AVR_ATtiny85__
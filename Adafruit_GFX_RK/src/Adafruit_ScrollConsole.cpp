@@ -0,0 +1,160 @@
+/*!
+ * @file Adafruit_ScrollConsole.cpp
+ *
+ * Part of Adafruit's GFX graphics library. See Adafruit_ScrollConsole.h.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_ScrollConsole.h"
+
+#define SCROLL_VSCRDEF  0x33 ///< Vertical scrolling definition
+#define SCROLL_VSCRSADD 0x37 ///< Vertical scrolling start address
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate a scrolling console, white on black, text size 1
+    @param   tft     The display
+    @param   top     Rows at the top that don't scroll
+    @param   bottom  Rows at the bottom that don't scroll. Rows left over
+                     from a whole number of lines are added to these.
+*/
+/**************************************************************************/
+GFXscrollConsole::GFXscrollConsole(Adafruit_SPITFT &tft, uint16_t top,
+  uint16_t bottom) : tft(tft), top(top), bottom(bottom) {
+    textcolor   = 0xFFFF;
+    textbgcolor = 0x0000;
+    textsize    = 1;
+    lineHeight  = 8;
+    area = first = line = 0;
+    cursor_x    = 0;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Put the display at rotation 0, set up the scrolling area and
+             clear it. Call again after changing the text size. Fixed areas
+             taller than the display are cut down to it, leaving no lines
+             if need be.
+*/
+/**************************************************************************/
+void GFXscrollConsole::begin(void) {
+    tft.setRotation(0);
+    // Fixed areas no taller than the display, the top one first
+    if(top > tft.height()) top = tft.height();
+    if(bottom > tft.height() - top) bottom = tft.height() - top;
+    uint16_t rows = tft.height() - top - bottom;
+    area = rows - rows % lineHeight;
+    uint8_t def[6] = {
+      (uint8_t)(top >> 8),  (uint8_t)top,
+      (uint8_t)(area >> 8), (uint8_t)area,
+      (uint8_t)((tft.height() - top - area) >> 8),
+      (uint8_t)(tft.height() - top - area)
+    };
+    tft.sendCommand(SCROLL_VSCRDEF, def, 6);
+    clear();
+}
+
+/**************************************************************************/
+/*!
+   @brief    Clear the console and start again from its top line
+*/
+/**************************************************************************/
+void GFXscrollConsole::clear(void) {
+    first = line = 0;
+    cursor_x = 0;
+    scroll();
+    tft.fillRect(0, top, tft.width(), area, textbgcolor);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Stop scrolling, so the whole display shows memory as drawn.
+             The console lines are left wherever they ended up.
+*/
+/**************************************************************************/
+void GFXscrollConsole::end(void) {
+    uint16_t h = tft.height();
+    uint8_t  def[6] = { 0, 0, (uint8_t)(h >> 8), (uint8_t)h, 0, 0 },
+             start[2] = { 0, 0 };
+    tft.sendCommand(SCROLL_VSCRDEF, def, 6);
+    tft.sendCommand(SCROLL_VSCRSADD, start, 2);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Set the text color, and the background lines are cleared to
+    @param   color  16-bit 5-6-5 text color
+    @param   bg     16-bit 5-6-5 background color
+*/
+/**************************************************************************/
+void GFXscrollConsole::setTextColor(uint16_t color, uint16_t bg) {
+    textcolor   = color;
+    textbgcolor = bg;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Set the text magnification, takes effect at the next begin()
+    @param   s  Size, 1 is 6x8 pixel characters
+*/
+/**************************************************************************/
+void GFXscrollConsole::setTextSize(uint8_t s) {
+    textsize   = s ? s : 1;
+    lineHeight = 8 * textsize;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Tell the controller which memory row to show at the top of
+             the scrolling area
+*/
+/**************************************************************************/
+void GFXscrollConsole::scroll(void) {
+    uint16_t row = top + first;
+    uint8_t  start[2] = { (uint8_t)(row >> 8), (uint8_t)row };
+    tft.sendCommand(SCROLL_VSCRSADD, start, 2);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Move to the start of the next line, scrolling the oldest line
+             off the top and reusing its memory if the console is full
+*/
+/**************************************************************************/
+void GFXscrollConsole::newLine(void) {
+    cursor_x = 0;
+    line = (line + lineHeight) % area;
+    if(line == first) {
+        first = (first + lineHeight) % area;
+        tft.fillRect(0, top + line, tft.width(), lineHeight, textbgcolor);
+        scroll();
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Print one character, used to support print(). Lines wrap at
+             the right edge.
+    @param   c  The 8-bit ascii character to write
+*/
+/**************************************************************************/
+#if ARDUINO >= 100
+size_t GFXscrollConsole::write(uint8_t c) {
+#else
+void GFXscrollConsole::write(uint8_t c) {
+#endif
+    if(area) {
+        if(c == '\n') {
+            newLine();
+        } else if(c != '\r') {
+            if(cursor_x + 6 * textsize > tft.width()) newLine();
+            tft.drawChar(cursor_x, top + line, c, textcolor, textbgcolor,
+              textsize, textsize);
+            cursor_x += 6 * textsize;
+        }
+    }
+#if ARDUINO >= 100
+    return 1;
+#endif
+}
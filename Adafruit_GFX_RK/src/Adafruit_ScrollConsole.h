@@ -0,0 +1,70 @@
+/*!
+ * @file Adafruit_ScrollConsole.h
+ *
+ * Part of Adafruit's GFX graphics library. A text console on the
+ * hardware vertical scrolling of ILI9341-style controllers (VSCRDEF and
+ * VSCRSADD): once the screen is full, each new line costs one line of
+ * drawing and a scroll command instead of redrawing the screen.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _ADAFRUIT_SCROLLCONSOLE_H_
+#define _ADAFRUIT_SCROLLCONSOLE_H_
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_SPITFT.h"
+
+/*!
+  @brief  Scrolling text console in the classic font.
+
+          The controller scrolls whole display rows, which run across the
+          short side of the panel, so the console only works with the
+          display at rotation 0; begin() sets it. Rows above and below the
+          console (top and bottom) are fixed areas that don't scroll and
+          can be drawn on as usual.
+
+          The scrolling area is a ring of text lines in display memory.
+          The controller is told which line to show first; a new line
+          past the bottom clears the oldest line, draws there, and moves
+          the start one line on.
+*/
+class GFXscrollConsole : public Print {
+ public:
+  GFXscrollConsole(Adafruit_SPITFT &tft, uint16_t top = 0,
+    uint16_t bottom = 0);
+  void      begin(void),
+            clear(void),
+            end(void),
+            setTextColor(uint16_t color, uint16_t bg),
+            setTextSize(uint8_t s);
+#if ARDUINO >= 100
+  size_t    write(uint8_t c);
+#else
+  void      write(uint8_t c);
+#endif
+  /**********************************************************************/
+  /*!
+    @brief    Get the number of text lines the console shows
+    @returns  Line count at the current text size
+  */
+  /**********************************************************************/
+  uint16_t  lines(void) const { return area / lineHeight; }
+
+ private:
+  void      newLine(void),
+            scroll(void);
+
+  Adafruit_SPITFT &tft;
+  uint16_t  top,         ///< Rows in the top fixed area
+            bottom,      ///< Rows requested for the bottom fixed area
+            area,        ///< Rows that scroll, a whole number of lines
+            lineHeight,  ///< Rows per text line
+            first,       ///< Offset in the area of the line shown on top
+            line;        ///< Offset in the area of the line being printed
+  int16_t   cursor_x;
+  uint16_t  textcolor, textbgcolor;
+  uint8_t   textsize;
+};
+
+#endif // _ADAFRUIT_SCROLLCONSOLE_H_
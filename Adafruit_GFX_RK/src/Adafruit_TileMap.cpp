@@ -0,0 +1,350 @@
+/*!
+ * @file Adafruit_TileMap.cpp
+ *
+ * Part of Adafruit's GFX graphics library. See Adafruit_TileMap.h.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_TileMap.h"
+#ifdef __AVR__
+  #include <avr/pgmspace.h>
+#elif defined(ESP8266) || defined(ESP32)
+  #include <pgmspace.h>
+#endif
+
+#ifndef pgm_read_byte
+ #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#endif
+#ifndef pgm_read_word
+ #define pgm_read_word(addr) (*(const unsigned short *)(addr))
+#endif
+#ifndef pgm_read_dword
+ #define pgm_read_dword(addr) (*(const unsigned long *)(addr))
+#endif
+
+#if !defined(__INT_MAX__) || (__INT_MAX__ > 0xFFFF)
+ #define pgm_read_pointer(addr) ((void *)pgm_read_dword(addr))
+#else
+ #define pgm_read_pointer(addr) ((void *)pgm_read_word(addr))
+#endif
+
+#if defined(USE_SPI_ASYNC)
+ // Particle swaps each band into the other of two buffers before sending
+ // it, so bands needn't wait for the one before
+ #define TILE_BLOCK false
+#else
+ // SAMD DMA starts again at its first buffer on every writePixels(), which
+ // may still be going out, so each band is sent before the next
+ #define TILE_BLOCK true
+#endif
+
+#ifndef min
+ #define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate a tile map, all cells blank and black. The first
+             flush() sends every cell.
+    @param   tft    The display
+    @param   tiles  The tile set, in RAM or PROGMEM
+    @param   cols   Cells across
+    @param   rows   Cells down
+    @param   scale  Display pixels per tile pixel, across and down
+    @param   x      Left edge of the grid on the display
+    @param   y      Top edge of the grid on the display
+*/
+/**************************************************************************/
+GFXtileMap::GFXtileMap(Adafruit_SPITFT &tft, const GFXtileSet *tiles,
+  uint16_t cols, uint16_t rows, uint8_t scale, int16_t x, int16_t y) :
+  tft(tft), tiles(tiles), cols(cols), rows(rows), scale(scale ? scale : 1),
+  x(x), y(y) {
+    uint32_t n = (uint32_t)cols * rows;
+    cells = (Cell *)malloc(n * sizeof(Cell));
+    sent  = (Cell *)malloc(n * sizeof(Cell));
+    dirty = (uint8_t *)malloc((n + 7) / 8);
+    if(!cells || !sent || !dirty) { // No grid, nothing is ever drawn
+        if(cells) free(cells);
+        if(sent)  free(sent);
+        if(dirty) free(dirty);
+        cells = sent = NULL;
+        dirty = NULL;
+        this->cols = this->rows = 0;
+        n = 0;
+    }
+    for(uint32_t i=0; i<n; i++) {
+        cells[i].tile = GFX_TILE_BLANK;
+        cells[i].fg   = cells[i].bg = 0x0000;
+        sent[i]       = cells[i];
+    }
+    if(n) memset(dirty, 0, (n + 7) / 8);
+    all = true;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Delete the tile map and free its grid
+*/
+/**************************************************************************/
+GFXtileMap::~GFXtileMap(void) {
+    if(cells) free(cells);
+    if(sent)  free(sent);
+    if(dirty) free(dirty);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Set one cell
+    @param   col   Column, from 0 at the left
+    @param   row   Row, from 0 at the top
+    @param   tile  Tile number, or GFX_TILE_BLANK
+    @param   fg    16-bit 5-6-5 color of the tile's set pixels
+    @param   bg    16-bit 5-6-5 color of the rest
+*/
+/**************************************************************************/
+void GFXtileMap::setTile(uint16_t col, uint16_t row, uint8_t tile,
+  uint16_t fg, uint16_t bg) {
+    if((col >= cols) || (row >= rows)) return;
+    uint32_t i = (uint32_t)row * cols + col;
+    cells[i].tile = tile;
+    cells[i].fg   = fg;
+    cells[i].bg   = bg;
+    dirty[i / 8] |= 1 << (i & 7);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Set a rectangle of cells all the same
+    @param   col   Left column
+    @param   row   Top row
+    @param   w     Columns
+    @param   h     Rows
+    @param   tile  Tile number, or GFX_TILE_BLANK
+    @param   fg    16-bit 5-6-5 color of the tile's set pixels
+    @param   bg    16-bit 5-6-5 color of the rest
+*/
+/**************************************************************************/
+void GFXtileMap::fill(uint16_t col, uint16_t row, uint16_t w, uint16_t h,
+  uint8_t tile, uint16_t fg, uint16_t bg) {
+    for(uint16_t r=row; (r<rows) && (r-row<h); r++) {
+        for(uint16_t c=col; (c<cols) && (c-col<w); c++) {
+            setTile(c, r, tile, fg, bg);
+        }
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Blank every cell, e.g. before building the next screen
+    @param   bg  16-bit 5-6-5 color
+*/
+/**************************************************************************/
+void GFXtileMap::clear(uint16_t bg) {
+    fill(0, 0, cols, rows, GFX_TILE_BLANK, bg, bg);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Set cells to the tiles for some text, one character per cell.
+             A newline goes back to col on the next row. Text past the
+             right edge is dropped; characters with no tile are blank.
+    @param   col   Column of the first character
+    @param   row   Row of the first character
+    @param   text  Null-terminated text
+    @param   fg    16-bit 5-6-5 text color
+    @param   bg    16-bit 5-6-5 background color
+*/
+/**************************************************************************/
+void GFXtileMap::print(uint16_t col, uint16_t row, const char *text,
+  uint16_t fg, uint16_t bg) {
+    uint8_t  first = pgm_read_byte(&tiles->first),
+             count = pgm_read_byte(&tiles->count);
+    for(uint16_t c=col; *text; text++) {
+        if(*text == '\n') {
+            c = col;
+            row++;
+        } else {
+            uint8_t t = (uint8_t)*text - first;
+            setTile(c++, row, ((uint8_t)*text >= first) && (t < count) ?
+              t : GFX_TILE_BLANK, fg, bg);
+        }
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Send every cell at the next flush(), e.g. after something else
+             drew over the grid
+*/
+/**************************************************************************/
+void GFXtileMap::redraw(void) {
+    all = true;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Whether a cell has to be sent: it was set since the last
+             flush() and isn't what was sent then
+    @param   i  Cell index
+    @returns True to send it
+*/
+/**************************************************************************/
+bool GFXtileMap::needsSending(uint32_t i) const {
+    if(all) return true;
+    if(!(dirty[i / 8] & (1 << (i & 7)))) return false;
+    return (cells[i].tile != sent[i].tile) || (cells[i].bg != sent[i].bg) ||
+      ((cells[i].tile != GFX_TILE_BLANK) && (cells[i].fg != sent[i].fg));
+}
+
+/**************************************************************************/
+/*!
+   @brief    Whether a cell shows nothing but a color
+    @param   i   Cell index
+    @param   bg  The color
+    @returns True if it's blank (or has no tile) in that color
+*/
+/**************************************************************************/
+bool GFXtileMap::blank(uint32_t i, uint16_t bg) const {
+    return ((cells[i].tile == GFX_TILE_BLANK) ||
+            (cells[i].tile >= pgm_read_byte(&tiles->count))) &&
+           (cells[i].bg == bg);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Send the cells that changed
+    @returns Number of cells sent
+*/
+/**************************************************************************/
+uint16_t GFXtileMap::flush(void) {
+    uint16_t cs = pgm_read_byte(&tiles->size) * scale,
+             maxRun = GFX_TILE_BUFFER / ((uint32_t)cs * cs), total = 0;
+    if(!maxRun) maxRun = 1;
+    tft.startWrite();
+    for(uint16_t row=0; row<rows; row++) {
+        for(uint16_t col=0; col<cols; ) {
+            uint32_t i = (uint32_t)row * cols + col;
+            if(!needsSending(i)) {
+                col++;
+                continue;
+            }
+            // Up to a buffer full, or any number of blank cells of a color
+            uint16_t n = 1;
+            bool     solid = blank(i, cells[i].bg);
+            while((col + n < cols) && needsSending(i + n)) {
+                solid = solid && blank(i + n, cells[i].bg);
+                if(!solid && (n >= maxRun)) break;
+                n++;
+            }
+            sendRun(col, row, n);
+            for(uint16_t j=0; j<n; j++) sent[i + j] = cells[i + j];
+            col   += n;
+            total += n;
+        }
+    }
+    tft.dmaWait();
+    tft.endWrite();
+    if(cols) memset(dirty, 0, ((uint32_t)cols * rows + 7) / 8);
+    all = false;
+    return total;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a run of cells along a row into the buffer, as many rows
+             of pixels at a time as fit, and send them in one window. A
+             run of blank cells of one color is a single fill. Must be
+             inside startWrite() and endWrite(). Waits for the run before
+             to finish sending, but not for this one.
+    @param   col  First cell's column
+    @param   row  The cells' row
+    @param   n    Number of cells
+*/
+/**************************************************************************/
+void GFXtileMap::sendRun(uint16_t col, uint16_t row, uint16_t n) {
+    const Cell    *c        = &cells[(uint32_t)row * cols + col];
+    const uint8_t *bitmap   = (const uint8_t *)pgm_read_pointer(&tiles->bitmap);
+    uint8_t        size     = pgm_read_byte(&tiles->size),
+                   count    = pgm_read_byte(&tiles->count),
+                   rowBytes = (size + 7) / 8;
+    uint16_t       cs       = size * scale,
+                   w        = n * cs;
+    tft.dmaWait(); // The run before may still be going out
+    tft.setAddrWindow(x + col * cs, y + row * cs, w, cs);
+
+    bool solid = true;
+    for(uint16_t j=0; j<n; j++) {
+        uint32_t i = (uint32_t)row * cols + col + j;
+        if(!blank(i, c[0].bg)) solid = false;
+    }
+    if(solid) {
+        tft.writeColor(c[0].bg, (uint32_t)w * cs);
+        return;
+    }
+
+    uint16_t band = GFX_TILE_BUFFER / w; // Pixel rows per buffer
+    if(!band) band = 1;
+    for(uint16_t py=0; py<cs; py+=band) {
+        uint16_t rowsNow = min(band, (uint16_t)(cs - py));
+        for(uint16_t r=0; r<rowsNow; r++) {
+            uint16_t ty = (py + r) / scale;
+            for(uint16_t j=0; j<n; j++) {
+                uint16_t *dst = &buffer[r * w + j * cs];
+                if((c[j].tile == GFX_TILE_BLANK) || (c[j].tile >= count)) {
+                    for(uint16_t px=0; px<cs; px++) dst[px] = c[j].bg;
+                    continue;
+                }
+                const uint8_t *bits =
+                  &bitmap[((uint32_t)c[j].tile * size + ty) * rowBytes];
+                for(uint16_t px=0; px<cs; px++) {
+                    uint16_t tx = px / scale;
+                    dst[px] = (pgm_read_byte(&bits[tx >> 3]) & (0x80 >> (tx & 7)))
+                      ? c[j].fg : c[j].bg;
+                }
+            }
+        }
+        // With USE_SPI_ASYNC the next band is drawn while this one goes
+        // out of the display's own buffers
+        tft.writePixels(buffer, (uint32_t)rowsNow * w, TILE_BLOCK);
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Make a tile set of classic font characters, each centered in
+             its tile. The tiles are allocated and kept for good.
+    @param   set       Tile set to fill in
+    @param   size      Tile width and height, at least 6 x textSize wide
+                       and 8 x textSize high
+    @param   first     First character
+    @param   count     Number of characters
+    @param   textSize  Font magnification
+    @returns False if the characters don't fit or there's no memory
+*/
+/**************************************************************************/
+bool GFXtileMap::makeTextTiles(GFXtileSet *set, uint8_t size, uint8_t first,
+  uint8_t count, uint8_t textSize) {
+    if(!textSize || (6 * textSize > size) || (8 * textSize > size)) {
+        return false;
+    }
+    uint16_t tileBytes = size * ((size + 7) / 8);
+    uint8_t *bitmap    = (uint8_t *)malloc((uint32_t)tileBytes * count);
+    if(!bitmap) return false;
+    GFXcanvas1 tile(size, size);
+    if(!tile.getBuffer()) {
+        free(bitmap);
+        return false;
+    }
+    for(uint16_t i=0; i<count; i++) {
+        tile.fillScreen(0);
+        tile.drawChar((size - 6 * textSize) / 2, (size - 8 * textSize) / 2,
+          first + i, 1, 1, textSize);
+        memcpy(&bitmap[i * tileBytes], tile.getBuffer(), tileBytes);
+    }
+    set->bitmap = bitmap;
+    set->size   = size;
+    set->first  = first;
+    set->count  = count;
+    return true;
+}
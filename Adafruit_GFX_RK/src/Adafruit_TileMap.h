@@ -0,0 +1,96 @@
+/*!
+ * @file Adafruit_TileMap.h
+ *
+ * Part of Adafruit's GFX graphics library. A screen made of a grid of
+ * two-color tiles from a shared tile set, such as text in a fixed-size
+ * font over solid colors. Only cells that changed since they were last
+ * sent are drawn again, so moving from one screen to another costs the
+ * tiles that differ.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _ADAFRUIT_TILEMAP_H_
+#define _ADAFRUIT_TILEMAP_H_
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_SPITFT.h"
+
+#if !defined(GFX_TILE_BUFFER)
+ #define GFX_TILE_BUFFER 1024 ///< Pixels of tiles drawn before sending, 2K
+#endif
+
+#define GFX_TILE_BLANK 0xFF ///< Tile number for a cell all in its background color
+
+/*!
+  @brief  A set of 1-bit tiles, square, 8 or 16 pixels a side.
+
+          Each tile's rows are stored one after another, padded to whole
+          bytes, most significant bit on the left, the same as a
+          GFXcanvas1's buffer and drawBitmap(). Tile n is for character
+          first + n when printing text.
+*/
+typedef struct {
+  const uint8_t *bitmap; ///< Tiles, one after another
+  uint8_t size;          ///< Width and height in pixels
+  uint8_t first;         ///< Character of the first tile
+  uint8_t count;         ///< Number of tiles, up to 255
+} GFXtileSet;
+
+/*!
+  @brief  A grid of cells on an Adafruit_SPITFT display, each one a tile
+          from a GFXtileSet in a foreground and a background color.
+
+          Setting cells only changes the grid and marks them; flush()
+          sends those that now differ from what was sent, a few cells
+          along a row at a time through one address window. Cells that
+          were changed and then changed back aren't sent, so a screen can
+          be cleared and built again from scratch. A row of blank cells
+          of one color is a single fill.
+
+          The grid takes 12 bytes per cell (what's wanted and what was
+          sent), 14K for 40 x 30 cells of 8 x 8 pixels. Tiles may be drawn
+          2 or more times their size. The grid must fit on the display.
+*/
+class GFXtileMap {
+ public:
+  GFXtileMap(Adafruit_SPITFT &tft, const GFXtileSet *tiles, uint16_t cols,
+    uint16_t rows, uint8_t scale = 1, int16_t x = 0, int16_t y = 0);
+  ~GFXtileMap(void);
+  void      setTile(uint16_t col, uint16_t row, uint8_t tile, uint16_t fg,
+              uint16_t bg),
+            fill(uint16_t col, uint16_t row, uint16_t w, uint16_t h,
+              uint8_t tile, uint16_t fg, uint16_t bg),
+            clear(uint16_t bg),
+            print(uint16_t col, uint16_t row, const char *text, uint16_t fg,
+              uint16_t bg),
+            redraw(void);
+  uint16_t  flush(void);
+
+  static bool makeTextTiles(GFXtileSet *set, uint8_t size, uint8_t first,
+              uint8_t count, uint8_t textSize = 1);
+
+ private:
+  /// One cell: a tile and its colors
+  struct Cell {
+    uint8_t  tile;
+    uint16_t fg, bg;
+  };
+
+  bool      needsSending(uint32_t i) const,
+            blank(uint32_t i, uint16_t bg) const;
+  void      sendRun(uint16_t col, uint16_t row, uint16_t n);
+
+  Adafruit_SPITFT &tft;
+  const GFXtileSet *tiles;
+  uint16_t  cols, rows;
+  uint8_t   scale;
+  int16_t   x, y;
+  Cell     *cells;   ///< What each cell should show
+  Cell     *sent;    ///< What each cell was last sent as
+  uint8_t  *dirty;   ///< A bit per cell changed since it was sent
+  bool      all;     ///< Send every cell at the next flush()
+  uint16_t  buffer[GFX_TILE_BUFFER];
+};
+
+#endif // _ADAFRUIT_TILEMAP_H_
@@ -0,0 +1,688 @@
+/*!
+ * @file Adafruit_Widgets.cpp
+ *
+ * Part of Adafruit's GFX graphics library. See Adafruit_Widgets.h.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_Widgets.h"
+#ifdef __AVR__
+  #include <avr/pgmspace.h>
+#elif defined(ESP8266) || defined(ESP32)
+  #include <pgmspace.h>
+#endif
+
+#ifndef pgm_read_word
+ #define pgm_read_word(addr) (*(const unsigned short *)(addr))
+#endif
+
+#ifndef min
+ #define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef max
+ #define max(a,b) (((a) > (b)) ? (a) : (b))
+#endif
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate a widget, shown and dirty
+    @param   x  X position, as each kind of widget defines
+    @param   y  Y position
+*/
+/**************************************************************************/
+GFXwidget::GFXwidget(int16_t x, int16_t y) : x(x), y(y) {
+    next    = NULL;
+    dirty   = visible = true;
+    painted = false;
+    px = py = 0;
+    pw = ph = 0;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Move the widget
+    @param   x  New x position
+    @param   y  New y position
+*/
+/**************************************************************************/
+void GFXwidget::moveTo(int16_t x, int16_t y) {
+    if((x != this->x) || (y != this->y)) {
+        this->x = x;
+        this->y = y;
+        dirty   = true;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Show or hide the widget
+    @param   visible  True to show it
+*/
+/**************************************************************************/
+void GFXwidget::show(bool visible) {
+    if(visible != this->visible) {
+        this->visible = visible;
+        dirty         = true;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Repaint the widget at the next render(), e.g. after changing
+             the bitmap an icon shows
+*/
+/**************************************************************************/
+void GFXwidget::invalidate(void) {
+    dirty = true;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate a label, classic font size 1
+    @param   x      Cursor x
+    @param   y      Cursor y
+    @param   text   Text, copied
+    @param   color  16-bit 5-6-5 text color
+*/
+/**************************************************************************/
+GFXlabel::GFXlabel(int16_t x, int16_t y, const char *text, uint16_t color) :
+  GFXwidget(x, y), font(NULL), alphaFont(NULL), color(color), bg(0),
+  ownBg(false), size(1) {
+    this->text[0] = 0;
+    setText(text);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Change the text. Setting the same text again does nothing.
+    @param   text  Text, copied; longer than GFX_LABEL_TEXT - 1 is cut short
+*/
+/**************************************************************************/
+void GFXlabel::setText(const char *text) {
+    if(strncmp(this->text, text, GFX_LABEL_TEXT - 1)) {
+        strncpy(this->text, text, GFX_LABEL_TEXT - 1);
+        this->text[GFX_LABEL_TEXT - 1] = 0;
+        invalidate();
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Set the text color, on the screen's background color
+    @param   color  16-bit 5-6-5 color
+*/
+/**************************************************************************/
+void GFXlabel::setColor(uint16_t color) {
+    if((color != this->color) || ownBg) {
+        this->color = color;
+        ownBg       = false;
+        invalidate();
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Set the text color and a background color of the label's own
+    @param   color  16-bit 5-6-5 text color
+    @param   bg     16-bit 5-6-5 background color
+*/
+/**************************************************************************/
+void GFXlabel::setColor(uint16_t color, uint16_t bg) {
+    if((color != this->color) || !ownBg || (bg != this->bg)) {
+        this->color = color;
+        this->bg    = bg;
+        ownBg       = true;
+        invalidate();
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Set the text magnification, for the classic font and GFXfonts
+    @param   size  Size, 1 is unscaled
+*/
+/**************************************************************************/
+void GFXlabel::setTextSize(uint8_t size) {
+    size = size ? size : 1;
+    if(size != this->size) {
+        this->size = size;
+        invalidate();
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Use a GFXfont, or the classic font, instead of any
+             anti-aliased font
+    @param   f  The font, NULL for the classic one
+*/
+/**************************************************************************/
+void GFXlabel::setFont(const GFXfont *f) {
+    if((f != font) || alphaFont) {
+        font      = f;
+        alphaFont = NULL;
+        invalidate();
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Use an anti-aliased font, blended against the background
+             color. A separate name from setFont(), so setFont(NULL) isn't
+             ambiguous.
+    @param   f  The font, NULL to go back to the one setFont() gave
+*/
+/**************************************************************************/
+void GFXlabel::setAlphaFont(const GFXalphaFont *f) {
+    if(f != alphaFont) {
+        alphaFont = f;
+        invalidate();
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Give the display the label's font and size, no wrapping
+    @param   gfx  The display
+*/
+/**************************************************************************/
+void GFXlabel::setupText(Adafruit_GFX &gfx) {
+    gfx.setFont(font);
+    gfx.setTextSize(size);
+    gfx.setTextWrap(false);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Get the box the text covers
+    @param   gfx  The display, for measuring
+    @param   x1   Set to the left edge
+    @param   y1   Set to the top edge
+    @param   w    Set to the width, 0 for no text
+    @param   h    Set to the height
+*/
+/**************************************************************************/
+void GFXlabel::getBounds(Adafruit_GFX &gfx, int16_t *x1, int16_t *y1,
+  uint16_t *w, uint16_t *h) {
+    if(alphaFont) {
+        GFXalphaText t(gfx, alphaFont);
+        t.setTextWrap(false);
+        t.getTextBounds(text, x, y, x1, y1, w, h);
+    } else {
+        setupText(gfx);
+        gfx.getTextBounds(text, x, y, x1, y1, w, h);
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw the text and its background. A single line in the
+             classic font is drawn opaque, other text over a cleared box.
+    @param   gfx  The display
+    @param   bg   The screen's background color
+*/
+/**************************************************************************/
+void GFXlabel::paint(Adafruit_GFX &gfx, uint16_t bg) {
+    if(ownBg) bg = this->bg;
+    if(!font && !alphaFont && !strchr(text, '\n')) {
+        setupText(gfx);
+        gfx.setTextColor(color, bg);
+        gfx.setCursor(x, y);
+        gfx.print(text);
+        return;
+    }
+    int16_t  x1, y1;
+    uint16_t w, h;
+    getBounds(gfx, &x1, &y1, &w, &h);
+    gfx.fillRect(x1, y1, w, h, bg);
+    if(alphaFont) {
+        GFXalphaText t(gfx, alphaFont);
+        t.setTextWrap(false);
+        t.setTextColor(color, bg);
+        t.setCursor(x, y);
+        t.print(text);
+    } else {
+        setupText(gfx);
+        gfx.setTextColor(color);
+        gfx.setCursor(x, y);
+        gfx.print(text);
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate an icon of a 16-bit bitmap
+    @param   x       Left edge
+    @param   y       Top edge
+    @param   bitmap  16-bit 5-6-5 pixels, w x h
+    @param   w       Width
+    @param   h       Height
+*/
+/**************************************************************************/
+GFXicon::GFXicon(int16_t x, int16_t y, const uint16_t *bitmap, uint16_t w,
+  uint16_t h) : GFXwidget(x, y), bitmap(bitmap), image(NULL), w(w), h(h) { }
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate an icon of a run-length encoded image
+    @param   x      Left edge
+    @param   y      Top edge
+    @param   image  The image
+*/
+/**************************************************************************/
+GFXicon::GFXicon(int16_t x, int16_t y, const GFXrleImage *image) :
+  GFXwidget(x, y), bitmap(NULL), image(image), w(0), h(0) { }
+
+/**************************************************************************/
+/*!
+   @brief    Show a different 16-bit bitmap
+    @param   bitmap  16-bit 5-6-5 pixels, w x h
+    @param   w       Width
+    @param   h       Height
+*/
+/**************************************************************************/
+void GFXicon::setImage(const uint16_t *bitmap, uint16_t w, uint16_t h) {
+    this->bitmap = bitmap;
+    this->image  = NULL;
+    this->w      = w;
+    this->h      = h;
+    invalidate();
+}
+
+/**************************************************************************/
+/*!
+   @brief    Show a different run-length encoded image
+    @param   image  The image
+*/
+/**************************************************************************/
+void GFXicon::setImage(const GFXrleImage *image) {
+    this->image = image;
+    invalidate();
+}
+
+/**************************************************************************/
+/*!
+   @brief    Get the box the image covers
+    @param   x1   Set to the left edge
+    @param   y1   Set to the top edge
+    @param   w    Set to the width
+    @param   h    Set to the height
+*/
+/**************************************************************************/
+void GFXicon::getBounds(Adafruit_GFX &, int16_t *x1, int16_t *y1,
+  uint16_t *w, uint16_t *h) {
+    *x1 = x;
+    *y1 = y;
+    if(image) {
+        *w = pgm_read_word(&image->width);
+        *h = pgm_read_word(&image->height);
+    } else {
+        *w = bitmap ? this->w : 0;
+        *h = this->h;
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw the image
+    @param   gfx  The display
+*/
+/**************************************************************************/
+void GFXicon::paint(Adafruit_GFX &gfx, uint16_t) {
+    if(image) {
+        gfx.drawRLEImage(x, y, image);
+    } else if(bitmap) {
+        gfx.drawRGBBitmap(x, y, bitmap, w, h);
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate a progress bar, empty
+    @param   x      Left edge
+    @param   y      Top edge
+    @param   w      Width, outline included
+    @param   h      Height, outline included
+    @param   color  16-bit 5-6-5 outline and fill color
+    @param   bg     16-bit 5-6-5 color of the unfilled part
+*/
+/**************************************************************************/
+GFXprogressBar::GFXprogressBar(int16_t x, int16_t y, uint16_t w, uint16_t h,
+  uint16_t color, uint16_t bg) : GFXwidget(x, y), w(w), h(h), color(color),
+  bg(bg), filled(0) { }
+
+/**************************************************************************/
+/*!
+   @brief    Set how full the bar is. Only a change of at least a pixel
+             repaints it.
+    @param   value  Progress, 0 to max
+    @param   max    Value for a full bar
+*/
+/**************************************************************************/
+void GFXprogressBar::setValue(uint16_t value, uint16_t max) {
+    uint16_t inside = (w > 2) ? (w - 2) : 0,
+             f      = max ? (uint16_t)((uint32_t)min(value, max) * inside / max) : 0;
+    if(f != filled) {
+        filled = f;
+        invalidate();
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Set the colors
+    @param   color  16-bit 5-6-5 outline and fill color
+    @param   bg     16-bit 5-6-5 color of the unfilled part
+*/
+/**************************************************************************/
+void GFXprogressBar::setColor(uint16_t color, uint16_t bg) {
+    this->color = color;
+    this->bg    = bg;
+    invalidate();
+}
+
+/**************************************************************************/
+/*!
+   @brief    Get the box of the bar
+    @param   x1   Set to the left edge
+    @param   y1   Set to the top edge
+    @param   w    Set to the width
+    @param   h    Set to the height
+*/
+/**************************************************************************/
+void GFXprogressBar::getBounds(Adafruit_GFX &, int16_t *x1, int16_t *y1,
+  uint16_t *w, uint16_t *h) {
+    *x1 = x;
+    *y1 = y;
+    *w  = this->w;
+    *h  = this->h;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw the outline, the filled part and the rest
+    @param   gfx  The display
+*/
+/**************************************************************************/
+void GFXprogressBar::paint(Adafruit_GFX &gfx, uint16_t) {
+    gfx.drawRect(x, y, w, h, color);
+    if((w > 2) && (h > 2)) {
+        gfx.fillRect(x + 1, y + 1, filled, h - 2, color);
+        gfx.fillRect(x + 1 + filled, y + 1, w - 2 - filled, h - 2, this->bg);
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate a button
+    @param   x          Left edge
+    @param   y          Top edge
+    @param   w          Width
+    @param   h          Height
+    @param   label      Text in the classic font, copied
+    @param   outline    16-bit 5-6-5 outline color
+    @param   fill       16-bit 5-6-5 fill color
+    @param   textColor  16-bit 5-6-5 text color
+    @param   textSize   Text magnification
+*/
+/**************************************************************************/
+GFXbutton::GFXbutton(int16_t x, int16_t y, uint16_t w, uint16_t h,
+  const char *label, uint16_t outline, uint16_t fill, uint16_t textColor,
+  uint8_t textSize) : GFXwidget(x, y), w(w), h(h), outline(outline),
+  fill(fill), textColor(textColor), textSize(textSize), pressed(false) {
+    strncpy(this->label, label, GFX_LABEL_TEXT - 1);
+    this->label[GFX_LABEL_TEXT - 1] = 0;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Set whether the button is pressed, e.g. from a touch
+    @param   p  True for pressed
+*/
+/**************************************************************************/
+void GFXbutton::press(bool p) {
+    if(p != pressed) {
+        pressed = p;
+        invalidate();
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Get the box of the button
+    @param   x1   Set to the left edge
+    @param   y1   Set to the top edge
+    @param   w    Set to the width
+    @param   h    Set to the height
+*/
+/**************************************************************************/
+void GFXbutton::getBounds(Adafruit_GFX &, int16_t *x1, int16_t *y1,
+  uint16_t *w, uint16_t *h) {
+    *x1 = x;
+    *y1 = y;
+    *w  = this->w;
+    *h  = this->h;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw the button through Adafruit_GFX_Button, with the corners
+             its rounded outline leaves in the background color
+    @param   gfx  The display
+    @param   bg   The screen's background color
+*/
+/**************************************************************************/
+void GFXbutton::paint(Adafruit_GFX &gfx, uint16_t bg) {
+    uint8_t r = min(w, h) / 4; // Adafruit_GFX_Button's corner radius
+    gfx.fillRect(x, y, r, r, bg);
+    gfx.fillRect(x + w - r, y, r, r, bg);
+    gfx.fillRect(x, y + h - r, r, r, bg);
+    gfx.fillRect(x + w - r, y + h - r, r, r, bg);
+    gfx.setFont(NULL);
+    gfx.setTextWrap(false);
+    Adafruit_GFX_Button button;
+    button.initButtonUL(&gfx, x, y, w, h, outline, fill, textColor, label,
+      textSize);
+    button.drawButton(pressed);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate a screen with no widgets. The first render()
+             clears the display.
+    @param   gfx  Display (or canvas) to draw on
+    @param   bg   16-bit 5-6-5 background color
+*/
+/**************************************************************************/
+GFXscreen::GFXscreen(Adafruit_GFX &gfx, uint16_t bg) : gfx(gfx), first(NULL),
+  bg(bg), all(true), numAreas(0) { }
+
+/**************************************************************************/
+/*!
+   @brief    Put a widget on top of the others. A widget can be on one
+             screen at a time.
+    @param   w  The widget, which must stay around while it's on the screen
+*/
+/**************************************************************************/
+void GFXscreen::add(GFXwidget &w) {
+    GFXwidget **p = &first;
+    while(*p) {
+        if(*p == &w) return;
+        p = &(*p)->next;
+    }
+    *p        = &w;
+    w.next    = NULL;
+    w.dirty   = true;
+    w.painted = false;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Take a widget off the screen. Its box is cleared, and widgets
+             it overlapped are repainted, at the next render().
+    @param   w  The widget
+*/
+/**************************************************************************/
+void GFXscreen::remove(GFXwidget &w) {
+    for(GFXwidget **p = &first; *p; p = &(*p)->next) {
+        if(*p == &w) {
+            *p = w.next;
+            if(w.painted) {
+                for(GFXwidget *o = first; o; o = o->next) {
+                    if(o->painted && (o->px < w.px + (int16_t)w.pw) &&
+                       (w.px < o->px + (int16_t)o->pw) &&
+                       (o->py < w.py + (int16_t)w.ph) &&
+                       (w.py < o->py + (int16_t)o->ph)) o->dirty = true;
+                }
+                gfx.fillRect(w.px, w.py, w.pw, w.ph, bg);
+            }
+            w.next    = NULL;
+            w.painted = false;
+            return;
+        }
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Change the background color. Everything is repainted at the
+             next render().
+    @param   color  16-bit 5-6-5 color
+*/
+/**************************************************************************/
+void GFXscreen::setBackground(uint16_t color) {
+    bg = color;
+    redraw();
+}
+
+/**************************************************************************/
+/*!
+   @brief    Clear the display and paint every widget at the next
+             render(), e.g. after something else drew on the display
+*/
+/**************************************************************************/
+void GFXscreen::redraw(void) {
+    all = true;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Repaint the widgets that changed and any they uncover or
+             overlap
+    @returns Number of widgets painted
+*/
+/**************************************************************************/
+uint8_t GFXscreen::render(void) {
+    numAreas = 0;
+    if(all) {
+        gfx.fillScreen(bg);
+        for(GFXwidget *w = first; w; w = w->next) {
+            w->dirty   = true;
+            w->painted = false;
+        }
+        all = false;
+    }
+
+    // Clear what changed widgets no longer cover, and note their new boxes
+    for(GFXwidget *w = first; w; w = w->next) {
+        if(!w->dirty) continue;
+        int16_t  x1 = 0, y1 = 0;
+        uint16_t nw = 0, nh = 0;
+        if(w->visible) w->getBounds(gfx, &x1, &y1, &nw, &nh);
+        int16_t  x2 = x1 + nw - 1, y2 = y1 + nh - 1;
+        if(w->painted) {
+            int16_t ox1 = w->px, oy1 = w->py,
+                    ox2 = w->px + w->pw - 1, oy2 = w->py + w->ph - 1;
+            if(!nw || !nh || (x1 > ox2) || (x2 < ox1) || (y1 > oy2) ||
+               (y2 < oy1)) {
+                clear(ox1, oy1, ox2, oy2);
+            } else {
+                int16_t top = max(oy1, y1), bottom = min(oy2, y2);
+                clear(ox1, oy1, ox2, y1 - 1);
+                clear(ox1, y2 + 1, ox2, oy2);
+                clear(ox1, top, x1 - 1, bottom);
+                clear(x2 + 1, top, ox2, bottom);
+            }
+        }
+        w->px      = x1;
+        w->py      = y1;
+        w->pw      = nw;
+        w->ph      = nh;
+        w->painted = nw && nh;
+    }
+
+    // Paint, bottom to top, the changed widgets and any under or over
+    // something cleared or painted
+    uint8_t n = 0;
+    for(GFXwidget *w = first; w; w = w->next) {
+        int16_t x2 = w->px + w->pw - 1, y2 = w->py + w->ph - 1;
+        if(w->painted &&
+           (w->dirty || damaged(w->px, w->py, x2, y2))) {
+            w->paint(gfx, bg);
+            damage(w->px, w->py, x2, y2);
+            n++;
+        }
+        w->dirty = false;
+    }
+    return n;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Fill an area with the background color, if it's not empty,
+             and note it
+    @param   x1  Left edge
+    @param   y1  Top edge
+    @param   x2  Right edge, inclusive
+    @param   y2  Bottom edge, inclusive
+*/
+/**************************************************************************/
+void GFXscreen::clear(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    if((x1 > x2) || (y1 > y2)) return;
+    gfx.fillRect(x1, y1, x2 - x1 + 1, y2 - y1 + 1, bg);
+    damage(x1, y1, x2, y2);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Note an area cleared or painted during render(). When the
+             list is full the last area grows to take it in.
+    @param   x1  Left edge
+    @param   y1  Top edge
+    @param   x2  Right edge, inclusive
+    @param   y2  Bottom edge, inclusive
+*/
+/**************************************************************************/
+void GFXscreen::damage(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    if(numAreas < GFX_WIDGET_DAMAGE) {
+        Rect r = { x1, y1, x2, y2 };
+        areas[numAreas++] = r;
+    } else {
+        Rect &r = areas[numAreas - 1];
+        r.x1 = min(r.x1, x1);
+        r.y1 = min(r.y1, y1);
+        r.x2 = max(r.x2, x2);
+        r.y2 = max(r.y2, y2);
+    }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Whether an area overlaps anything cleared or painted so far
+    @param   x1  Left edge
+    @param   y1  Top edge
+    @param   x2  Right edge, inclusive
+    @param   y2  Bottom edge, inclusive
+    @returns True if it does
+*/
+/**************************************************************************/
+bool GFXscreen::damaged(int16_t x1, int16_t y1, int16_t x2, int16_t y2) const {
+    for(uint8_t i=0; i<numAreas; i++) {
+        const Rect &r = areas[i];
+        if((x1 <= r.x2) && (r.x1 <= x2) && (y1 <= r.y2) && (r.y1 <= y2)) {
+            return true;
+        }
+    }
+    return false;
+}
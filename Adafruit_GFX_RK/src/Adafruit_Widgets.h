@@ -0,0 +1,245 @@
+/*!
+ * @file Adafruit_Widgets.h
+ *
+ * Part of Adafruit's GFX graphics library. A few retained widgets (text
+ * labels, icons, progress bars and buttons) on a screen that repaints
+ * only the widgets that changed, and whatever they uncovered or overlap.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _ADAFRUIT_WIDGETS_H_
+#define _ADAFRUIT_WIDGETS_H_
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_AlphaFont.h"
+#include "Adafruit_RLEImage.h"
+
+#if !defined(GFX_LABEL_TEXT)
+ #define GFX_LABEL_TEXT   96 ///< Longest label text, plus 1
+#endif
+#if !defined(GFX_WIDGET_DAMAGE)
+ #define GFX_WIDGET_DAMAGE 16 ///< Rectangles render() tracks before merging them
+#endif
+
+class GFXscreen;
+
+/*!
+  @brief  Something on a GFXscreen. Setting any property marks it dirty;
+          the screen repaints it at the next render().
+
+          Subclasses give the box they paint in, which must cover every
+          pixel paint() touches, and paint() must cover the whole box
+          (background included), so nothing needs clearing first.
+*/
+class GFXwidget {
+ public:
+  GFXwidget(int16_t x, int16_t y);
+  virtual ~GFXwidget(void) { }
+  void      moveTo(int16_t x, int16_t y),
+            show(bool visible),
+            invalidate(void);
+  /**********************************************************************/
+  /*!
+    @brief    Whether the widget is shown
+    @returns  True if it's drawn at render()
+  */
+  /**********************************************************************/
+  bool      isVisible(void) const { return visible; }
+
+ protected:
+  /*!
+    @brief  Get the box the widget paints in
+    @param  gfx  The screen's display, for measuring text
+    @param  x1   Set to the left edge
+    @param  y1   Set to the top edge
+    @param  w    Set to the width, 0 for nothing to paint
+    @param  h    Set to the height
+  */
+  virtual void getBounds(Adafruit_GFX &gfx, int16_t *x1, int16_t *y1,
+                 uint16_t *w, uint16_t *h) = 0;
+  /*!
+    @brief  Draw the widget, covering its whole box
+    @param  gfx  The screen's display
+    @param  bg   The screen's background color
+  */
+  virtual void paint(Adafruit_GFX &gfx, uint16_t bg) = 0;
+
+  int16_t   x, y;   ///< Where the widget is, as each kind defines
+
+ private:
+  friend class GFXscreen;
+  GFXwidget *next;  ///< Next widget up on the screen
+  bool      dirty, visible, painted;
+  int16_t   px, py; ///< Box last painted
+  uint16_t  pw, ph;
+};
+
+/*!
+  @brief  Text in the classic font, a GFXfont or a GFXalphaFont. The
+          position is the cursor: top left for the classic font, left end
+          of the baseline for the others. Text doesn't wrap.
+*/
+class GFXlabel : public GFXwidget {
+ public:
+  GFXlabel(int16_t x, int16_t y, const char *text = "", uint16_t color = 0xFFFF);
+  void      setText(const char *text),
+            setColor(uint16_t color),
+            setColor(uint16_t color, uint16_t bg),
+            setTextSize(uint8_t size),
+            setFont(const GFXfont *f),
+            setAlphaFont(const GFXalphaFont *f);
+  /**********************************************************************/
+  /*!
+    @brief    Get the label's text
+    @returns  The text, as copied by setText()
+  */
+  /**********************************************************************/
+  const char *getText(void) const { return text; }
+
+ protected:
+  void      getBounds(Adafruit_GFX &gfx, int16_t *x1, int16_t *y1,
+              uint16_t *w, uint16_t *h),
+            paint(Adafruit_GFX &gfx, uint16_t bg);
+
+ private:
+  void      setupText(Adafruit_GFX &gfx);
+
+  char      text[GFX_LABEL_TEXT];
+  const GFXfont      *font;       ///< NULL for the classic font
+  const GFXalphaFont *alphaFont;  ///< Used instead if not NULL
+  uint16_t  color, bg;
+  bool      ownBg;                ///< bg set, else the screen's
+  uint8_t   size;
+};
+
+/*!
+  @brief  A 16-bit bitmap or a GFXrleImage, its top left corner at the
+          position
+*/
+class GFXicon : public GFXwidget {
+ public:
+  GFXicon(int16_t x, int16_t y, const uint16_t *bitmap, uint16_t w,
+    uint16_t h);
+  GFXicon(int16_t x, int16_t y, const GFXrleImage *image);
+  void      setImage(const uint16_t *bitmap, uint16_t w, uint16_t h),
+            setImage(const GFXrleImage *image);
+
+ protected:
+  void      getBounds(Adafruit_GFX &gfx, int16_t *x1, int16_t *y1,
+              uint16_t *w, uint16_t *h),
+            paint(Adafruit_GFX &gfx, uint16_t bg);
+
+ private:
+  const uint16_t    *bitmap;
+  const GFXrleImage *image;  ///< Used instead if not NULL
+  uint16_t  w, h;
+};
+
+/*!
+  @brief  A horizontal bar filled from the left in proportion to a value,
+          with a 1 pixel outline
+*/
+class GFXprogressBar : public GFXwidget {
+ public:
+  GFXprogressBar(int16_t x, int16_t y, uint16_t w, uint16_t h,
+    uint16_t color = 0xFFFF, uint16_t bg = 0x0000);
+  void      setValue(uint16_t value, uint16_t max = 100),
+            setColor(uint16_t color, uint16_t bg);
+
+ protected:
+  void      getBounds(Adafruit_GFX &gfx, int16_t *x1, int16_t *y1,
+              uint16_t *w, uint16_t *h),
+            paint(Adafruit_GFX &gfx, uint16_t bg);
+
+ private:
+  uint16_t  w, h, color, bg;
+  uint16_t  filled;  ///< Pixels of the inside filled
+};
+
+/*!
+  @brief  An Adafruit_GFX_Button, its top left corner at the position,
+          drawn inverted while pressed
+*/
+class GFXbutton : public GFXwidget {
+ public:
+  GFXbutton(int16_t x, int16_t y, uint16_t w, uint16_t h, const char *label,
+    uint16_t outline, uint16_t fill, uint16_t textColor, uint8_t textSize = 1);
+  void      press(bool p);
+  /**********************************************************************/
+  /*!
+    @brief    Whether a point, e.g. a touch, is on the button
+    @param    px  X coordinate
+    @param    py  Y coordinate
+    @returns  True if it is
+  */
+  /**********************************************************************/
+  bool      contains(int16_t px, int16_t py) const {
+    return (px >= x) && (px < x + (int16_t)w) && (py >= y) &&
+           (py < y + (int16_t)h);
+  }
+  /**********************************************************************/
+  /*!
+    @brief    Whether the button is pressed
+    @returns  True if press(true) was the last call
+  */
+  /**********************************************************************/
+  bool      isPressed(void) const { return pressed; }
+
+ protected:
+  void      getBounds(Adafruit_GFX &gfx, int16_t *x1, int16_t *y1,
+              uint16_t *w, uint16_t *h),
+            paint(Adafruit_GFX &gfx, uint16_t bg);
+
+ private:
+  char      label[GFX_LABEL_TEXT];
+  uint16_t  w, h, outline, fill, textColor;
+  uint8_t   textSize;
+  bool      pressed;
+};
+
+/*!
+  @brief  The widgets on a display, later ones on top of earlier ones.
+
+          render() repaints the dirty widgets. Where a widget moved, shrank
+          or was hidden, the part of its old box it no longer covers is
+          filled with the background color; any widget under or over a
+          repainted or cleared area is repainted too. Widgets paint their
+          whole box, so nothing is cleared before it's drawn over.
+
+          Labels set the display's font, text size, color and wrap when
+          they're measured and painted.
+*/
+class GFXscreen {
+ public:
+  GFXscreen(Adafruit_GFX &gfx, uint16_t bg = 0x0000);
+  void      add(GFXwidget &w),
+            remove(GFXwidget &w),
+            setBackground(uint16_t color),
+            redraw(void);
+  uint8_t   render(void);
+  /**********************************************************************/
+  /*!
+    @brief    Get the background color
+    @returns  16-bit 5-6-5 color
+  */
+  /**********************************************************************/
+  uint16_t  getBackground(void) const { return bg; }
+
+ private:
+  /// Area cleared or painted during render(), corners inclusive
+  struct Rect { int16_t x1, y1, x2, y2; };
+
+  void      damage(int16_t x1, int16_t y1, int16_t x2, int16_t y2),
+            clear(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+  bool      damaged(int16_t x1, int16_t y1, int16_t x2, int16_t y2) const;
+
+  Adafruit_GFX &gfx;
+  GFXwidget *first;
+  uint16_t  bg;
+  bool      all;     ///< Clear the display and paint everything
+  Rect      areas[GFX_WIDGET_DAMAGE];
+  uint8_t   numAreas;
+};
+
+#endif // _ADAFRUIT_WIDGETS_H_
@@ -0,0 +1,627 @@
+const uint8_t FreeMono12pt4aBitmaps[] PROGMEM = {
+  0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0B, 0x40, 0x80,
+  0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x08, 0x48, 0xFF, 0x4F, 0xB0, 0xBF,
+  0xF4, 0x4F, 0xFB, 0x8F, 0xF0, 0x0F, 0xF8, 0x8F, 0xF0, 0x0F, 0xF8, 0x8F,
+  0xF0, 0x0F, 0xF8, 0x0F, 0xB0, 0x0B, 0xF4, 0x0F, 0x80, 0x08, 0xF0, 0x0F,
+  0x80, 0x08, 0xF0, 0x00, 0x04, 0x40, 0x44, 0x00, 0x00, 0x08, 0x80, 0x88,
+  0x00, 0x00, 0x08, 0x80, 0x88, 0x00, 0x00, 0x08, 0x80, 0x88, 0x00, 0x00,
+  0x08, 0x80, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x8F, 0xFF, 0xFF,
+  0xFF, 0xF8, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00,
+  0x00, 0x0F, 0x00, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F,
+  0x04, 0xF0, 0x00, 0x00, 0x8B, 0x08, 0x80, 0x00, 0x00, 0x88, 0x08, 0x80,
+  0x00, 0x00, 0x88, 0x08, 0x80, 0x00, 0x00, 0x88, 0x08, 0x80, 0x00, 0x00,
+  0x44, 0x04, 0x40, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x4B, 0xFF, 0xB4, 0x80, 0x04, 0xF4, 0x00, 0x4B, 0xF0,
+  0x0F, 0x40, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xB8, 0x80, 0x00, 0x00, 0x00, 0x48, 0xBF,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x40, 0x00, 0x00, 0x00, 0x88, 0x88,
+  0x00, 0x00, 0x00, 0xB8, 0x8F, 0x84, 0x00, 0x4B, 0xB0, 0x44, 0x8F, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+  0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x48, 0x40, 0x00, 0x00, 0x0B, 0xB8,
+  0xBB, 0x00, 0x00, 0x4B, 0x00, 0x0B, 0x40, 0x00, 0x88, 0x00, 0x08, 0x80,
+  0x00, 0x4B, 0x00, 0x0B, 0x40, 0x00, 0x0B, 0xB8, 0xBB, 0x00, 0x08, 0x00,
+  0x48, 0x44, 0x8B, 0xB8, 0x00, 0x48, 0xFB, 0x80, 0x00, 0x8F, 0xB8, 0x00,
+  0x00, 0x00, 0x80, 0x00, 0x4B, 0xFB, 0x40, 0x00, 0x00, 0xF4, 0x04, 0xF0,
+  0x00, 0x08, 0x80, 0x00, 0x88, 0x00, 0x08, 0x80, 0x00, 0x88, 0x00, 0x00,
+  0xF4, 0x04, 0xF4, 0x00, 0x00, 0x4B, 0xFB, 0x40, 0x00, 0x04, 0x88, 0x44,
+  0x00, 0x00, 0x4F, 0x88, 0xB4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
+  0x00, 0x00, 0x04, 0xFB, 0xB0, 0x04, 0x84, 0x4F, 0x00, 0xB4, 0x08, 0xB4,
+  0x88, 0x00, 0x4F, 0x0F, 0x00, 0x88, 0x00, 0x08, 0xBB, 0x00, 0x4B, 0x00,
+  0x00, 0xF8, 0x00, 0x0B, 0xB0, 0x0B, 0xBB, 0x84, 0x00, 0x8F, 0xF8, 0x08,
+  0x84, 0x4F, 0xFB, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x08, 0xF4, 0x08,
+  0xF0, 0x08, 0xF0, 0x00, 0x44, 0x00, 0xF4, 0x08, 0xB0, 0x0F, 0x80, 0x4F,
+  0x00, 0x8F, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0x8B, 0x00, 0x8F, 0x00, 0x0F, 0x40, 0x0B, 0x80, 0x04, 0xF0, 0x00,
+  0xB4, 0x00, 0x04, 0x80, 0x00, 0xB8, 0x00, 0x4F, 0x00, 0x0F, 0x80, 0x08,
+  0xB0, 0x08, 0xF0, 0x04, 0xF4, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0x04, 0xF0, 0x08, 0xF0, 0x08, 0x80, 0x0F, 0x40, 0x8B, 0x00, 0xF4,
+  0x00, 0x40, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00,
+  0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x4B, 0x80, 0x88, 0x08, 0xB8, 0x04,
+  0x8F, 0xFF, 0xF8, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0x44,
+  0xB0, 0x00, 0x00, 0x8B, 0x00, 0xB8, 0x00, 0x00, 0x80, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00,
+  0x00, 0x88, 0x88, 0xBB, 0x88, 0x88, 0x88, 0x88, 0xBB, 0x88, 0x88, 0x00,
+  0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00,
+  0x08, 0xFF, 0x40, 0xBF, 0xB0, 0x0F, 0xF4, 0x08, 0xFB, 0x00, 0x8F, 0x40,
+  0x0F, 0xB0, 0x00, 0xF4, 0x00, 0x00, 0x08, 0x88, 0x88, 0x88, 0x88, 0x84,
+  0x08, 0x88, 0x88, 0x88, 0x88, 0x84, 0x4F, 0xFB, 0x8F, 0xFF, 0x4F, 0xFB,
+  0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
+  0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xB0,
+  0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00,
+  0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xB4, 0x00, 0x04,
+  0xF8, 0x00, 0x8F, 0x00, 0x0B, 0x80, 0x00, 0x08, 0xB0, 0x0F, 0x00, 0x00,
+  0x00, 0xF0, 0x8B, 0x00, 0x00, 0x00, 0xB8, 0x88, 0x00, 0x00, 0x00, 0x88,
+  0x88, 0x00, 0x00, 0x00, 0x88, 0x88, 0x00, 0x00, 0x00, 0x88, 0x88, 0x00,
+  0x00, 0x00, 0x88, 0x88, 0x00, 0x00, 0x00, 0x88, 0x8B, 0x00, 0x00, 0x00,
+  0xB8, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x08, 0xB0, 0x04,
+  0xF8, 0x00, 0x8F, 0x00, 0x00, 0x4B, 0xFF, 0xB4, 0x00, 0x00, 0x4F, 0x80,
+  0x00, 0x04, 0xFB, 0x80, 0x00, 0x4F, 0x48, 0x80, 0x00, 0xF4, 0x08, 0x80,
+  0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80,
+  0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80,
+  0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80,
+  0x00, 0x88, 0x8B, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x4B, 0xFF,
+  0xB4, 0x00, 0x04, 0xB4, 0x00, 0x4F, 0x40, 0x4F, 0x00, 0x00, 0x04, 0xF0,
+  0x88, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0xB4,
+  0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
+  0x0B, 0x40, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00,
+  0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0xB8, 0x48, 0x88, 0x88, 0x88, 0x84,
+  0x00, 0x4B, 0xFF, 0xF8, 0x00, 0x04, 0xB4, 0x00, 0x4B, 0xB0, 0x08, 0x00,
+  0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x48, 0x8F, 0x40, 0x00,
+  0x00, 0x48, 0xBB, 0x40, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0x44, 0x00, 0x00, 0x00, 0xB8, 0x4F, 0x84, 0x00, 0x4B, 0xB0, 0x00, 0x8B,
+  0xFF, 0xB8, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x8B, 0xF0, 0x00,
+  0x00, 0xB0, 0xF0, 0x00, 0x0B, 0x40, 0xF0, 0x00, 0x4B, 0x00, 0xF0, 0x00,
+  0xB0, 0x00, 0xF0, 0x04, 0x40, 0x00, 0xF0, 0x0B, 0x00, 0x00, 0xF0, 0x84,
+  0x00, 0x00, 0xF0, 0xB8, 0x88, 0x88, 0xF8, 0x88, 0x88, 0x88, 0xF8, 0x00,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x88, 0xF8, 0x00,
+  0x00, 0x88, 0x88, 0x04, 0x88, 0x88, 0x88, 0x40, 0x08, 0xB8, 0x88, 0x88,
+  0x40, 0x08, 0x80, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x08,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0x80, 0x88, 0x80, 0x00, 0x08, 0xF8, 0x88,
+  0x8F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x4B,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x00, 0x00, 0x4B, 0x44, 0x00, 0x00, 0x00, 0xB8, 0x4F, 0x84, 0x00, 0x4B,
+  0xB0, 0x00, 0x8B, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x04,
+  0xFB, 0x40, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
+  0x8B, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x4B, 0xFF,
+  0xB0, 0x0F, 0x4F, 0x80, 0x08, 0xF0, 0xFB, 0x40, 0x00, 0x08, 0x8F, 0x80,
+  0x00, 0x00, 0x0F, 0xB4, 0x00, 0x00, 0x00, 0xF8, 0x80, 0x00, 0x00, 0x0F,
+  0x0F, 0x40, 0x00, 0x08, 0x80, 0x4F, 0x40, 0x08, 0xB0, 0x00, 0x4B, 0xFF,
+  0x80, 0x00, 0x48, 0x88, 0x88, 0x88, 0x84, 0x8B, 0x88, 0x88, 0x88, 0xB8,
+  0x88, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x0F,
+  0x00, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x08,
+  0x80, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00,
+  0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xB4, 0x00, 0x0B, 0xB4,
+  0x00, 0x4B, 0xB0, 0x4F, 0x00, 0x00, 0x00, 0xF4, 0x88, 0x00, 0x00, 0x00,
+  0x88, 0x88, 0x00, 0x00, 0x00, 0x88, 0x0B, 0x40, 0x00, 0x04, 0xB0, 0x00,
+  0xBB, 0x88, 0xBB, 0x00, 0x00, 0xBB, 0x88, 0xBB, 0x00, 0x0B, 0x40, 0x00,
+  0x04, 0xB0, 0x4B, 0x00, 0x00, 0x00, 0xB4, 0x88, 0x00, 0x00, 0x00, 0x88,
+  0x88, 0x00, 0x00, 0x00, 0x88, 0x0F, 0x00, 0x00, 0x04, 0xF0, 0x04, 0xB4,
+  0x00, 0x4F, 0x40, 0x00, 0x4B, 0xFF, 0xB4, 0x00, 0x00, 0xBF, 0xFB, 0x40,
+  0x00, 0xB8, 0x00, 0x4F, 0x40, 0x88, 0x00, 0x00, 0x4F, 0x0F, 0x00, 0x00,
+  0x00, 0x88, 0xF0, 0x00, 0x00, 0x04, 0xBF, 0x00, 0x00, 0x00, 0x8F, 0x88,
+  0x00, 0x00, 0x4B, 0xF0, 0xF8, 0x00, 0x8F, 0x0F, 0x00, 0xBF, 0xFB, 0x40,
+  0xF0, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
+  0x04, 0xF0, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x4B, 0xF4, 0x00, 0xBF,
+  0xFF, 0x80, 0x00, 0x00, 0x08, 0x84, 0x8F, 0xFF, 0x8F, 0xFF, 0x08, 0x84,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x8F, 0xFF,
+  0x4F, 0xFB, 0x00, 0x48, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00,
+  0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xF4, 0x04, 0xFF, 0x80, 0x08, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x0F,
+  0xF0, 0x00, 0x4F, 0x80, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x4B,
+  0xB0, 0x00, 0x00, 0x00, 0x4B, 0xB4, 0x00, 0x00, 0x00, 0x0B, 0xB4, 0x00,
+  0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x48, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xB4, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xBB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00,
+  0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x04,
+  0xFB, 0x00, 0x00, 0x00, 0x4B, 0xB4, 0x00, 0x00, 0x00, 0xBB, 0x40, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xBF, 0xFF, 0x80,
+  0x0F, 0x84, 0x00, 0x4B, 0xB0, 0xF0, 0x00, 0x00, 0x0B, 0x48, 0x00, 0x00,
+  0x00, 0x88, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x08, 0xB0, 0x00,
+  0x00, 0x8F, 0xB0, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00,
+  0x4B, 0xFF, 0xB4, 0x00, 0x04, 0xF8, 0x00, 0x4F, 0x40, 0x0B, 0x80, 0x00,
+  0x04, 0xB0, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x88, 0x00, 0x00, 0x88, 0xF0,
+  0x88, 0x00, 0x4F, 0xB8, 0xF0, 0x88, 0x04, 0xF4, 0x00, 0xF0, 0x88, 0x08,
+  0x80, 0x00, 0xF0, 0x88, 0x08, 0x80, 0x00, 0xF0, 0x88, 0x00, 0xF8, 0x00,
+  0xF0, 0x88, 0x00, 0x4B, 0xFF, 0xF8, 0x88, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00,
+  0x04, 0x40, 0x00, 0x4B, 0xFF, 0xF8, 0x40, 0x00, 0x48, 0x88, 0x88, 0x00,
+  0x00, 0x00, 0x00, 0x48, 0x8B, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x88, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x4B, 0x00,
+  0x00, 0x00, 0x00, 0xB0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00,
+  0x08, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x48,
+  0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x88, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x4B, 0xB8, 0x80, 0x00, 0x08,
+  0x8B, 0xB8, 0x48, 0x88, 0x80, 0x00, 0x08, 0x88, 0x88, 0x48, 0x88, 0x88,
+  0x88, 0x40, 0x00, 0x48, 0xF8, 0x88, 0x88, 0xBB, 0x00, 0x00, 0xF0, 0x00,
+  0x00, 0x0B, 0xB0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+  0x00, 0x04, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x8F, 0x40, 0x00, 0xFF, 0xFF,
+  0xFF, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x4B, 0xB0, 0x00, 0xF0, 0x00,
+  0x00, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x88, 0x00, 0xF0, 0x00,
+  0x00, 0x00, 0x88, 0x00, 0xF0, 0x00, 0x00, 0x04, 0xF0, 0x48, 0xF8, 0x88,
+  0x88, 0x8F, 0x40, 0x48, 0x88, 0x88, 0x88, 0x80, 0x00, 0x00, 0x04, 0xBF,
+  0xFB, 0x80, 0x80, 0x00, 0xBB, 0x40, 0x04, 0xBB, 0xF0, 0x08, 0xB0, 0x00,
+  0x00, 0x08, 0xF0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x4B, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x4F, 0x80,
+  0x00, 0x8F, 0x40, 0x00, 0x04, 0x8F, 0xFF, 0x84, 0x00, 0x48, 0x88, 0x88,
+  0x88, 0x00, 0x00, 0x4B, 0xB8, 0x88, 0x8B, 0xF4, 0x00, 0x08, 0x80, 0x00,
+  0x00, 0x4F, 0x40, 0x08, 0x80, 0x00, 0x00, 0x08, 0xB0, 0x08, 0x80, 0x00,
+  0x00, 0x00, 0xF4, 0x08, 0x80, 0x00, 0x00, 0x00, 0x88, 0x08, 0x80, 0x00,
+  0x00, 0x00, 0x88, 0x08, 0x80, 0x00, 0x00, 0x00, 0x88, 0x08, 0x80, 0x00,
+  0x00, 0x00, 0x88, 0x08, 0x80, 0x00, 0x00, 0x00, 0xB4, 0x08, 0x80, 0x00,
+  0x00, 0x04, 0xB0, 0x08, 0x80, 0x00, 0x00, 0x4F, 0x40, 0x4B, 0xB8, 0x88,
+  0x8B, 0xF4, 0x00, 0x48, 0x88, 0x88, 0x88, 0x00, 0x00, 0x48, 0x88, 0x88,
+  0x88, 0x88, 0x80, 0x48, 0xF8, 0x88, 0x88, 0x88, 0xF0, 0x00, 0xF0, 0x00,
+  0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x88, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x88, 0x00, 0x00, 0x00, 0xF0, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x44, 0x00, 0xF0, 0x00,
+  0x00, 0x00, 0x88, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x88, 0x48, 0xF8, 0x88,
+  0x88, 0x88, 0xB8, 0x48, 0x88, 0x88, 0x88, 0x88, 0x84, 0x48, 0x88, 0x88,
+  0x88, 0x88, 0x84, 0x48, 0xF8, 0x88, 0x88, 0x88, 0xB8, 0x00, 0xF0, 0x00,
+  0x00, 0x00, 0x88, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x88, 0x00, 0xF0, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x88, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x88, 0x00, 0x00, 0x00, 0xF0, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x48, 0xF8, 0x88,
+  0x40, 0x00, 0x00, 0x48, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x04, 0xBF,
+  0xFF, 0xB4, 0x44, 0x00, 0x4F, 0x80, 0x00, 0x4B, 0xF8, 0x04, 0xB0, 0x00,
+  0x00, 0x00, 0xB8, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x44, 0x4F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x08, 0x88, 0x88, 0x88, 0x00, 0x00,
+  0x08, 0x88, 0xBB, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x88, 0x0F, 0x00, 0x00,
+  0x00, 0x00, 0x88, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x88, 0x00, 0x8F, 0x80,
+  0x00, 0x08, 0xB8, 0x00, 0x04, 0x8F, 0xFF, 0xF8, 0x40, 0x08, 0x88, 0x40,
+  0x00, 0x88, 0x84, 0x08, 0xF8, 0x40, 0x00, 0x8B, 0xB4, 0x00, 0xF0, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x08, 0x80, 0x00, 0xF0, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x08, 0x80, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x08, 0x80, 0x00, 0xF0, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x08, 0x80, 0x00, 0xF0, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x08, 0x80, 0x48, 0xF8, 0x40,
+  0x00, 0x8B, 0xB8, 0x48, 0x88, 0x40, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x8B, 0xB8, 0x88, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80,
+  0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80,
+  0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80,
+  0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80, 0x00, 0x88, 0x8B, 0xB8,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x00, 0x88, 0x88, 0x88, 0x84, 0x00,
+  0x00, 0x88, 0x88, 0xF8, 0x84, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0,
+  0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF4,
+  0x00, 0x00, 0x08, 0x80, 0x00, 0x4F, 0x80, 0x00, 0x8B, 0x00, 0x00, 0x04,
+  0x8F, 0xFF, 0x80, 0x00, 0x00, 0x48, 0x88, 0x80, 0x00, 0x88, 0x88, 0x04,
+  0x8F, 0x88, 0x00, 0x08, 0xBB, 0x80, 0x00, 0xF0, 0x00, 0x00, 0xBB, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xB8, 0x00,
+  0x00, 0x00, 0x0F, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x0F, 0xB4, 0x08, 0xB0, 0x00, 0x00, 0x00, 0xF0, 0x00,
+  0x08, 0xB0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0x4B, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x48,
+  0xF8, 0x80, 0x00, 0x08, 0xB8, 0x44, 0x88, 0x88, 0x00, 0x00, 0x08, 0x84,
+  0x88, 0x88, 0x88, 0x00, 0x00, 0x08, 0x8B, 0xB8, 0x80, 0x00, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+  0x04, 0x40, 0x08, 0x80, 0x00, 0x00, 0x88, 0x00, 0x88, 0x00, 0x00, 0x08,
+  0x80, 0x08, 0x80, 0x00, 0x00, 0x88, 0x88, 0xBB, 0x88, 0x88, 0x8B, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x84, 0x48, 0x84, 0x00, 0x00, 0x00, 0x48, 0x84,
+  0x4B, 0xBB, 0x00, 0x00, 0x00, 0xBB, 0xB4, 0x08, 0x8B, 0x40, 0x00, 0x04,
+  0xB8, 0x80, 0x08, 0x88, 0xB0, 0x00, 0x0B, 0x88, 0x80, 0x08, 0x80, 0xF4,
+  0x00, 0x4F, 0x08, 0x80, 0x08, 0x80, 0x88, 0x00, 0x88, 0x08, 0x80, 0x08,
+  0x80, 0x0F, 0x00, 0xF0, 0x08, 0x80, 0x08, 0x80, 0x08, 0x88, 0x80, 0x08,
+  0x80, 0x08, 0x80, 0x00, 0xFF, 0x00, 0x08, 0x80, 0x08, 0x80, 0x00, 0x44,
+  0x00, 0x08, 0x80, 0x08, 0x80, 0x00, 0x00, 0x00, 0x08, 0x80, 0x08, 0x80,
+  0x00, 0x00, 0x00, 0x08, 0x80, 0x4B, 0xB8, 0x40, 0x00, 0x04, 0x8B, 0xB4,
+  0x48, 0x88, 0x40, 0x00, 0x04, 0x88, 0x84, 0x88, 0x80, 0x00, 0x00, 0x88,
+  0x88, 0x8B, 0xF4, 0x00, 0x00, 0x88, 0xF8, 0x08, 0xBF, 0x00, 0x00, 0x00,
+  0xF0, 0x08, 0x88, 0xB0, 0x00, 0x00, 0xF0, 0x08, 0x80, 0xB4, 0x00, 0x00,
+  0xF0, 0x08, 0x80, 0x4B, 0x00, 0x00, 0xF0, 0x08, 0x80, 0x0B, 0x80, 0x00,
+  0xF0, 0x08, 0x80, 0x00, 0xF4, 0x00, 0xF0, 0x08, 0x80, 0x00, 0x4B, 0x00,
+  0xF0, 0x08, 0x80, 0x00, 0x0B, 0x40, 0xF0, 0x08, 0x80, 0x00, 0x04, 0xF0,
+  0xF0, 0x08, 0x80, 0x00, 0x00, 0x8B, 0xF0, 0x4B, 0xB8, 0x40, 0x00, 0x0B,
+  0xF0, 0x48, 0x88, 0x40, 0x00, 0x04, 0x80, 0x00, 0x04, 0xBF, 0xFB, 0x80,
+  0x00, 0x00, 0xBB, 0x40, 0x04, 0xBB, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x0B,
+  0xB0, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x88, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x4F, 0x00, 0x00, 0x00, 0x00,
+  0xF4, 0x0B, 0xB0, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0xBB, 0x40, 0x04, 0xBB,
+  0x00, 0x00, 0x08, 0xBF, 0xFB, 0x80, 0x00, 0x48, 0x88, 0x88, 0x88, 0x40,
+  0x04, 0x8F, 0x88, 0x88, 0x8F, 0xB0, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0x80,
+  0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x0F,
+  0x00, 0x00, 0x00, 0x8B, 0x00, 0xF0, 0x00, 0x00, 0x8F, 0x00, 0x0F, 0xFF,
+  0xFF, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+  0x00, 0x48, 0xF8, 0x88, 0x40, 0x00, 0x04, 0x88, 0x88, 0x84, 0x00, 0x00,
+  0x00, 0x04, 0xBF, 0xFB, 0x40, 0x00, 0x00, 0xBB, 0x40, 0x04, 0xBB, 0x00,
+  0x0B, 0xB0, 0x00, 0x00, 0x0B, 0xB0, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xF4,
+  0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88,
+  0x4F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x04, 0xB0, 0x00, 0x00, 0x0B, 0xB0,
+  0x00, 0x4B, 0x40, 0x04, 0xBB, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x80, 0x00,
+  0x00, 0x08, 0xFB, 0x88, 0x40, 0x48, 0x00, 0x8F, 0x88, 0x88, 0xFF, 0xB4,
+  0x48, 0x88, 0x88, 0x88, 0x00, 0x00, 0x04, 0x8F, 0x88, 0x88, 0xBF, 0x40,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x08, 0x80, 0x00, 0x0F, 0x00, 0x00,
+  0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x0F, 0xFF,
+  0xFF, 0xB4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x0F,
+  0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x4F, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x00, 0x88, 0x00, 0x48, 0xF8, 0x80, 0x00, 0x00, 0xF8,
+  0x44, 0x88, 0x88, 0x00, 0x00, 0x04, 0x84, 0x00, 0x8F, 0xFF, 0xB4, 0x44,
+  0x0B, 0xB4, 0x00, 0x4B, 0xF8, 0x4B, 0x00, 0x00, 0x00, 0xB8, 0x88, 0x00,
+  0x00, 0x00, 0x88, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x08, 0x8B, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x8B, 0xFB, 0xB4, 0x00, 0x4B, 0xF4,
+  0x80, 0x8F, 0xFF, 0xF8, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x84, 0x8B,
+  0x88, 0x8B, 0xB8, 0x88, 0xB8, 0x88, 0x00, 0x08, 0x80, 0x00, 0x88, 0x88,
+  0x00, 0x08, 0x80, 0x00, 0x88, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x48, 0x8B, 0xB8, 0x84, 0x00, 0x00,
+  0x48, 0x88, 0x88, 0x84, 0x00, 0x48, 0x88, 0x40, 0x00, 0x88, 0x88, 0x4B,
+  0xB8, 0x40, 0x00, 0x88, 0xF8, 0x08, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x08,
+  0x80, 0x00, 0x00, 0x00, 0xF0, 0x08, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x08,
+  0x80, 0x00, 0x00, 0x00, 0xF0, 0x08, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x08,
+  0x80, 0x00, 0x00, 0x00, 0xF0, 0x08, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x08,
+  0x80, 0x00, 0x00, 0x00, 0xF0, 0x08, 0xB0, 0x00, 0x00, 0x04, 0xF0, 0x00,
+  0xF4, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x4F, 0x80, 0x04, 0xBB, 0x00, 0x00,
+  0x04, 0xBF, 0xFF, 0x80, 0x00, 0x48, 0x88, 0x80, 0x00, 0x08, 0x88, 0x88,
+  0x4B, 0xB8, 0x80, 0x00, 0x08, 0x8B, 0xB8, 0x00, 0xF0, 0x00, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x4B, 0x00,
+  0x00, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
+  0x00, 0x00, 0x00, 0xB8, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x00,
+  0xB4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x48, 0x88, 0x80, 0x00, 0x08,
+  0x88, 0x84, 0x4B, 0xB8, 0x80, 0x00, 0x08, 0x8B, 0xB4, 0x08, 0x80, 0x00,
+  0x00, 0x00, 0x08, 0x80, 0x08, 0x80, 0x00, 0xBF, 0x00, 0x08, 0x80, 0x00,
+  0xF0, 0x00, 0xFF, 0x40, 0x08, 0x40, 0x00, 0xF0, 0x04, 0x88, 0x80, 0x0B,
+  0x00, 0x00, 0xF0, 0x08, 0x84, 0xB0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0xB8, 0x0F, 0x00, 0x00, 0x88,
+  0x88, 0x00, 0x88, 0x48, 0x00, 0x00, 0x88, 0xB4, 0x00, 0x0F, 0x88, 0x00,
+  0x00, 0x88, 0xF0, 0x00, 0x0F, 0x88, 0x00, 0x00, 0x4B, 0x80, 0x00, 0x08,
+  0xF8, 0x00, 0x00, 0x08, 0x40, 0x00, 0x04, 0x80, 0x00, 0x48, 0x88, 0x00,
+  0x00, 0x88, 0x88, 0x4B, 0xB8, 0x00, 0x00, 0x8B, 0xB8, 0x00, 0xF4, 0x00,
+  0x00, 0x4F, 0x40, 0x00, 0x4F, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x08, 0xB0,
+  0x0B, 0x80, 0x00, 0x00, 0x00, 0xBB, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x0B,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xB4,
+  0x4B, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x08, 0xB0, 0x00, 0x00, 0x8B, 0x00,
+  0x00, 0xB8, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x0B, 0x40, 0x8F, 0xB8, 0x00,
+  0x00, 0x8B, 0xF8, 0x88, 0x88, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x00,
+  0x00, 0x88, 0x88, 0x8B, 0xB8, 0x00, 0x00, 0x8B, 0xB8, 0x00, 0xF4, 0x00,
+  0x00, 0x4F, 0x00, 0x00, 0x4B, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0x80,
+  0x08, 0xB0, 0x00, 0x00, 0x00, 0xF4, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x4B,
+  0xB4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x48, 0x8B,
+  0xB8, 0x84, 0x00, 0x00, 0x48, 0x88, 0x88, 0x84, 0x00, 0x08, 0x88, 0x88,
+  0x88, 0x80, 0x0F, 0x88, 0x88, 0x88, 0xF0, 0x0F, 0x00, 0x00, 0x0B, 0x80,
+  0x0F, 0x00, 0x00, 0x8B, 0x00, 0x08, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00,
+  0x0B, 0x80, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00,
+  0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x88, 0x04,
+  0xB0, 0x00, 0x00, 0x88, 0x4F, 0x40, 0x00, 0x00, 0x88, 0x8B, 0x88, 0x88,
+  0x88, 0xB8, 0x48, 0x88, 0x88, 0x88, 0x84, 0x48, 0x88, 0x8B, 0x88, 0x88,
+  0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88,
+  0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88,
+  0x00, 0x88, 0x00, 0x8B, 0x88, 0x48, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x80, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
+  0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00,
+  0x44, 0x88, 0x84, 0x88, 0xB8, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00,
+  0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00,
+  0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x88, 0xB8, 0x88,
+  0x84, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x40, 0x00, 0x00,
+  0x0F, 0x44, 0xF4, 0x00, 0x00, 0xB4, 0x00, 0x4B, 0x00, 0x0B, 0xB0, 0x00,
+  0x08, 0xB0, 0x4B, 0x00, 0x00, 0x00, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x44, 0x00, 0x04,
+  0xF4, 0x00, 0x04, 0xBB, 0x00, 0x00, 0xB8, 0x00, 0x88, 0xFF, 0xFB, 0x40,
+  0x00, 0x00, 0x84, 0x00, 0x04, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x04, 0x88, 0x88, 0x0F,
+  0x00, 0x04, 0xFF, 0x88, 0x88, 0xBF, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x0F,
+  0x00, 0x88, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x88, 0x00, 0x00, 0x00, 0xBF,
+  0x00, 0x0F, 0x80, 0x00, 0x8F, 0x4F, 0x84, 0x04, 0xBF, 0xFF, 0x80, 0x08,
+  0x84, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x80, 0x8F, 0xFF, 0x80, 0x00, 0x08, 0x8B, 0xB0, 0x00, 0xBB,
+  0x00, 0x08, 0xF8, 0x00, 0x00, 0x08, 0xB0, 0x08, 0xF0, 0x00, 0x00, 0x00,
+  0xF4, 0x08, 0x80, 0x00, 0x00, 0x00, 0x88, 0x08, 0x80, 0x00, 0x00, 0x00,
+  0x88, 0x08, 0x80, 0x00, 0x00, 0x00, 0x88, 0x08, 0xF0, 0x00, 0x00, 0x00,
+  0xF0, 0x08, 0xFB, 0x00, 0x00, 0x0B, 0xB0, 0x8B, 0x8B, 0xB0, 0x00, 0xBB,
+  0x00, 0x88, 0x40, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x4B, 0xFF, 0xF8, 0x08,
+  0x00, 0x4F, 0x80, 0x00, 0x8F, 0xF0, 0x4F, 0x00, 0x00, 0x00, 0x4F, 0x0B,
+  0x80, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x04, 0x40, 0x4F, 0x80, 0x00,
+  0x4B, 0xB4, 0x00, 0x4B, 0xFF, 0xFB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8F, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x08,
+  0xFF, 0xF8, 0x00, 0xF0, 0x00, 0x0B, 0xB4, 0x00, 0x8F, 0x4F, 0x00, 0x0B,
+  0xB0, 0x00, 0x00, 0x4F, 0xF0, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x08, 0x80, 0x00, 0x00, 0x00, 0x0F,
+  0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x00,
+  0x8F, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x4B, 0xF0, 0x00, 0x0B, 0xB4, 0x00,
+  0x8F, 0x4F, 0x84, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x88, 0x40, 0x00, 0x08,
+  0xFF, 0xFB, 0x40, 0x00, 0x4F, 0x80, 0x00, 0x4B, 0xB0, 0x0B, 0x40, 0x00,
+  0x00, 0x0B, 0x84, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0x8B, 0x88, 0x88, 0x88,
+  0x88, 0xF8, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x80,
+  0x0B, 0xB4, 0x00, 0x08, 0xBB, 0x00, 0x04, 0xBF, 0xFF, 0x84, 0x00, 0x00,
+  0x00, 0x48, 0x88, 0x80, 0x00, 0x0B, 0xB8, 0x88, 0x84, 0x00, 0x8B, 0x00,
+  0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x88, 0xBB, 0x88, 0x88, 0x40,
+  0x88, 0xBB, 0x88, 0x88, 0x40, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+  0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x88, 0xBB, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88,
+  0x88, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x04, 0x88, 0x00, 0xBB, 0x00, 0x08,
+  0xB8, 0xB8, 0x0B, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x4F, 0x00, 0x00, 0x00,
+  0x0F, 0x80, 0x88, 0x00, 0x00, 0x00, 0x08, 0x80, 0x88, 0x00, 0x00, 0x00,
+  0x08, 0x80, 0x88, 0x00, 0x00, 0x00, 0x08, 0x80, 0x0F, 0x00, 0x00, 0x00,
+  0x0F, 0x80, 0x08, 0xB0, 0x00, 0x00, 0xBB, 0x80, 0x00, 0x8F, 0x88, 0x8F,
+  0x48, 0x80, 0x00, 0x00, 0x88, 0x80, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0xBB, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x48, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x48, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x4F, 0xFF,
+  0x80, 0x00, 0x00, 0xFB, 0xB0, 0x00, 0xBB, 0x00, 0x00, 0xFB, 0x00, 0x00,
+  0x0B, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x08, 0x80, 0x00, 0xF0, 0x00, 0x00,
+  0x08, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x08, 0x80, 0x00, 0xF0, 0x00, 0x00,
+  0x08, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x08, 0x80, 0x00, 0xF0, 0x00, 0x00,
+  0x08, 0x80, 0x48, 0xF8, 0x40, 0x00, 0x8B, 0xB8, 0x48, 0x88, 0x40, 0x00,
+  0x88, 0x88, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88,
+  0x84, 0x00, 0x00, 0x04, 0x88, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00,
+  0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x48, 0x88, 0xBB, 0x88, 0x84,
+  0x48, 0x88, 0x88, 0x88, 0x84, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x08, 0xF0,
+  0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x8F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x04, 0xF4, 0xFF, 0xFF, 0xF4, 0x00,
+  0x88, 0x40, 0x00, 0x00, 0x00, 0x08, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80,
+  0x04, 0x88, 0x84, 0x00, 0x88, 0x00, 0x4B, 0xB8, 0x40, 0x08, 0x80, 0x0B,
+  0xB0, 0x00, 0x00, 0x88, 0x0B, 0xB0, 0x00, 0x00, 0x08, 0x8B, 0xB0, 0x00,
+  0x00, 0x00, 0x8F, 0x8F, 0x40, 0x00, 0x00, 0x08, 0x80, 0x4F, 0x40, 0x00,
+  0x00, 0x88, 0x00, 0x4F, 0x40, 0x00, 0x08, 0x80, 0x00, 0x4F, 0x40, 0x08,
+  0xB8, 0x00, 0x04, 0xBF, 0x88, 0x88, 0x40, 0x00, 0x48, 0x88, 0x80, 0x04,
+  0x88, 0x84, 0x00, 0x00, 0x04, 0x88, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+  0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00,
+  0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x00, 0x88, 0x00, 0x00, 0x48, 0x88, 0xBB, 0x88, 0x84, 0x48, 0x88, 0x88,
+  0x88, 0x84, 0x88, 0x44, 0xFF, 0x40, 0x4F, 0xF4, 0x00, 0x8B, 0xBB, 0x04,
+  0xF4, 0xB0, 0x4F, 0x40, 0x08, 0xB0, 0x00, 0x8B, 0x00, 0x08, 0x80, 0x08,
+  0x80, 0x00, 0x88, 0x00, 0x08, 0x80, 0x08, 0x80, 0x00, 0x88, 0x00, 0x08,
+  0x80, 0x08, 0x80, 0x00, 0x88, 0x00, 0x08, 0x80, 0x08, 0x80, 0x00, 0x88,
+  0x00, 0x08, 0x80, 0x08, 0x80, 0x00, 0x88, 0x00, 0x08, 0x80, 0x08, 0x80,
+  0x00, 0x88, 0x00, 0x08, 0x80, 0x8B, 0xB4, 0x00, 0x8B, 0x80, 0x08, 0xB8,
+  0x88, 0x84, 0x00, 0x48, 0x80, 0x04, 0x88, 0x48, 0x80, 0x4B, 0xFF, 0x80,
+  0x00, 0x48, 0xF4, 0xB4, 0x00, 0xBB, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x0B,
+  0x80, 0x00, 0xF0, 0x00, 0x00, 0x08, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x08,
+  0x80, 0x00, 0xF0, 0x00, 0x00, 0x08, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x08,
+  0x80, 0x00, 0xF0, 0x00, 0x00, 0x08, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x08,
+  0x80, 0x88, 0xF8, 0x40, 0x00, 0x4B, 0xB4, 0x88, 0x88, 0x40, 0x00, 0x48,
+  0x84, 0x00, 0x08, 0xBF, 0xFB, 0x80, 0x00, 0x00, 0xBB, 0x40, 0x04, 0xBB,
+  0x00, 0x0B, 0xB0, 0x00, 0x00, 0x0B, 0xB0, 0x0F, 0x00, 0x00, 0x00, 0x00,
+  0xF0, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x0F, 0x00, 0x00, 0x00, 0x00,
+  0xF0, 0x0B, 0xB0, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0xBB, 0x40, 0x04, 0xBB,
+  0x00, 0x00, 0x08, 0xBF, 0xFB, 0x80, 0x00, 0x88, 0x40, 0x8F, 0xFF, 0x80,
+  0x00, 0x8B, 0x8B, 0x80, 0x00, 0x8B, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x08,
+  0xB0, 0x08, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x08, 0x80, 0x00, 0x00, 0x00,
+  0x88, 0x08, 0x80, 0x00, 0x00, 0x00, 0x88, 0x08, 0x80, 0x00, 0x00, 0x00,
+  0x88, 0x08, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x08, 0xBB, 0x00, 0x00, 0x0B,
+  0x80, 0x08, 0x84, 0xF8, 0x88, 0xF8, 0x00, 0x08, 0x80, 0x08, 0x88, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xFF, 0xF8, 0x40, 0x88, 0x40, 0x0B, 0xB4, 0x00, 0x8F,
+  0x4F, 0x84, 0x0B, 0xB0, 0x00, 0x00, 0x0F, 0xF0, 0x04, 0xF0, 0x00, 0x00,
+  0x00, 0x8F, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x08, 0x80, 0x00,
+  0x00, 0x00, 0x0F, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF4,
+  0x00, 0x00, 0x00, 0xBF, 0x00, 0x04, 0xB4, 0x00, 0x00, 0x8B, 0xF0, 0x00,
+  0x04, 0xFB, 0x88, 0xFB, 0x0F, 0x00, 0x00, 0x00, 0x88, 0x84, 0x00, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0xFF, 0x80, 0x08, 0x88, 0x00, 0x04, 0x84, 0x00, 0x88, 0xF0, 0x4B,
+  0xB8, 0xBB, 0x00, 0x0F, 0x8F, 0x40, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x00, 0x04, 0x88, 0xF8, 0x88, 0x84, 0x00, 0x48, 0x88,
+  0x88, 0x88, 0x40, 0x00, 0x00, 0x8F, 0xFF, 0xB4, 0x80, 0x0B, 0xB4, 0x00,
+  0x4B, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x40, 0x00, 0x00, 0x80,
+  0x04, 0xF8, 0x40, 0x00, 0x00, 0x00, 0x08, 0x88, 0xFB, 0x40, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x44, 0x00, 0x00, 0x00, 0x88, 0x8B, 0x00, 0x00, 0x00,
+  0xB8, 0x8F, 0xB4, 0x00, 0x4B, 0xB0, 0x44, 0x8B, 0xFF, 0xF8, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x04, 0x8B, 0xB8, 0x88, 0x88, 0x00, 0x48, 0xBB, 0x88,
+  0x88, 0x80, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x8B, 0xB0, 0x00,
+  0x4B, 0xFF, 0xF8, 0x80, 0x48, 0x80, 0x00, 0x04, 0x88, 0x40, 0x48, 0xF0,
+  0x00, 0x04, 0x8B, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x08, 0x80, 0x00, 0xF0,
+  0x00, 0x00, 0x08, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x08, 0x80, 0x00, 0xF0,
+  0x00, 0x00, 0x08, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x08, 0x80, 0x00, 0xF0,
+  0x00, 0x00, 0x08, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x8B,
+  0x00, 0x48, 0xB8, 0xB8, 0x00, 0x08, 0xFF, 0xB8, 0x04, 0x88, 0x08, 0x88,
+  0x84, 0x00, 0x48, 0x88, 0x84, 0x08, 0xBB, 0x84, 0x00, 0x48, 0xBB, 0x84,
+  0x00, 0x4B, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
+  0xF0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x08, 0x84, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x08, 0x88, 0x40, 0x00, 0x04, 0x88, 0x84, 0x08, 0xF8,
+  0x40, 0x00, 0x04, 0x8B, 0x84, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00,
+  0x00, 0xB0, 0x00, 0xBB, 0x00, 0x0F, 0x00, 0x00, 0x88, 0x00, 0xFF, 0x00,
+  0x48, 0x00, 0x00, 0x88, 0x08, 0x88, 0x80, 0x88, 0x00, 0x00, 0x0B, 0x0B,
+  0x44, 0xB0, 0xB4, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+  0x08, 0xB8, 0x00, 0x88, 0xB0, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x0F, 0x80,
+  0x00, 0x00, 0x04, 0x80, 0x00, 0x08, 0x40, 0x00, 0x08, 0x88, 0x40, 0x04,
+  0x88, 0x84, 0x08, 0xF8, 0x40, 0x04, 0x8F, 0xB4, 0x00, 0x4B, 0x00, 0x00,
+  0xBB, 0x00, 0x00, 0x04, 0xB0, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x4B, 0xB8,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x4F,
+  0x40, 0x00, 0x00, 0x0B, 0x40, 0x04, 0xF4, 0x00, 0x00, 0xB4, 0x00, 0x00,
+  0x4F, 0x40, 0x4B, 0xB8, 0x40, 0x04, 0x8B, 0xF8, 0x48, 0x88, 0x40, 0x04,
+  0x88, 0x88, 0x48, 0x88, 0x00, 0x00, 0x88, 0x88, 0x4B, 0xB8, 0x00, 0x00,
+  0x88, 0xF8, 0x04, 0xB0, 0x00, 0x00, 0x08, 0x80, 0x00, 0xB4, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x88, 0x00, 0x00, 0x0B, 0x40, 0x00,
+  0xF0, 0x00, 0x00, 0x04, 0xB0, 0x08, 0x80, 0x00, 0x00, 0x00, 0xB4, 0x0F,
+  0x00, 0x00, 0x00, 0x00, 0x4B, 0x88, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88,
+  0x0F, 0x88, 0x88, 0x8B, 0xB0, 0xF0, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00,
+  0xB4, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
+  0x4B, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x08,
+  0x8B, 0xB8, 0x88, 0x88, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00,
+  0x84, 0x00, 0x0F, 0x84, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0xB4, 0x00, 0x8B, 0x80,
+  0x00, 0x8B, 0x80, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x0F,
+  0x84, 0x00, 0x00, 0x84, 0x44, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x44, 0x48, 0x00,
+  0x00, 0x48, 0xF0, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x08,
+  0xB8, 0x00, 0x08, 0xB8, 0x00, 0x4B, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x48, 0xF0,
+  0x00, 0x48, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x4F, 0x88, 0xF4,
+  0x00, 0x4F, 0xB4, 0x00, 0x4B, 0xB8, 0xF4, 0x00, 0x00, 0x00, 0x88, 0x00 };
+
+const GFXglyph FreeMono12pt4aGlyphs[] PROGMEM = {
+  {     0,   0,   0,  14,    0,    1 },   // 0x20 ' '
+  {     0,   3,  15,  14,    5,  -14 },   // 0x21 '!'
+  {    23,   8,   7,  14,    3,  -14 },   // 0x22 '"'
+  {    51,  10,  17,  14,    2,  -15 },   // 0x23 '#'
+  {   136,  10,  17,  14,    2,  -15 },   // 0x24 '$'
+  {   221,  10,  15,  14,    2,  -14 },   // 0x25 '%'
+  {   296,  10,  13,  14,    2,  -12 },   // 0x26 '&'
+  {   361,   4,   7,  14,    5,  -14 },   // 0x27 '''
+  {   375,   4,  18,  14,    7,  -14 },   // 0x28 '('
+  {   411,   4,  18,  14,    4,  -14 },   // 0x29 ')'
+  {   447,  10,   9,  14,    2,  -14 },   // 0x2A '*'
+  {   492,  10,  12,  14,    2,  -12 },   // 0x2B '+'
+  {   552,   5,   7,  14,    3,   -3 },   // 0x2C ','
+  {   570,  12,   2,  14,    1,   -7 },   // 0x2D '-'
+  {   582,   4,   3,  14,    5,   -2 },   // 0x2E '.'
+  {   588,  10,  18,  14,    2,  -15 },   // 0x2F '/'
+  {   678,  10,  15,  14,    2,  -14 },   // 0x30 '0'
+  {   753,   8,  15,  14,    3,  -14 },   // 0x31 '1'
+  {   813,  10,  15,  14,    2,  -14 },   // 0x32 '2'
+  {   888,  10,  15,  14,    2,  -14 },   // 0x33 '3'
+  {   963,   8,  15,  14,    3,  -14 },   // 0x34 '4'
+  {  1023,  10,  15,  14,    2,  -14 },   // 0x35 '5'
+  {  1098,   9,  15,  14,    3,  -14 },   // 0x36 '6'
+  {  1166,  10,  15,  14,    2,  -14 },   // 0x37 '7'
+  {  1241,  10,  15,  14,    2,  -14 },   // 0x38 '8'
+  {  1316,   9,  15,  14,    3,  -14 },   // 0x39 '9'
+  {  1384,   4,  11,  14,    5,  -10 },   // 0x3A ':'
+  {  1406,   6,  14,  14,    3,  -10 },   // 0x3B ';'
+  {  1448,  12,  12,  14,    1,  -12 },   // 0x3C '<'
+  {  1520,  12,   5,  14,    1,   -9 },   // 0x3D '='
+  {  1550,  11,  12,  14,    2,  -12 },   // 0x3E '>'
+  {  1616,   9,  14,  14,    3,  -13 },   // 0x3F '?'
+  {  1679,  10,  16,  14,    2,  -14 },   // 0x40 '@'
+  {  1759,  14,  14,  14,    0,  -13 },   // 0x41 'A'
+  {  1857,  12,  14,  14,    1,  -13 },   // 0x42 'B'
+  {  1941,  12,  14,  14,    1,  -13 },   // 0x43 'C'
+  {  2025,  12,  14,  14,    1,  -13 },   // 0x44 'D'
+  {  2109,  12,  14,  14,    1,  -13 },   // 0x45 'E'
+  {  2193,  12,  14,  14,    1,  -13 },   // 0x46 'F'
+  {  2277,  12,  14,  14,    1,  -13 },   // 0x47 'G'
+  {  2361,  12,  14,  14,    1,  -13 },   // 0x48 'H'
+  {  2445,   8,  14,  14,    3,  -13 },   // 0x49 'I'
+  {  2501,  12,  14,  14,    2,  -13 },   // 0x4A 'J'
+  {  2585,  13,  14,  14,    1,  -13 },   // 0x4B 'K'
+  {  2676,  11,  14,  14,    2,  -13 },   // 0x4C 'L'
+  {  2753,  14,  14,  14,    0,  -13 },   // 0x4D 'M'
+  {  2851,  12,  14,  14,    1,  -13 },   // 0x4E 'N'
+  {  2935,  12,  14,  14,    1,  -13 },   // 0x4F 'O'
+  {  3019,  11,  14,  14,    1,  -13 },   // 0x50 'P'
+  {  3096,  12,  16,  14,    1,  -13 },   // 0x51 'Q'
+  {  3192,  13,  14,  14,    1,  -13 },   // 0x52 'R'
+  {  3283,  10,  14,  14,    2,  -13 },   // 0x53 'S'
+  {  3353,  12,  14,  14,    1,  -13 },   // 0x54 'T'
+  {  3437,  12,  14,  14,    1,  -13 },   // 0x55 'U'
+  {  3521,  14,  14,  14,    0,  -13 },   // 0x56 'V'
+  {  3619,  14,  14,  14,    0,  -13 },   // 0x57 'W'
+  {  3717,  12,  14,  14,    1,  -13 },   // 0x58 'X'
+  {  3801,  12,  14,  14,    1,  -13 },   // 0x59 'Y'
+  {  3885,  10,  14,  14,    2,  -13 },   // 0x5A 'Z'
+  {  3955,   4,  18,  14,    6,  -14 },   // 0x5B '['
+  {  3991,  10,  18,  14,    2,  -15 },   // 0x5C '\'
+  {  4081,   4,  18,  14,    4,  -14 },   // 0x5D ']'
+  {  4117,  10,   6,  14,    2,  -14 },   // 0x5E '^'
+  {  4147,  14,   2,  14,    0,    2 },   // 0x5F '_'
+  {  4161,   5,   4,  14,    3,  -15 },   // 0x60 '`'
+  {  4171,  12,  11,  14,    1,  -10 },   // 0x61 'a'
+  {  4237,  12,  15,  14,    1,  -14 },   // 0x62 'b'
+  {  4327,  11,  11,  14,    2,  -10 },   // 0x63 'c'
+  {  4388,  13,  15,  14,    1,  -14 },   // 0x64 'd'
+  {  4486,  11,  11,  14,    1,  -10 },   // 0x65 'e'
+  {  4547,  10,  15,  14,    3,  -14 },   // 0x66 'f'
+  {  4622,  12,  15,  14,    1,  -10 },   // 0x67 'g'
+  {  4712,  12,  15,  14,    1,  -14 },   // 0x68 'h'
+  {  4802,  10,  15,  14,    2,  -14 },   // 0x69 'i'
+  {  4877,   7,  19,  14,    3,  -14 },   // 0x6A 'j'
+  {  4944,  11,  15,  14,    2,  -14 },   // 0x6B 'k'
+  {  5027,  10,  15,  14,    2,  -14 },   // 0x6C 'l'
+  {  5102,  14,  11,  14,    0,  -10 },   // 0x6D 'm'
+  {  5179,  12,  11,  14,    1,  -10 },   // 0x6E 'n'
+  {  5245,  12,  11,  14,    1,  -10 },   // 0x6F 'o'
+  {  5311,  12,  15,  14,    1,  -10 },   // 0x70 'p'
+  {  5401,  13,  15,  14,    1,  -10 },   // 0x71 'q'
+  {  5499,  11,  11,  14,    2,  -10 },   // 0x72 'r'
+  {  5560,  10,  11,  14,    2,  -10 },   // 0x73 's'
+  {  5615,  11,  14,  14,    1,  -13 },   // 0x74 't'
+  {  5692,  12,  11,  14,    1,  -10 },   // 0x75 'u'
+  {  5758,  14,  11,  14,    0,  -10 },   // 0x76 'v'
+  {  5835,  14,  11,  14,    0,  -10 },   // 0x77 'w'
+  {  5912,  12,  11,  14,    1,  -10 },   // 0x78 'x'
+  {  5978,  12,  15,  14,    1,  -10 },   // 0x79 'y'
+  {  6068,   9,  11,  14,    3,  -10 },   // 0x7A 'z'
+  {  6118,   6,  18,  14,    4,  -14 },   // 0x7B '{'
+  {  6172,   2,  18,  14,    6,  -14 },   // 0x7C '|'
+  {  6190,   6,  18,  14,    4,  -14 },   // 0x7D '}'
+  {  6244,  10,   4,  14,    2,   -8 } }; // 0x7E '~'
+
+const GFXalphaFont FreeMono12pt4a PROGMEM = {
+  (const uint8_t  *)FreeMono12pt4aBitmaps,
+  (const GFXglyph *)FreeMono12pt4aGlyphs,
+  0x20, 0x7E, 24 };
+
+// Approx. 6936 bytes
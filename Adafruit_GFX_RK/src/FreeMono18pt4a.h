@@ -0,0 +1,1270 @@
+const uint8_t FreeMono18pt4aBitmaps[] PROGMEM = {
+  0x0F, 0xF4, 0x0F, 0xF4, 0x0F, 0xF4, 0x0F, 0xF4, 0x0F, 0xF4, 0x0F, 0xF4,
+  0x0F, 0xF4, 0x0F, 0xF4, 0x0F, 0xF4, 0x0C, 0xD3, 0x04, 0x80, 0x04, 0x80,
+  0x04, 0x80, 0x04, 0x80, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x41, 0x6F, 0xF9, 0xBF, 0xFF, 0x8F, 0xFC, 0x08, 0x82, 0x6E, 0xFF,
+  0xF8, 0x08, 0xFF, 0xFE, 0x60, 0xBF, 0xFF, 0x00, 0x0F, 0xFF, 0xB0, 0x0B,
+  0xFF, 0xF0, 0x00, 0xFF, 0xFB, 0x00, 0xBF, 0xFF, 0x00, 0x0F, 0xFF, 0xB0,
+  0x0B, 0xFF, 0xF0, 0x00, 0xFF, 0xFB, 0x00, 0xBF, 0xFF, 0x00, 0x0F, 0xFF,
+  0xB0, 0x00, 0xFF, 0xC0, 0x00, 0xCF, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x04,
+  0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x4F, 0xF0, 0x00, 0x0F, 0xF4, 0x00,
+  0x04, 0xFF, 0x00, 0x00, 0x88, 0x20, 0x00, 0x28, 0x80, 0x00, 0x00, 0x00,
+  0x08, 0x80, 0x03, 0xB3, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x4F, 0x40,
+  0x00, 0x00, 0x00, 0x0B, 0xB0, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBB,
+  0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x04, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0xBB, 0x00, 0x9F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x0F,
+  0x91, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x28, 0x88,
+  0xBF, 0x88, 0x8F, 0xB8, 0x88, 0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF4, 0x00, 0x00, 0x8F, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x08, 0xF0,
+  0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x0F, 0x80, 0x00, 0x00,
+  0x00, 0x08, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x88, 0x88, 0xBF, 0x88, 0x8F,
+  0xB8, 0x84, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x8F, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2B, 0xF0, 0x0B, 0xD4, 0x00,
+  0x00, 0x00, 0x04, 0xF7, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40,
+  0x0B, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0xBB, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x40, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0xBB,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x01,
+  0x41, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0x9F, 0x96, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xEF, 0xFF, 0xEB, 0x3B, 0x60,
+  0x00, 0x3F, 0xD3, 0x00, 0x03, 0xBE, 0xF8, 0x00, 0x4D, 0xD4, 0x00, 0x00,
+  0x00, 0x6F, 0x80, 0x08, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x8F,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2C, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xDF,
+  0xC4, 0x44, 0x20, 0x00, 0x00, 0x00, 0x04, 0x89, 0xFF, 0xFB, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x47, 0xFF, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x43, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0x44, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xB2, 0x4F, 0xFB, 0xB3,
+  0x00, 0x03, 0xBE, 0xC2, 0x03, 0xB3, 0xBD, 0xFF, 0xFF, 0xFD, 0xB0, 0x00,
+  0x00, 0x00, 0x48, 0x9F, 0x98, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x44, 0x30, 0x00, 0x00, 0x00, 0x00, 0x06, 0x9F,
+  0xFD, 0x82, 0x00, 0x00, 0x00, 0x06, 0xEC, 0x44, 0x7F, 0xC0, 0x00, 0x00,
+  0x01, 0x9C, 0x00, 0x00, 0x6E, 0x30, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00,
+  0xBB, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x3D,
+  0x70, 0x00, 0x02, 0xC8, 0x00, 0x00, 0x00, 0x8F, 0x60, 0x02, 0xBF, 0x00,
+  0x00, 0x00, 0x02, 0xCE, 0xBB, 0xCF, 0x70, 0x00, 0x06, 0xB0, 0x00, 0x3B,
+  0xB8, 0x03, 0x44, 0xCE, 0xBB, 0x00, 0x00, 0x00, 0x88, 0xDF, 0xB8, 0x60,
+  0x00, 0x00, 0x3B, 0xBF, 0xF7, 0x42, 0x00, 0x00, 0x49, 0xFE, 0xBB, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xB8, 0x60, 0x00, 0x06, 0x88, 0x20, 0x00, 0x42,
+  0x00, 0x00, 0x3B, 0xEF, 0xFC, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0x00,
+  0x8F, 0x80, 0x00, 0x00, 0x06, 0xD4, 0x00, 0x00, 0x9B, 0x20, 0x00, 0x00,
+  0xBB, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x4F,
+  0x40, 0x00, 0x00, 0x6D, 0x40, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x00, 0xFD,
+  0x30, 0x08, 0xF9, 0x10, 0x00, 0x00, 0x03, 0xBE, 0xFF, 0xC8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x68, 0x82, 0x00, 0x00, 0x00, 0x00, 0x03, 0x44, 0x41,
+  0x41, 0x00, 0x00, 0x00, 0x04, 0xDF, 0xFF, 0x9F, 0x40, 0x00, 0x00, 0x03,
+  0xDF, 0x44, 0x4C, 0x41, 0x00, 0x00, 0x00, 0xFD, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFD, 0xEC, 0x20, 0x00, 0x34, 0x41, 0x04, 0xD8,
+  0x46, 0xF8, 0x00, 0x0B, 0xFF, 0x43, 0xDF, 0x00, 0x07, 0xD3, 0x00, 0xBC,
+  0x41, 0x4F, 0x40, 0x00, 0x3D, 0xF0, 0x8F, 0x00, 0x04, 0xF4, 0x00, 0x00,
+  0x4D, 0x68, 0xF0, 0x00, 0x4F, 0x40, 0x00, 0x00, 0xBE, 0xD7, 0x00, 0x03,
+  0xD7, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x6F,
+  0xF4, 0x00, 0x00, 0x2C, 0xE6, 0x00, 0x6E, 0xC9, 0xCB, 0xB3, 0x00, 0x0B,
+  0xDF, 0xFD, 0xB0, 0x6B, 0xBB, 0x30, 0x00, 0x04, 0x88, 0x40, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0xE6, 0x0F, 0xFF, 0xB0, 0x0F, 0xFF, 0xB0, 0x0F, 0xFF,
+  0xB0, 0x0F, 0xFF, 0xB0, 0x0F, 0xFF, 0xB0, 0x04, 0xFF, 0x80, 0x04, 0xFF,
+  0x00, 0x04, 0xFF, 0x00, 0x04, 0xFF, 0x00, 0x02, 0x88, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x04, 0xDB, 0x00, 0x08, 0xF3, 0x00, 0x4F, 0xC0, 0x00, 0x9F,
+  0x40, 0x00, 0xFF, 0x40, 0x03, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xF8,
+  0x00, 0x2C, 0xB0, 0x00, 0x8F, 0xB0, 0x00, 0x8F, 0xB0, 0x00, 0x8F, 0xB0,
+  0x00, 0x8F, 0xB0, 0x00, 0x8F, 0xB0, 0x00, 0x8F, 0xB0, 0x00, 0x4D, 0xB0,
+  0x00, 0x0B, 0xE6, 0x00, 0x0B, 0xF8, 0x00, 0x06, 0xF8, 0x00, 0x00, 0xFD,
+  0x30, 0x00, 0xCF, 0x40, 0x00, 0x4F, 0x90, 0x00, 0x19, 0xF0, 0x00, 0x06,
+  0xE3, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x03, 0x42, 0x00, 0x00, 0xFB, 0x20,
+  0x00, 0x7F, 0x40, 0x00, 0x3D, 0xF0, 0x00, 0x08, 0xF6, 0x00, 0x08, 0xFB,
+  0x00, 0x00, 0xBC, 0x20, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0x8F,
+  0x91, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0F,
+  0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xB2, 0x00, 0x8F,
+  0x80, 0x00, 0xBF, 0x80, 0x00, 0xBD, 0x40, 0x00, 0xBB, 0x00, 0x08, 0xF8,
+  0x00, 0x2B, 0xF0, 0x00, 0x4F, 0x70, 0x00, 0xFD, 0x30, 0x00, 0xD4, 0x00,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x20,
+  0x00, 0x4F, 0x40, 0x00, 0x28, 0x23, 0xDC, 0xB6, 0x04, 0xF4, 0x06, 0xBC,
+  0xF4, 0x00, 0x8B, 0xDF, 0xFF, 0xFF, 0xDB, 0x80, 0x00, 0x00, 0x04, 0x8F,
+  0xFF, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0xC8, 0x08, 0xC2, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x00, 0x0F,
+  0xB2, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B,
+  0x60, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0xCF, 0xCB, 0xBB,
+  0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xFC, 0xBB, 0xBB, 0xBB, 0x00, 0x00, 0x00,
+  0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x41, 0x00, 0x00, 0x00, 0x00, 0x28, 0x88,
+  0x82, 0x00, 0x4F, 0xFF, 0x91, 0x00, 0x7F, 0xFE, 0x60, 0x00, 0xFF, 0xFB,
+  0x00, 0x00, 0xFF, 0xF3, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x40,
+  0x00, 0x0B, 0xF9, 0x10, 0x00, 0x8F, 0xE6, 0x00, 0x00, 0x8F, 0xB0, 0x00,
+  0x00, 0x8F, 0x30, 0x00, 0x00, 0x0B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+  0xBB, 0x80, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x3F, 0xFF,
+  0xC2, 0xBF, 0xFF, 0xF8, 0xBF, 0xFF, 0xF8, 0x8F, 0xFF, 0xE6, 0x08, 0x88,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0C, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD7, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3B, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x4C, 0xFF, 0xFC, 0x41, 0x00, 0x00, 0x00, 0x9F, 0xF8, 0x88,
+  0xFF, 0x90, 0x00, 0x00, 0x8F, 0x94, 0x00, 0x04, 0x9F, 0x00, 0x00, 0x2C,
+  0xB0, 0x00, 0x00, 0x00, 0xBC, 0x20, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x06,
+  0xF8, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x4F, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0xCF, 0x44, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x44, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x44, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0x44, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x4F, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0x44, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4,
+  0x2B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x20, 0x8F, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0x80, 0x06, 0xEB, 0x00, 0x00, 0x00, 0x0B, 0xE6, 0x00, 0x0B,
+  0xD4, 0x00, 0x00, 0x04, 0xD6, 0x00, 0x00, 0x3F, 0xDB, 0x00, 0x0B, 0xDF,
+  0x00, 0x00, 0x00, 0x3B, 0xEF, 0xFF, 0xEB, 0x30, 0x00, 0x00, 0x00, 0x06,
+  0x88, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x4D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3D, 0xF7, 0xF4, 0x00, 0x00,
+  0x00, 0x3F, 0xD3, 0x4F, 0x40, 0x00, 0x00, 0x4D, 0xD4, 0x04, 0xF4, 0x00,
+  0x00, 0x08, 0xF3, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0x40, 0x00, 0x00, 0x6B, 0xBB, 0xBC, 0xFC, 0xBB, 0xBB, 0x66, 0xBB, 0xBB,
+  0xBB, 0xBB, 0xBB, 0xB6, 0x00, 0x01, 0x4C, 0xFF, 0xFC, 0x41, 0x00, 0x00,
+  0x00, 0x9F, 0x98, 0x88, 0x9F, 0x90, 0x00, 0x00, 0x8C, 0x41, 0x00, 0x01,
+  0x9F, 0x80, 0x01, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x4F, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x9B, 0x24, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xB9, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xC9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xC9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x98, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x42, 0x82, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x4D, 0xBB,
+  0xBB, 0xBB, 0xBB, 0xBB, 0xCF, 0x43, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+  0xB3, 0x00, 0x01, 0x4C, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x9F, 0x98,
+  0x88, 0x9F, 0xF6, 0x00, 0x00, 0x8C, 0x41, 0x00, 0x01, 0x4C, 0xE6, 0x00,
+  0x6B, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x01,
+  0x44, 0x49, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF9, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x44, 0x7F, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0x14, 0x10, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x44,
+  0xF9, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xB2, 0x19, 0xFB, 0xB3, 0x00, 0x03,
+  0xBE, 0xC2, 0x00, 0x00, 0xBB, 0xEF, 0xFF, 0xEB, 0xB0, 0x00, 0x00, 0x00,
+  0x06, 0x88, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC9,
+  0xF0, 0x00, 0x00, 0x00, 0x08, 0xC0, 0x8F, 0x00, 0x00, 0x00, 0x02, 0xB4,
+  0x08, 0xF0, 0x00, 0x00, 0x00, 0xC9, 0x10, 0x8F, 0x00, 0x00, 0x00, 0x3E,
+  0x60, 0x08, 0xF0, 0x00, 0x00, 0x0B, 0x60, 0x00, 0x8F, 0x00, 0x00, 0x06,
+  0xE0, 0x00, 0x08, 0xF0, 0x00, 0x01, 0x83, 0x00, 0x00, 0x8F, 0x00, 0x00,
+  0x98, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x0C, 0x20, 0x00, 0x00, 0x8F, 0x00,
+  0x0B, 0x80, 0x00, 0x00, 0x08, 0xF0, 0x04, 0x80, 0x00, 0x00, 0x00, 0x8F,
+  0x00, 0x8C, 0xBB, 0xBB, 0xBB, 0xBD, 0xFB, 0x66, 0xBB, 0xBB, 0xBB, 0xBB,
+  0xDF, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xBD, 0xFB, 0x60, 0x00,
+  0x00, 0x06, 0xBB, 0xBB, 0xB6, 0x00, 0x34, 0x44, 0x44, 0x44, 0x44, 0x30,
+  0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0xBC, 0x44, 0x44,
+  0x44, 0x44, 0x30, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0xBB, 0xBB, 0x60, 0x00,
+  0x00, 0x0B, 0xFD, 0xBB, 0xBB, 0xBD, 0xF3, 0x00, 0x00, 0x68, 0x40, 0x00,
+  0x00, 0x48, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD3, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD7, 0x14, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0x44, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xB2, 0x19,
+  0xFB, 0xB3, 0x00, 0x03, 0xBE, 0xC2, 0x00, 0x00, 0xBB, 0xEF, 0xFF, 0xEB,
+  0xB0, 0x00, 0x00, 0x00, 0x06, 0x88, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x24, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x08, 0xBF, 0xD8, 0x88, 0x88,
+  0x00, 0x00, 0x8F, 0xF7, 0x30, 0x00, 0x00, 0x00, 0x19, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xB0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0x00, 0x37, 0xFF, 0xFF, 0x70, 0x00, 0x8F, 0x04, 0xDF, 0xB8,
+  0x8B, 0xF8, 0x40, 0x8F, 0x3D, 0xF4, 0x20, 0x02, 0x4F, 0x80, 0x8F, 0x7D,
+  0x30, 0x00, 0x00, 0x04, 0xF4, 0x8F, 0xD4, 0x00, 0x00, 0x00, 0x02, 0xB9,
+  0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x6E, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x0B, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0x00, 0xF9, 0x10, 0x00, 0x00, 0x04, 0xF4, 0x00,
+  0x9F, 0x90, 0x00, 0x00, 0x09, 0xB2, 0x00, 0x19, 0xF8, 0x00, 0x06, 0xBC,
+  0x20, 0x00, 0x00, 0x8C, 0xFF, 0xFD, 0xB0, 0x00, 0x00, 0x00, 0x02, 0x88,
+  0x84, 0x00, 0x00, 0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x14, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x4F, 0x74, 0x44, 0x44, 0x44, 0x44,
+  0x7F, 0x44, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x28, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0xFB, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3D, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xB3, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x4C, 0xFF, 0xFC, 0x41, 0x00, 0x00, 0x06, 0x9F, 0x98, 0x88,
+  0x9F, 0x96, 0x00, 0x06, 0xEC, 0x41, 0x00, 0x01, 0x4C, 0xE6, 0x01, 0x9F,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x91, 0x4F, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x9F, 0x44, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x4F, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0x42, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x09, 0xB2,
+  0x02, 0xC8, 0x00, 0x00, 0x00, 0x08, 0xC2, 0x00, 0x00, 0xCF, 0x74, 0x44,
+  0x7F, 0xC0, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+  0xCF, 0x74, 0x44, 0x7F, 0xC0, 0x00, 0x02, 0xC8, 0x00, 0x00, 0x00, 0x08,
+  0xC2, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x3D, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x7D, 0x34, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x44, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x4D,
+  0x60, 0x00, 0x00, 0x04, 0xDD, 0x40, 0x00, 0x3E, 0xB3, 0x00, 0x03, 0xDF,
+  0x30, 0x00, 0x00, 0x3B, 0xEF, 0xFF, 0xEB, 0x30, 0x00, 0x00, 0x00, 0x06,
+  0x88, 0x86, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xFF, 0xC4, 0x10, 0x00,
+  0x00, 0x2B, 0xF8, 0x88, 0x9F, 0x90, 0x00, 0x00, 0xC9, 0x40, 0x00, 0x19,
+  0xF8, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x4D, 0x60, 0x00,
+  0x00, 0x00, 0x09, 0xB2, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x8F,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xD7, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xBF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x0B, 0xB0, 0x00, 0x00,
+  0x00, 0x3E, 0xDF, 0x06, 0xD4, 0x00, 0x00, 0x04, 0xD6, 0x8F, 0x00, 0xFD,
+  0xB0, 0x00, 0xBD, 0xF0, 0x8F, 0x00, 0x06, 0xEF, 0xFF, 0xEB, 0x30, 0x8F,
+  0x00, 0x00, 0x68, 0x88, 0x60, 0x02, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x19, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0x9F, 0x90,
+  0x00, 0x00, 0x00, 0x03, 0xBE, 0xF9, 0x10, 0x00, 0x6E, 0xFF, 0xFF, 0xDB,
+  0x00, 0x00, 0x00, 0x06, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x04, 0x44,
+  0x30, 0x6F, 0xFF, 0xD4, 0xBF, 0xFF, 0xF8, 0xBF, 0xFF, 0xF8, 0x6F, 0xFF,
+  0xD4, 0x04, 0x44, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+  0xC2, 0xBF, 0xFF, 0xF8, 0xBF, 0xFF, 0xF8, 0x8F, 0xFF, 0xE6, 0x08, 0x88,
+  0x60, 0x00, 0x03, 0x44, 0x40, 0x00, 0x4D, 0xFF, 0xF6, 0x00, 0x8F, 0xFF,
+  0xFB, 0x00, 0x8F, 0xFF, 0xFB, 0x00, 0x4D, 0xFF, 0xF6, 0x00, 0x03, 0x44,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x86, 0x00, 0x8F, 0xFF,
+  0xF3, 0x01, 0x9F, 0xFF, 0x40, 0x04, 0xFF, 0xFB, 0x20, 0x04, 0xFF, 0xF8,
+  0x00, 0x07, 0xFF, 0xB0, 0x00, 0x0F, 0xFF, 0x60, 0x00, 0x0F, 0xFF, 0x00,
+  0x00, 0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xB2, 0x00, 0x00, 0x3C, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0xBF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xFC, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x8D, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08, 0xCF,
+  0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x8F, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xDF, 0x42,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFC, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x48, 0xFB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x9F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xDF,
+  0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xDF, 0xB2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x7F, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xCF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x8D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x08, 0xBB,
+  0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x60, 0x8B, 0xBB, 0xBB, 0xBB,
+  0xBB, 0xBB, 0xBB, 0xBB, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFB, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xDF, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4D, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x7F, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xF7, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8D, 0xD4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xFD, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFD,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xBF, 0x84, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xBF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x8D, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xF7,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFB, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x88, 0x84, 0x00, 0x00,
+  0x00, 0xBB, 0xEF, 0xFF, 0xFD, 0xB0, 0x00, 0x8F, 0xBB, 0x30, 0x00, 0x3B,
+  0xEC, 0x20, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x8F, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xD3, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4E, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x8B, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0x70, 0x00, 0x00, 0x00,
+  0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x6F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x4C, 0xFF, 0xFC, 0x41, 0x00, 0x00, 0x00,
+  0x9F, 0xF8, 0x88, 0x9F, 0x90, 0x00, 0x00, 0x8F, 0x94, 0x00, 0x01, 0x9F,
+  0x80, 0x00, 0x2C, 0xB0, 0x00, 0x00, 0x00, 0x8C, 0x20, 0x08, 0xF6, 0x00,
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
+  0x4F, 0x40, 0x00, 0x00, 0x04, 0x44, 0xF8, 0x04, 0xF4, 0x00, 0x00, 0x48,
+  0xFF, 0xFF, 0x80, 0x4F, 0x40, 0x00, 0x3D, 0xFC, 0x44, 0xF8, 0x04, 0xF4,
+  0x00, 0x3F, 0xD3, 0x00, 0x0F, 0x80, 0x4F, 0x40, 0x0B, 0xD4, 0x00, 0x00,
+  0xF8, 0x04, 0xF4, 0x00, 0xBB, 0x00, 0x00, 0x0F, 0x80, 0x4F, 0x40, 0x0B,
+  0xB0, 0x00, 0x00, 0xF8, 0x04, 0xF4, 0x00, 0x6D, 0x40, 0x00, 0x0F, 0x80,
+  0x4F, 0x40, 0x00, 0xFD, 0xB0, 0x00, 0xF8, 0x04, 0xF4, 0x00, 0x03, 0xBE,
+  0xFF, 0xFF, 0xF4, 0x4F, 0x40, 0x00, 0x00, 0x68, 0x88, 0x88, 0x24, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCB, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF9, 0x40, 0x00, 0x00, 0x33, 0x00,
+  0x00, 0x09, 0xFF, 0x88, 0x88, 0x8D, 0xB0, 0x00, 0x00, 0x14, 0xCF, 0xFF,
+  0xF9, 0x43, 0x00, 0x00, 0x03, 0xBB, 0xBB, 0xBB, 0xBB, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3B, 0xBB, 0xBE, 0xED, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xBB, 0x4D, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0x30, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xB9,
+  0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00,
+  0x7D, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD3, 0x00, 0x03, 0xD7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x08, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x20, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xDD, 0x88, 0x88, 0x88, 0x8D, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x60, 0x00, 0x00, 0x00, 0x19, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0xC9, 0x10, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0xC9, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0x40, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0x00, 0x00, 0x06, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xD6, 0x00,
+  0x3B, 0xEE, 0xBB, 0xB6, 0x00, 0x00, 0x06, 0xBB, 0xBE, 0xEB, 0xB3, 0xBB,
+  0xBB, 0xBB, 0x60, 0x00, 0x00, 0x6B, 0xBB, 0xBB, 0xBB, 0x8B, 0xBB, 0xBB,
+  0xBB, 0xBB, 0xBB, 0x30, 0x00, 0x08, 0xBD, 0xFB, 0xBB, 0xBB, 0xBB, 0xBE,
+  0xC2, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xB2, 0x00, 0x08,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x8F, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0,
+  0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x08, 0xF0, 0x00,
+  0x00, 0x00, 0x24, 0xFD, 0x30, 0x00, 0x8F, 0x88, 0x88, 0x88, 0x8B, 0xF8,
+  0x40, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F,
+  0x00, 0x00, 0x00, 0x00, 0x8C, 0xF7, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x2B, 0xF0, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80,
+  0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x8F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xB0, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBB, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0x00, 0x08, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x8B, 0xDF, 0xBB, 0xBB, 0xBB, 0xBB,
+  0xBF, 0x91, 0x08, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x68, 0x88, 0x60, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBE, 0xFF,
+  0xFE, 0xBB, 0x06, 0xB0, 0x00, 0x2C, 0xEB, 0x30, 0x00, 0x3B, 0xEC, 0x9F,
+  0x00, 0x2B, 0xF6, 0x00, 0x00, 0x00, 0x06, 0x9F, 0xF0, 0x04, 0xF7, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x08, 0xC2,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3D, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC8, 0x00, 0x4D, 0xD4, 0x00,
+  0x00, 0x00, 0x08, 0xB9, 0x00, 0x00, 0x3F, 0xDB, 0x00, 0x00, 0x6B, 0xF9,
+  0x10, 0x00, 0x00, 0x3B, 0xBF, 0xFF, 0xFD, 0xB8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x88, 0x88, 0x40, 0x00, 0x00, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xB6,
+  0x00, 0x00, 0x08, 0xCF, 0xCB, 0xBB, 0xBB, 0xBC, 0xFF, 0x30, 0x00, 0x04,
+  0xF4, 0x00, 0x00, 0x00, 0x28, 0xDD, 0x40, 0x00, 0x4F, 0x40, 0x00, 0x00,
+  0x00, 0x03, 0xFD, 0x30, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF7,
+  0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF0, 0x04, 0xF4, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBB, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x4F,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x04, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xB0, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB,
+  0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x4F, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xC8, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x70, 0x04, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xD3, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x02,
+  0x8D, 0xD4, 0x00, 0x8C, 0xFC, 0xBB, 0xBB, 0xBB, 0xCF, 0xF3, 0x00, 0x08,
+  0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x60, 0x00, 0x00, 0x8B, 0xBB, 0xBB, 0xBB,
+  0xBB, 0xBB, 0xBB, 0xBB, 0x08, 0xBD, 0xFB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD,
+  0xF0, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x08, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00,
+  0x8F, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00,
+  0xBB, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x88, 0x88, 0x8D, 0xB0, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00,
+  0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0xBB, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x08,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x8F, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xB0, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB,
+  0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x08, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xBB, 0x8B, 0xDF, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+  0xBE, 0xB8, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x8B, 0xBB,
+  0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x88, 0xBD, 0xFB, 0xBB, 0xBB, 0xBB,
+  0xBB, 0xBB, 0xEB, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0,
+  0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x8F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xB0, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x66, 0x00, 0x8F, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x08, 0xF0,
+  0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x88, 0x88, 0x8D, 0xB0,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00,
+  0xBB, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00,
+  0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xDF, 0xBB, 0xBB, 0xB3,
+  0x00, 0x00, 0x00, 0x08, 0xBB, 0xBB, 0xBB, 0xBB, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x68, 0x88, 0x88, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3B,
+  0xEF, 0xFF, 0xFF, 0xC8, 0x08, 0x80, 0x00, 0x03, 0xFD, 0xB0, 0x00, 0x00,
+  0x8C, 0xFF, 0xB0, 0x00, 0x4D, 0x84, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xB0,
+  0x03, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xB0, 0x0F, 0xD3, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x42,
+  0xBB, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0xBB, 0x00, 0x00,
+  0x00, 0x00, 0x44, 0x44, 0x4C, 0xC2, 0xBC, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0B, 0xB0, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0,
+  0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x04, 0xF7, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x02, 0xBF, 0x84, 0x00, 0x00, 0x00,
+  0x00, 0x0B, 0xB0, 0x00, 0x24, 0xFD, 0xB0, 0x00, 0x00, 0x0B, 0xBE, 0xB0,
+  0x00, 0x00, 0x3B, 0xBF, 0xFF, 0xFF, 0xFB, 0xB3, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x88, 0x88, 0x80, 0x00, 0x00, 0x0B, 0xBB, 0xBB, 0x30, 0x00, 0x06,
+  0xBB, 0xBB, 0x80, 0x0B, 0xDF, 0xBB, 0x30, 0x00, 0x06, 0xBC, 0xFC, 0x80,
+  0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xF4, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00,
+  0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F, 0x88, 0x88, 0x88, 0x88,
+  0x89, 0xF4, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
+  0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xF4, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00,
+  0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xF4, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00,
+  0x8B, 0xDF, 0xBB, 0x30, 0x00, 0x06, 0xBC, 0xFC, 0xB6, 0x8B, 0xBB, 0xBB,
+  0x30, 0x00, 0x06, 0xBB, 0xBB, 0xB6, 0x6B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+  0x66, 0xBB, 0xBB, 0xCF, 0xCB, 0xBB, 0xB6, 0x00, 0x00, 0x04, 0xF4, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0x40, 0x00, 0x00, 0x6B, 0xBB, 0xBC, 0xFC, 0xBB, 0xBB, 0x66, 0xBB, 0xBB,
+  0xBB, 0xBB, 0xBB, 0xB6, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+  0xB3, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0xFD, 0xBB, 0xB3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00,
+  0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x4D, 0x60, 0x00, 0x00, 0x19, 0xFB,
+  0x60, 0x00, 0x0B, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xDF, 0xFF, 0xFB,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x8B, 0xBB, 0xBB, 0xB0, 0x00, 0x06, 0xBB, 0xBB, 0xB6, 0x08, 0xBD,
+  0xFB, 0xBB, 0x00, 0x00, 0x6B, 0xCF, 0xCB, 0x60, 0x00, 0x8F, 0x00, 0x00,
+  0x00, 0x00, 0x69, 0xB2, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x6E,
+  0xC2, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
+  0x00, 0x08, 0xF0, 0x00, 0x00, 0x6F, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0x00, 0x00, 0x6E, 0x42, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x03, 0xFD,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x04, 0xDF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xF3, 0xDF, 0xFD, 0xB0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xEB, 0x30, 0x6B, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF6,
+  0x00, 0x00, 0x09, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00,
+  0x4F, 0xC0, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x6E, 0x30,
+  0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+  0x08, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE6, 0x00, 0x00, 0x00, 0x8F, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0x91, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x9F, 0x40, 0x00, 0x8B, 0xDF, 0xBB, 0xB0, 0x00, 0x00, 0x04, 0xFC,
+  0xBB, 0x38, 0xBB, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x06, 0xBB, 0xB3, 0xBB,
+  0xBB, 0xBB, 0xBB, 0xB0, 0x00, 0x00, 0x00, 0xBB, 0xBC, 0xFC, 0xBB, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x04, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0xBB, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00,
+  0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x04, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0xBB, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB,
+  0xBC, 0xFC, 0xBB, 0xBB, 0xBB, 0xBB, 0xEB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+  0xBB, 0xBB, 0xB8, 0x3B, 0xBB, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBB,
+  0xBB, 0x33, 0xBE, 0xED, 0x70, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xEE, 0xB3,
+  0x00, 0xBB, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x8B, 0xB0, 0x00, 0x0B,
+  0xB2, 0xC8, 0x00, 0x00, 0x00, 0x08, 0xC2, 0xBB, 0x00, 0x00, 0xBB, 0x0B,
+  0xC2, 0x00, 0x00, 0x02, 0xCB, 0x0B, 0xB0, 0x00, 0x0B, 0xB0, 0x6F, 0x80,
+  0x00, 0x00, 0x8F, 0x60, 0xBB, 0x00, 0x00, 0xBB, 0x00, 0xFD, 0x30, 0x00,
+  0x3D, 0xF0, 0x0B, 0xB0, 0x00, 0x0B, 0xB0, 0x04, 0xF4, 0x00, 0x04, 0xF4,
+  0x00, 0xBB, 0x00, 0x00, 0xBB, 0x00, 0x2B, 0x90, 0x00, 0x9B, 0x20, 0x0B,
+  0xB0, 0x00, 0x0B, 0xB0, 0x00, 0x8F, 0x00, 0x0F, 0x80, 0x00, 0xBB, 0x00,
+  0x00, 0xBB, 0x00, 0x00, 0xBB, 0x0B, 0xB0, 0x00, 0x0B, 0xB0, 0x00, 0x0B,
+  0xB0, 0x00, 0x06, 0xD8, 0xD6, 0x00, 0x00, 0xBB, 0x00, 0x00, 0xBB, 0x00,
+  0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x0B, 0xB0, 0x00, 0x00,
+  0x3B, 0x30, 0x00, 0x00, 0xBB, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xB0, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBB, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+  0xB0, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00,
+  0x3B, 0xEE, 0xBB, 0x80, 0x00, 0x00, 0x00, 0x8B, 0xBE, 0xEB, 0x33, 0xBB,
+  0xBB, 0xB8, 0x00, 0x00, 0x00, 0x08, 0xBB, 0xBB, 0xB3, 0x6B, 0xBB, 0xB0,
+  0x00, 0x00, 0x00, 0x6B, 0xBB, 0xBB, 0x66, 0xBC, 0xFF, 0x30, 0x00, 0x00,
+  0x06, 0xBB, 0xDF, 0xB6, 0x00, 0x4F, 0xFD, 0x40, 0x00, 0x00, 0x00, 0x08,
+  0xF0, 0x00, 0x04, 0xF7, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00,
+  0x4F, 0x44, 0xF7, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x04, 0xF4, 0x2B,
+  0xF0, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x2C, 0x80, 0x00,
+  0x00, 0x08, 0xF0, 0x00, 0x04, 0xF4, 0x00, 0x8C, 0x20, 0x00, 0x00, 0x8F,
+  0x00, 0x00, 0x4F, 0x40, 0x00, 0xFB, 0x20, 0x00, 0x08, 0xF0, 0x00, 0x04,
+  0xF4, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x00,
+  0x08, 0xF3, 0x00, 0x08, 0xF0, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x4D, 0xB0,
+  0x00, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x3E, 0x60, 0x08, 0xF0,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0xC9, 0x10, 0x8F, 0x00, 0x00, 0x4F,
+  0x40, 0x00, 0x00, 0x04, 0xF9, 0x08, 0xF0, 0x00, 0x04, 0xF4, 0x00, 0x00,
+  0x00, 0x19, 0xF0, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x0B,
+  0xC9, 0xF0, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x00,
+  0x08, 0xCF, 0xCB, 0xB3, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x8B, 0xBB,
+  0xBB, 0x30, 0x00, 0x00, 0x03, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x06, 0x88,
+  0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xEF, 0xFF, 0xEB, 0xB0,
+  0x00, 0x00, 0x00, 0x02, 0xCE, 0xB3, 0x00, 0x03, 0xBE, 0xC2, 0x00, 0x00,
+  0x02, 0xBF, 0x60, 0x00, 0x00, 0x00, 0x6F, 0xB2, 0x00, 0x00, 0xCF, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0x30, 0x0B, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0xDB, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x8F,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x88, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0x88, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF8, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x88, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xB0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0xBD, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4D, 0xB0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF3,
+  0x00, 0x0C, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2B,
+  0xF6, 0x00, 0x00, 0x00, 0x06, 0xFB, 0x20, 0x00, 0x00, 0x2C, 0xEB, 0x30,
+  0x00, 0x3B, 0xEC, 0x20, 0x00, 0x00, 0x00, 0x0B, 0xBE, 0xFF, 0xFE, 0xBB,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x88, 0x60, 0x00, 0x00, 0x00,
+  0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x30, 0x00, 0x8B, 0xDF, 0xBB, 0xBB,
+  0xBB, 0xBD, 0xFC, 0x20, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x04, 0x8F, 0xB2,
+  0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x8F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x8F, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFC, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x09, 0xB2,
+  0x00, 0x8F, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x80, 0x00, 0x8F, 0xFF, 0xFF,
+  0xFF, 0xFD, 0xB0, 0x00, 0x00, 0x8F, 0x88, 0x88, 0x88, 0x84, 0x00, 0x00,
+  0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8B, 0xDF, 0xBB, 0xBB, 0xB3, 0x00, 0x00, 0x00, 0x8B, 0xBB, 0xBB, 0xBB,
+  0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x88, 0x86, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3B, 0xEF, 0xFF, 0xEB, 0x30, 0x00, 0x00, 0x00,
+  0x02, 0xCE, 0xB3, 0x00, 0x03, 0xBE, 0xC2, 0x00, 0x00, 0x02, 0xBF, 0x60,
+  0x00, 0x00, 0x00, 0x6F, 0xB2, 0x00, 0x00, 0xCF, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0x30, 0x0B, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xDB, 0x00, 0xBB,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x8F, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0x88, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xF8, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0x88, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x8F, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x88, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBB, 0x00, 0xBD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xB0,
+  0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF3, 0x00, 0x03, 0xD7,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x04, 0xD6, 0x00, 0x00,
+  0x00, 0x06, 0xFB, 0x20, 0x00, 0x00, 0x03, 0xEB, 0x30, 0x00, 0x3B, 0xEC,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xFE, 0xBB, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xDD, 0x88, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+  0xDF, 0xEB, 0xBB, 0xB3, 0x00, 0x8B, 0x60, 0x00, 0x0B, 0xFD, 0xBB, 0xBB,
+  0xBD, 0xFF, 0xFC, 0x80, 0x00, 0x00, 0x68, 0x40, 0x00, 0x00, 0x48, 0x88,
+  0x20, 0x00, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xB6, 0x00, 0x00, 0x00, 0x08,
+  0xBD, 0xFB, 0xBB, 0xBB, 0xBC, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x8F, 0x00,
+  0x00, 0x00, 0x28, 0xDD, 0x40, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00,
+  0x03, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00,
+  0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x08, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0xFD, 0x30, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x04,
+  0x8D, 0x40, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0x30, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xEB, 0x30, 0x00, 0x00, 0x00, 0x08,
+  0xF8, 0x88, 0x88, 0xDD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00,
+  0x03, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x03, 0xDF,
+  0x30, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x04, 0xDD, 0x40, 0x00,
+  0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x8F,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x2B, 0x90, 0x00, 0x8B, 0xDF, 0xBB, 0xB0, 0x00, 0x00, 0x00,
+  0x8F, 0xBB, 0x38, 0xBB, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xB3,
+  0x00, 0x00, 0x48, 0x88, 0x86, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xFF, 0xFF,
+  0xEB, 0x33, 0xB3, 0x02, 0xCE, 0xB3, 0x00, 0x03, 0xBE, 0xFF, 0x40, 0x8F,
+  0x60, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x3D, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0x44, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x4F, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x28, 0x24, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xE4, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFB, 0x88, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x9F, 0xFD, 0xBB, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6B, 0xBB, 0xEC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0xFB, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xF8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xFC, 0xFF, 0x96, 0x00, 0x00, 0x00, 0x06, 0x9F, 0x4F, 0x9C,
+  0xEB, 0x30, 0x00, 0x3B, 0xEF, 0x91, 0xB6, 0x0B, 0xDF, 0xFF, 0xFF, 0xDB,
+  0x00, 0x00, 0x00, 0x04, 0x88, 0x88, 0x84, 0x00, 0x00, 0x8B, 0xBB, 0xBB,
+  0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x8B, 0xEB, 0xBB, 0xBB, 0xCF, 0xCB, 0xBB,
+  0xBB, 0xEB, 0xBB, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x0B, 0xBB, 0xB0,
+  0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0xBB, 0xBB, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0x00, 0x0B, 0xB6, 0x60, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x66,
+  0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0xBB, 0xBC, 0xFC, 0xBB,
+  0xB8, 0x00, 0x00, 0x00, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0x80, 0x00, 0x8B,
+  0xBB, 0xBB, 0x30, 0x00, 0x06, 0xBB, 0xBB, 0xB6, 0x8C, 0xFC, 0xBB, 0x30,
+  0x00, 0x06, 0xBB, 0xDF, 0xB6, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x04,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x04, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x04,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x04, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x04,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x04, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0x00, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00,
+  0x8F, 0x30, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x4D, 0xD4, 0x00,
+  0x00, 0x00, 0x6F, 0xB2, 0x00, 0x00, 0x03, 0xFD, 0xB0, 0x00, 0x3B, 0xEC,
+  0x20, 0x00, 0x00, 0x00, 0x3B, 0xEF, 0xFF, 0xFD, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x68, 0x88, 0x84, 0x00, 0x00, 0x00, 0x3B, 0xBB, 0xBB, 0xB6,
+  0x00, 0x00, 0x06, 0xBB, 0xBB, 0xBB, 0xB3, 0xBE, 0xEB, 0xBB, 0x60, 0x00,
+  0x00, 0x6B, 0xBB, 0xEE, 0xBB, 0x00, 0x6D, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4D, 0x60, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xF0, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9C, 0x00,
+  0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00,
+  0x01, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x91, 0x00, 0x00, 0x00, 0x08,
+  0xF3, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xB0,
+  0x00, 0x00, 0x00, 0x6D, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00,
+  0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x08,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB2, 0x00, 0x00, 0x8F, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3D, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xD7, 0x00, 0x07, 0xD3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0x00, 0x0C, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBB, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xD8,
+  0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x3B, 0xBB, 0xBB, 0xB6, 0x00, 0x00, 0x06, 0xBB, 0xBB, 0xBB,
+  0x33, 0xBE, 0xEB, 0xBB, 0x60, 0x00, 0x00, 0x6B, 0xBB, 0xEE, 0xB3, 0x00,
+  0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x0B, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0xBB, 0x00, 0x00,
+  0x07, 0xFF, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x06, 0xD4, 0x00, 0x00, 0xFF,
+  0xF0, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xFF, 0x80,
+  0x00, 0x0B, 0x30, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xB0, 0xBB, 0x00, 0x02,
+  0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBB, 0x0B, 0xB0, 0x00, 0x8F, 0x00,
+  0x00, 0x00, 0xF8, 0x00, 0x0B, 0xB0, 0x3E, 0x60, 0x08, 0xF0, 0x00, 0x00,
+  0x0F, 0x80, 0x08, 0xF0, 0x00, 0xF8, 0x00, 0x8F, 0x00, 0x00, 0x00, 0xFB,
+  0x20, 0x8F, 0x00, 0x0F, 0xB2, 0x08, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x08,
+  0x70, 0x00, 0x7F, 0x40, 0x8F, 0x00, 0x00, 0x00, 0x4F, 0x44, 0xF4, 0x00,
+  0x04, 0xF4, 0x19, 0x40, 0x00, 0x00, 0x04, 0xF4, 0x4F, 0x40, 0x00, 0x2B,
+  0x94, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0x4C, 0x91, 0x00, 0x00, 0x8F, 0x4F,
+  0x40, 0x00, 0x00, 0x04, 0xF4, 0xF8, 0x00, 0x00, 0x08, 0xF4, 0xF4, 0x00,
+  0x00, 0x00, 0x4F, 0x4D, 0x40, 0x00, 0x00, 0x4D, 0x9F, 0x40, 0x00, 0x00,
+  0x01, 0x9C, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x06,
+  0xB8, 0x00, 0x00, 0x00, 0x08, 0xB6, 0x00, 0x00, 0x08, 0xBB, 0xBB, 0x60,
+  0x00, 0x00, 0x6B, 0xBB, 0xBB, 0x60, 0x8C, 0xFC, 0xB6, 0x00, 0x00, 0x06,
+  0xBC, 0xFC, 0xB6, 0x00, 0x2B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x40,
+  0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x8F, 0x91, 0x00, 0x00, 0x00,
+  0x8F, 0x80, 0x00, 0x00, 0x2C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x20,
+  0x00, 0x2B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFC, 0x00, 0x0C, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xEC, 0x2B, 0xE6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0xFB, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+  0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x8D, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x30, 0x3E, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0x40, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x6F,
+  0xB2, 0x00, 0x02, 0xBF, 0x60, 0x00, 0x00, 0x00, 0x0B, 0xC2, 0x00, 0x00,
+  0x02, 0xCB, 0x00, 0x00, 0x00, 0x19, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xC9,
+  0x10, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF9, 0x00, 0x6B,
+  0xFF, 0xCB, 0x60, 0x00, 0x00, 0x6B, 0xCF, 0xFB, 0x66, 0xBB, 0xBB, 0xB6,
+  0x00, 0x00, 0x06, 0xBB, 0xBB, 0xB6, 0x6B, 0xBB, 0xBB, 0x60, 0x00, 0x00,
+  0x6B, 0xBB, 0xBB, 0x66, 0xBC, 0xFC, 0xB6, 0x00, 0x00, 0x06, 0xBC, 0xFC,
+  0xB6, 0x00, 0x2B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x20, 0x00, 0x00,
+  0x8F, 0x80, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x8C, 0x20,
+  0x00, 0x00, 0x2C, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x20, 0x00, 0x2B,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x04, 0xF7, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xF3, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4D, 0xB0, 0xBD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
+  0xBE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B,
+  0xBB, 0xCF, 0xCB, 0xBB, 0x80, 0x00, 0x00, 0x00, 0x08, 0xBB, 0xBB, 0xBB,
+  0xBB, 0xB8, 0x00, 0x00, 0x06, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB6, 0x00,
+  0x8F, 0xBB, 0xBB, 0xBB, 0xBB, 0xBF, 0x80, 0x08, 0xF0, 0x00, 0x00, 0x00,
+  0x06, 0xD4, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x06, 0xEB, 0x00, 0x08, 0xF0,
+  0x00, 0x00, 0x04, 0xFC, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x9F, 0x40,
+  0x00, 0x02, 0x40, 0x00, 0x00, 0x8F, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2C, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xDD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x04,
+  0xF4, 0x00, 0x0F, 0xB2, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x08, 0xC2, 0x00,
+  0x00, 0x00, 0x04, 0xF4, 0x19, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x44,
+  0xF9, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x4F, 0xCB, 0xBB, 0xBB, 0xBB,
+  0xBB, 0xCF, 0x43, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB3, 0x14, 0x44,
+  0x44, 0x4F, 0xFF, 0xFF, 0x4F, 0x74, 0x44, 0x4F, 0x40, 0x00, 0x4F, 0x40,
+  0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40,
+  0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40,
+  0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40,
+  0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40,
+  0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40, 0x00, 0x4F, 0x74,
+  0x44, 0x4F, 0xFF, 0xFF, 0x14, 0x44, 0x44, 0x28, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9B, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4D, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3B, 0x30, 0x44, 0x44, 0x41, 0xFF, 0xFF, 0xF4,
+  0x44, 0x47, 0xF4, 0x00, 0x04, 0xF4, 0x00, 0x04, 0xF4, 0x00, 0x04, 0xF4,
+  0x00, 0x04, 0xF4, 0x00, 0x04, 0xF4, 0x00, 0x04, 0xF4, 0x00, 0x04, 0xF4,
+  0x00, 0x04, 0xF4, 0x00, 0x04, 0xF4, 0x00, 0x04, 0xF4, 0x00, 0x04, 0xF4,
+  0x00, 0x04, 0xF4, 0x00, 0x04, 0xF4, 0x00, 0x04, 0xF4, 0x00, 0x04, 0xF4,
+  0x00, 0x04, 0xF4, 0x00, 0x04, 0xF4, 0x00, 0x04, 0xF4, 0x00, 0x04, 0xF4,
+  0x00, 0x04, 0xF4, 0x00, 0x04, 0xF4, 0x44, 0x47, 0xF4, 0xFF, 0xFF, 0xF4,
+  0x44, 0x44, 0x41, 0x00, 0x00, 0x00, 0x19, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF9, 0xC8, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xF8, 0x08, 0xF9, 0x10, 0x00, 0x00, 0x02, 0xB9,
+  0x00, 0x09, 0xF4, 0x00, 0x00, 0x00, 0xC9, 0x10, 0x00, 0x19, 0xC0, 0x00,
+  0x02, 0xCE, 0x60, 0x00, 0x00, 0x0B, 0xC2, 0x00, 0x8F, 0x60, 0x00, 0x00,
+  0x00, 0x6F, 0xB2, 0x3D, 0x70, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x88, 0x00, 0x00, 0x08, 0xF9,
+  0x10, 0x00, 0x09, 0xF9, 0x60, 0x00, 0x14, 0xCE, 0x60, 0x00, 0x00, 0xCF,
+  0x40, 0x00, 0x02, 0x82, 0x00, 0x24, 0x49, 0xFF, 0xFF, 0xC4, 0x10, 0x00,
+  0x00, 0x08, 0xFD, 0x88, 0x88, 0x89, 0xF9, 0x60, 0x00, 0x00, 0x24, 0x30,
+  0x00, 0x00, 0x14, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x44, 0x44,
+  0x42, 0x0F, 0x80, 0x00, 0x04, 0x89, 0xFF, 0xFF, 0xFF, 0xB8, 0xF8, 0x00,
+  0x03, 0xDF, 0xF9, 0x44, 0x44, 0x44, 0xCF, 0x80, 0x03, 0xFD, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0xBD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0x80, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xBB, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xCF, 0x80, 0x06, 0xD4, 0x00, 0x00, 0x00, 0x08,
+  0xB9, 0xF8, 0x00, 0x0F, 0xDB, 0x00, 0x00, 0x6B, 0xF9, 0x1F, 0xDB, 0x80,
+  0x3B, 0xEF, 0xFF, 0xFD, 0xB0, 0x00, 0xBB, 0xB8, 0x00, 0x06, 0x88, 0x88,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+  0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0x40, 0x24, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x4F, 0x42, 0xBF,
+  0x88, 0x88, 0xBF, 0x60, 0x00, 0x00, 0x4F, 0x4C, 0xF7, 0x00, 0x00, 0x2C,
+  0xE6, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00,
+  0x4F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF0, 0x00, 0x4F, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBB, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00,
+  0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x4F, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x4F, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xD6, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00,
+  0x4F, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x4F, 0x9F, 0xB2,
+  0x00, 0x00, 0x06, 0xFB, 0x20, 0x6B, 0xCF, 0x47, 0xFC, 0x00, 0x00, 0x6E,
+  0xC2, 0x00, 0x6B, 0xBB, 0x30, 0x6B, 0xFF, 0xFF, 0xDB, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x01, 0x4C, 0xFF,
+  0xFF, 0x94, 0x02, 0x40, 0x00, 0x09, 0xFF, 0x88, 0x88, 0xBF, 0x8B, 0xF0,
+  0x00, 0x8F, 0x94, 0x00, 0x00, 0x24, 0xFF, 0xF0, 0x19, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x3D, 0xF0, 0x4F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0,
+  0xCF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFB, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x33, 0x04, 0xD8, 0x40, 0x00, 0x00, 0x00, 0x28, 0xDB,
+  0x00, 0x3F, 0xDB, 0x00, 0x00, 0x08, 0xCF, 0x73, 0x00, 0x03, 0xBE, 0xFF,
+  0xFF, 0xFC, 0xB6, 0x00, 0x00, 0x00, 0x06, 0x88, 0x88, 0x82, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x44, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x34, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x49,
+  0xFF, 0xFF, 0x42, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x88, 0x8F,
+  0xB8, 0x08, 0xF0, 0x00, 0x00, 0x6E, 0xC4, 0x10, 0x00, 0x49, 0xF8, 0x8F,
+  0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x0F,
+  0xB2, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x08, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0,
+  0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x0B, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x6D, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xBF, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0xF0, 0x00, 0x0C, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xDF, 0x00,
+  0x00, 0x2B, 0xF6, 0x00, 0x00, 0x00, 0x4D, 0xB8, 0xF0, 0x00, 0x00, 0x2C,
+  0xEB, 0x30, 0x00, 0xBD, 0xF3, 0x8F, 0xBB, 0x30, 0x00, 0x0B, 0xDF, 0xFF,
+  0xFB, 0x60, 0x06, 0xBB, 0xB3, 0x00, 0x00, 0x04, 0x88, 0x88, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFF, 0xFF, 0xC4, 0x10, 0x00, 0x00,
+  0x48, 0xFB, 0x88, 0x88, 0x9F, 0x96, 0x00, 0x03, 0xDF, 0x42, 0x00, 0x00,
+  0x14, 0xCE, 0x60, 0x07, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF4, 0x0F,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xB9, 0x8C, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xBC, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x9F, 0xBF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x02,
+  0xBF, 0x60, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x00, 0x2C, 0xEB, 0x30, 0x00,
+  0x06, 0xBC, 0xF7, 0x00, 0x00, 0x3B, 0xEF, 0xFF, 0xFD, 0xB8, 0x00, 0x00,
+  0x00, 0x00, 0x68, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x44,
+  0x44, 0x44, 0x00, 0x00, 0x00, 0x28, 0xDF, 0xFF, 0xFF, 0xF6, 0x00, 0x00,
+  0x0C, 0xF7, 0x44, 0x44, 0x44, 0x30, 0x00, 0x0B, 0xE6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0xCC, 0x44, 0x44, 0x44, 0x41, 0x08,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x24, 0x44, 0xCC, 0x44, 0x44,
+  0x44, 0x41, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x6B, 0xBB, 0xEE, 0xBB, 0xBB, 0xBB, 0x60, 0x06, 0xBB, 0xBB, 0xBB,
+  0xBB, 0xBB, 0xB6, 0x00, 0x00, 0x00, 0x49, 0xFF, 0xFF, 0x42, 0x01, 0x44,
+  0x42, 0x00, 0x06, 0xFB, 0x88, 0x88, 0xFB, 0x24, 0xFF, 0xF8, 0x00, 0x6E,
+  0xC2, 0x00, 0x00, 0x49, 0xC4, 0xF7, 0x42, 0x07, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0xF4, 0x00, 0x0F, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4,
+  0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0xBB, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x6D, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xF4, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x02, 0xCC, 0xF4,
+  0x00, 0x02, 0xBF, 0x84, 0x00, 0x00, 0x8B, 0x94, 0xF4, 0x00, 0x00, 0x24,
+  0xFD, 0xBB, 0xBB, 0xF9, 0x14, 0xF4, 0x00, 0x00, 0x00, 0x06, 0xBB, 0xBB,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xEC, 0x20,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFD, 0xB0, 0x00, 0x00, 0x00, 0x00,
+  0x28, 0x88, 0x88, 0x84, 0x00, 0x00, 0x00, 0x34, 0x44, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x34, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0x00, 0x3F, 0xFF, 0xF9, 0x40, 0x00, 0x00, 0x00, 0x8F,
+  0x28, 0xD8, 0x88, 0x8B, 0xF6, 0x00, 0x00, 0x00, 0x8F, 0xCF, 0x70, 0x00,
+  0x02, 0xCE, 0x60, 0x00, 0x00, 0x8F, 0xE6, 0x00, 0x00, 0x00, 0x0C, 0xF4,
+  0x00, 0x00, 0x8F, 0x60, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x8B, 0xDF, 0xBB, 0x30, 0x00,
+  0x06, 0xBC, 0xFC, 0xB6, 0x8B, 0xBB, 0xBB, 0x30, 0x00, 0x06, 0xBB, 0xBB,
+  0xB6, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34,
+  0x44, 0x44, 0x10, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x34, 0x44, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x3B, 0xBB, 0xBB, 0xCF, 0xCB,
+  0xBB, 0xBB, 0x33, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB3, 0x00, 0x00,
+  0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
+  0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x44, 0x44, 0x44,
+  0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x24, 0x44, 0x44, 0x44, 0x49, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0xF0, 0x00, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00,
+  0x08, 0xF9, 0x18, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x48, 0x88, 0x88, 0x88,
+  0x00, 0x00, 0x44, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xCB, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x34, 0x44, 0x44,
+  0x10, 0x00, 0x0B, 0xB0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBB,
+  0x00, 0x00, 0x37, 0xF7, 0x44, 0x10, 0x00, 0x0B, 0xB0, 0x00, 0x2C, 0xE6,
+  0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x2B, 0xF6, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0xB0, 0x0C, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x2C, 0xE6,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xDB, 0xFD, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0x94, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0,
+  0x03, 0xDF, 0x30, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x04, 0xDD, 0x40,
+  0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x03, 0xFD, 0x30, 0x00, 0x00, 0x00,
+  0xBB, 0x00, 0x00, 0x03, 0xDF, 0x30, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00,
+  0x04, 0xDD, 0x40, 0x00, 0xBB, 0xEB, 0x00, 0x00, 0x03, 0xBE, 0xFD, 0xBB,
+  0x6B, 0xBB, 0x80, 0x00, 0x00, 0x3B, 0xBB, 0xBB, 0xB6, 0x00, 0x34, 0x44,
+  0x44, 0x10, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x34, 0x44, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0x00, 0x00, 0x3B, 0xBB, 0xBB, 0xCF, 0xCB, 0xBB, 0xBB, 0x33, 0xBB,
+  0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB3, 0x44, 0x43, 0x03, 0xFF, 0xF3, 0x00,
+  0x19, 0xFF, 0x91, 0x00, 0x0F, 0xFF, 0xB4, 0xD8, 0x8D, 0xD4, 0x09, 0xB8,
+  0x9F, 0x90, 0x00, 0x44, 0xCE, 0xD7, 0x00, 0x3F, 0x88, 0xC2, 0x01, 0x9F,
+  0x80, 0x00, 0x0B, 0xE6, 0x00, 0x00, 0x4F, 0xC0, 0x00, 0x00, 0xBB, 0x00,
+  0x00, 0xBB, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x0B,
+  0xB0, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0xBB, 0x00, 0x00, 0xBB, 0x00,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x0B, 0xB0, 0x00, 0x00,
+  0x4F, 0x40, 0x00, 0x00, 0xBB, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0x00, 0x0B, 0xB0, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x4F, 0x40, 0x00,
+  0x00, 0xBB, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x0B,
+  0xB0, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0xBB, 0x00,
+  0x00, 0xBB, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x0B,
+  0xB0, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0xBB, 0x00, 0xBB, 0xEE, 0xB3,
+  0x00, 0x04, 0xFC, 0xB6, 0x00, 0x0B, 0xEB, 0xBB, 0xBB, 0xBB, 0x30, 0x00,
+  0x3B, 0xBB, 0x60, 0x00, 0x8B, 0xBB, 0x03, 0x44, 0x40, 0x03, 0x7F, 0xFF,
+  0x94, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x4D, 0xD8, 0x88, 0xBF, 0x60, 0x00,
+  0x03, 0x49, 0xF3, 0xD7, 0x30, 0x00, 0x2C, 0xE6, 0x00, 0x00, 0x08, 0xFE,
+  0x60, 0x00, 0x00, 0x00, 0xCF, 0x40, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x40, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40,
+  0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x08, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x40, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40,
+  0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x08, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x40, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40,
+  0x6B, 0xBD, 0xFB, 0xB3, 0x00, 0x00, 0x08, 0xCF, 0xC8, 0x6B, 0xBB, 0xBB,
+  0xB3, 0x00, 0x00, 0x08, 0xBB, 0xB8, 0x00, 0x00, 0x44, 0xCF, 0xFF, 0xC4,
+  0x40, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x88, 0x89, 0xFF, 0x60, 0x00, 0x00,
+  0x6E, 0xC4, 0x10, 0x00, 0x14, 0xCE, 0x60, 0x00, 0x7F, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0xCF, 0x70, 0x0F, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF,
+  0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0xBB, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0xBB, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xBB, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x6D, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4D, 0x60, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0,
+  0x0C, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x2B, 0xF6, 0x00,
+  0x00, 0x00, 0x06, 0xFB, 0x20, 0x00, 0x2C, 0xEB, 0x30, 0x00, 0x3B, 0xEC,
+  0x20, 0x00, 0x00, 0x0B, 0xBE, 0xFF, 0xFE, 0xBB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x68, 0x88, 0x60, 0x00, 0x00, 0x00, 0x24, 0x44, 0x10, 0x24, 0xFF,
+  0xFF, 0x94, 0x00, 0x00, 0x8F, 0xFF, 0x42, 0xBF, 0x88, 0x88, 0xBF, 0x60,
+  0x00, 0x24, 0x7F, 0x4C, 0x94, 0x00, 0x00, 0x24, 0xE6, 0x00, 0x00, 0x4F,
+  0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x4F, 0xF6, 0x00, 0x00,
+  0x00, 0x00, 0x2B, 0xF0, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xF8, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x4F,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x4F, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xBB, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBB, 0x00, 0x4F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x04, 0xD6, 0x00, 0x4F,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x4F, 0xCC, 0x20, 0x00,
+  0x00, 0x00, 0x7F, 0x40, 0x00, 0x4F, 0x49, 0xB8, 0x00, 0x00, 0x48, 0xFB,
+  0x20, 0x00, 0x4F, 0x41, 0x9F, 0xBB, 0xBB, 0xDF, 0x42, 0x00, 0x00, 0x4F,
+  0x40, 0x00, 0xBB, 0xBB, 0x60, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x48, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x49, 0xFF, 0xFF, 0x44, 0x10, 0x24, 0x44, 0x10, 0x00, 0x6F, 0xF9, 0x88,
+  0x8F, 0xF9, 0x08, 0xFF, 0xF4, 0x00, 0x6E, 0xC4, 0x10, 0x00, 0x49, 0xF8,
+  0x8F, 0x44, 0x10, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
+  0x0F, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x08, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xF0, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x0B,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x6D, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xBF, 0x00, 0x00, 0xFD, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0xCF, 0xF0, 0x00, 0x03, 0xD7, 0x30, 0x00, 0x00, 0x02, 0x4E, 0xDF,
+  0x00, 0x00, 0x04, 0xDD, 0x82, 0x00, 0x08, 0xBF, 0x68, 0xF0, 0x00, 0x00,
+  0x03, 0xFF, 0xCB, 0xBB, 0xFF, 0x70, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x6B,
+  0xBB, 0xB8, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x88, 0x88, 0x88,
+  0x20, 0x02, 0x44, 0x44, 0x00, 0x00, 0x03, 0x44, 0x10, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x28, 0xDF, 0xF9, 0x60, 0x02, 0x44, 0x9F, 0x00, 0x8C, 0xF7,
+  0x44, 0xCE, 0x60, 0x00, 0x08, 0xF4, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xFB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFC, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3B, 0xBB, 0xDF, 0xBB, 0xBB, 0xBB, 0x80, 0x00, 0x03, 0xBB, 0xBB, 0xBB,
+  0xBB, 0xBB, 0xB8, 0x00, 0x00, 0x00, 0x04, 0x9F, 0xFF, 0xFC, 0x41, 0x42,
+  0x00, 0x06, 0xFF, 0x98, 0x88, 0x9F, 0x9F, 0x80, 0x06, 0xEC, 0x41, 0x00,
+  0x01, 0x4C, 0xF8, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x08,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00,
+  0x04, 0x20, 0x00, 0x8F, 0x94, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B,
+  0xFD, 0x88, 0x88, 0x20, 0x00, 0x00, 0x00, 0x24, 0x44, 0x4F, 0xFC, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x91, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x9F, 0x43, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x4F,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x44, 0xFF, 0x60, 0x00, 0x00, 0x00,
+  0x6F, 0xB2, 0x4F, 0xFE, 0xB3, 0x00, 0x03, 0xBE, 0xC2, 0x03, 0xB3, 0xBB,
+  0xEF, 0xFF, 0xFD, 0xB0, 0x00, 0x00, 0x00, 0x06, 0x88, 0x88, 0x40, 0x00,
+  0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x4C, 0xC4,
+  0x44, 0x44, 0x44, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x00, 0x34, 0x4C, 0xC4, 0x44, 0x44, 0x44, 0x40, 0x00, 0x00, 0x0B, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xD4, 0x00, 0x00, 0x00, 0x02,
+  0x88, 0x00, 0x00, 0xFD, 0x30, 0x00, 0x06, 0xBC, 0xF7, 0x00, 0x00, 0x3B,
+  0xEF, 0xFF, 0xFD, 0xBB, 0x60, 0x00, 0x00, 0x00, 0x68, 0x88, 0x84, 0x00,
+  0x00, 0x34, 0x44, 0x00, 0x00, 0x00, 0x14, 0x44, 0x41, 0x00, 0xBF, 0xFF,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x34, 0x9F, 0x00, 0x00, 0x00,
+  0x14, 0x47, 0xF4, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4,
+  0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x4D,
+  0x60, 0x00, 0x00, 0x04, 0xD9, 0xF4, 0x00, 0x00, 0x0B, 0xE6, 0x00, 0x08,
+  0xBD, 0x74, 0xFC, 0xB6, 0x00, 0x00, 0xBD, 0xFF, 0xFC, 0xB6, 0x03, 0xBB,
+  0xB6, 0x00, 0x00, 0x04, 0x88, 0x82, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44,
+  0x44, 0x44, 0x10, 0x00, 0x14, 0x44, 0x44, 0x44, 0x10, 0x8F, 0xFF, 0xFF,
+  0xF4, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0x47, 0xF7, 0x44, 0x10,
+  0x00, 0x14, 0x47, 0xF7, 0x44, 0x10, 0x00, 0x3D, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xB2, 0x00, 0x00, 0x00, 0x02, 0xC8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xC2, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x4D, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0xF4, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x90,
+  0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x0C,
+  0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x03, 0xE6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD4, 0xBB, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xDE, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xBB, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44,
+  0x44, 0x30, 0x00, 0x00, 0x00, 0x34, 0x44, 0x44, 0x10, 0x8F, 0xFF, 0xFB,
+  0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x02, 0x4F, 0x94, 0x30, 0x00,
+  0x00, 0x00, 0x34, 0x4C, 0x44, 0x10, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0x82, 0x00, 0x00,
+  0x8F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xCF, 0xC0, 0x00, 0x08, 0xF0,
+  0x00, 0x00, 0x04, 0xF4, 0x00, 0x0F, 0xFF, 0x00, 0x01, 0x94, 0x00, 0x00,
+  0x00, 0x4F, 0x40, 0x06, 0xD8, 0xD6, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x04,
+  0xF4, 0x00, 0xBB, 0x0B, 0xB0, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x08, 0x70,
+  0x2C, 0x80, 0x8C, 0x20, 0x7D, 0x30, 0x00, 0x00, 0x00, 0x8F, 0x08, 0xF0,
+  0x00, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x8F, 0x00, 0x0F,
+  0x80, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x7F, 0x40, 0x00, 0x4F, 0x4E,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x02, 0xB9, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xF9, 0x10, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8B, 0x60, 0x00, 0x00, 0x6B, 0x80, 0x00, 0x00, 0x00, 0x44,
+  0x44, 0x41, 0x00, 0x01, 0x44, 0x44, 0x43, 0x00, 0x0F, 0xFF, 0xFF, 0x40,
+  0x00, 0x4F, 0xFF, 0xFF, 0xB0, 0x00, 0x49, 0xF4, 0x41, 0x00, 0x01, 0x44,
+  0xFF, 0x73, 0x00, 0x00, 0x08, 0xC2, 0x00, 0x00, 0x02, 0xCE, 0x60, 0x00,
+  0x00, 0x00, 0x09, 0xB2, 0x00, 0x02, 0xBF, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0xC0, 0x00, 0xCF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xC4,
+  0xCB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xC8, 0x08, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xB9, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0x10, 0x00,
+  0x19, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xC8, 0x00, 0x00, 0x00, 0x08, 0xF9,
+  0x10, 0x00, 0x02, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x08,
+  0xCF, 0xCB, 0xB3, 0x00, 0x03, 0xBB, 0xCF, 0xFB, 0x60, 0x8B, 0xBB, 0xBB,
+  0x30, 0x00, 0x3B, 0xBB, 0xBB, 0xB6, 0x03, 0x44, 0x44, 0x20, 0x00, 0x00,
+  0x24, 0x44, 0x44, 0x20, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+  0xF8, 0x03, 0x7F, 0x74, 0x20, 0x00, 0x00, 0x24, 0x49, 0xF4, 0x20, 0x03,
+  0xD7, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x08, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x9B, 0x20, 0x00, 0x00, 0x2C, 0x80, 0x00, 0x00, 0x00,
+  0x0F, 0x80, 0x00, 0x00, 0x00, 0x8C, 0x20, 0x00, 0x00, 0x0B, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x04, 0xD6, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xD3, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x70,
+  0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x09, 0xB2,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC8, 0x00, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xC2, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0x8B, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0C, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0x88, 0x88, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x20, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x8F,
+  0x44, 0x44, 0x44, 0x44, 0xCC, 0x20, 0x8F, 0x00, 0x00, 0x00, 0x19, 0xF8,
+  0x00, 0x48, 0x00, 0x00, 0x00, 0x4F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xC9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3E, 0x60, 0x00, 0x00, 0x00, 0x00, 0x04, 0xD6, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3D, 0x70, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
+  0x00, 0x00, 0x04, 0xF4, 0x0B, 0xD4, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x6E,
+  0xEB, 0xBB, 0xBB, 0xBB, 0xBC, 0xF4, 0x6B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+  0xB3, 0x00, 0x00, 0x00, 0x44, 0x10, 0x00, 0x04, 0x8F, 0xF4, 0x00, 0x00,
+  0x8F, 0x44, 0x10, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00,
+  0x00, 0x4F, 0x40, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0x40,
+  0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x04,
+  0xF4, 0x00, 0x00, 0x00, 0xC9, 0x10, 0x00, 0x44, 0xCB, 0x60, 0x00, 0x0F,
+  0xFF, 0x00, 0x00, 0x00, 0x44, 0xCB, 0x60, 0x00, 0x00, 0x00, 0xC9, 0x10,
+  0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x04,
+  0xF4, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00,
+  0x00, 0x4F, 0x40, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0x40,
+  0x00, 0x00, 0x00, 0x8F, 0x44, 0x10, 0x00, 0x04, 0x8F, 0xF4, 0x00, 0x00,
+  0x00, 0x44, 0x10, 0x14, 0x14, 0xF4, 0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4,
+  0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4,
+  0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4,
+  0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF4, 0x14, 0x10, 0x14, 0x40, 0x00, 0x00,
+  0x04, 0xFF, 0x84, 0x00, 0x00, 0x14, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x4F,
+  0x40, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00,
+  0x04, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x04, 0xF4, 0x00,
+  0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x19,
+  0xC0, 0x00, 0x00, 0x00, 0x6B, 0xC4, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0x00,
+  0x00, 0x6B, 0xC4, 0x40, 0x00, 0x19, 0xC0, 0x00, 0x00, 0x04, 0xF4, 0x00,
+  0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x4F,
+  0x40, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00,
+  0x04, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x14, 0x4F, 0x80, 0x00,
+  0x04, 0xFF, 0x84, 0x00, 0x00, 0x14, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xF8, 0x40, 0x00, 0x00,
+  0x48, 0x3D, 0xF4, 0x44, 0xFD, 0x30, 0x00, 0x3D, 0xF7, 0xD3, 0x00, 0x03,
+  0xBE, 0xC4, 0x4F, 0xD3, 0x84, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x84, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00 };
+
+const GFXglyph FreeMono18pt4aGlyphs[] PROGMEM = {
+  {     0,   0,   0,  21,    0,    1 },   // 0x20 ' '
+  {     0,   4,  23,  21,    8,  -21 },   // 0x21 '!'
+  {    46,  13,  11,  21,    4,  -21 },   // 0x22 '"'
+  {   118,  15,  25,  21,    3,  -22 },   // 0x23 '#'
+  {   306,  15,  25,  21,    3,  -22 },   // 0x24 '$'
+  {   494,  15,  23,  21,    3,  -21 },   // 0x25 '%'
+  {   667,  15,  20,  21,    3,  -18 },   // 0x26 '&'
+  {   817,   6,  11,  21,    8,  -21 },   // 0x27 '''
+  {   850,   6,  27,  21,   10,  -21 },   // 0x28 '('
+  {   931,   6,  27,  21,    6,  -21 },   // 0x29 ')'
+  {  1012,  15,  13,  21,    3,  -21 },   // 0x2A '*'
+  {  1110,  15,  18,  21,    3,  -18 },   // 0x2B '+'
+  {  1245,   8,  11,  21,    4,   -5 },   // 0x2C ','
+  {  1289,  17,   2,  21,    2,  -10 },   // 0x2D '-'
+  {  1306,   6,   5,  21,    8,   -3 },   // 0x2E '.'
+  {  1321,  15,  27,  21,    3,  -23 },   // 0x2F '/'
+  {  1524,  15,  23,  21,    3,  -21 },   // 0x30 '0'
+  {  1697,  13,  22,  21,    4,  -21 },   // 0x31 '1'
+  {  1840,  15,  22,  21,    3,  -21 },   // 0x32 '2'
+  {  2005,  15,  23,  21,    3,  -21 },   // 0x33 '3'
+  {  2178,  13,  22,  21,    4,  -21 },   // 0x34 '4'
+  {  2321,  15,  23,  21,    3,  -21 },   // 0x35 '5'
+  {  2494,  14,  23,  21,    4,  -21 },   // 0x36 '6'
+  {  2655,  15,  22,  21,    3,  -21 },   // 0x37 '7'
+  {  2820,  15,  23,  21,    3,  -21 },   // 0x38 '8'
+  {  2993,  14,  23,  21,    4,  -21 },   // 0x39 '9'
+  {  3154,   6,  17,  21,    8,  -15 },   // 0x3A ':'
+  {  3205,   8,  21,  21,    5,  -15 },   // 0x3B ';'
+  {  3289,  17,  18,  21,    2,  -18 },   // 0x3C '<'
+  {  3442,  19,   7,  21,    1,  -13 },   // 0x3D '='
+  {  3509,  16,  18,  21,    3,  -18 },   // 0x3E '>'
+  {  3653,  14,  22,  21,    4,  -20 },   // 0x3F '?'
+  {  3807,  15,  24,  21,    3,  -21 },   // 0x40 '@'
+  {  3987,  21,  20,  21,    0,  -19 },   // 0x41 'A'
+  {  4197,  17,  20,  21,    2,  -19 },   // 0x42 'B'
+  {  4367,  17,  22,  21,    2,  -20 },   // 0x43 'C'
+  {  4554,  17,  20,  21,    2,  -19 },   // 0x44 'D'
+  {  4724,  17,  20,  21,    2,  -19 },   // 0x45 'E'
+  {  4894,  17,  20,  21,    2,  -19 },   // 0x46 'F'
+  {  5064,  18,  22,  21,    2,  -20 },   // 0x47 'G'
+  {  5262,  18,  20,  21,    2,  -19 },   // 0x48 'H'
+  {  5442,  13,  20,  21,    4,  -19 },   // 0x49 'I'
+  {  5572,  18,  21,  21,    3,  -19 },   // 0x4A 'J'
+  {  5761,  19,  20,  21,    2,  -19 },   // 0x4B 'K'
+  {  5951,  16,  20,  21,    3,  -19 },   // 0x4C 'L'
+  {  6111,  21,  20,  21,    0,  -19 },   // 0x4D 'M'
+  {  6321,  19,  20,  21,    1,  -19 },   // 0x4E 'N'
+  {  6511,  19,  22,  21,    1,  -20 },   // 0x4F 'O'
+  {  6720,  16,  20,  21,    2,  -19 },   // 0x50 'P'
+  {  6880,  19,  25,  21,    1,  -20 },   // 0x51 'Q'
+  {  7118,  19,  20,  21,    2,  -19 },   // 0x52 'R'
+  {  7308,  15,  22,  21,    3,  -20 },   // 0x53 'S'
+  {  7473,  17,  20,  21,    2,  -19 },   // 0x54 'T'
+  {  7643,  18,  21,  21,    2,  -19 },   // 0x55 'U'
+  {  7832,  21,  20,  21,    0,  -19 },   // 0x56 'V'
+  {  8042,  21,  20,  21,    0,  -19 },   // 0x57 'W'
+  {  8252,  19,  20,  21,    1,  -19 },   // 0x58 'X'
+  {  8442,  19,  20,  21,    1,  -19 },   // 0x59 'Y'
+  {  8632,  15,  20,  21,    3,  -19 },   // 0x5A 'Z'
+  {  8782,   6,  27,  21,    9,  -21 },   // 0x5B '['
+  {  8863,  15,  27,  21,    3,  -23 },   // 0x5C '\'
+  {  9066,   6,  27,  21,    6,  -21 },   // 0x5D ']'
+  {  9147,  15,   9,  21,    3,  -21 },   // 0x5E '^'
+  {  9215,  21,   3,  21,    0,    3 },   // 0x5F '_'
+  {  9247,   7,   6,  21,    5,  -22 },   // 0x60 '`'
+  {  9268,  17,  17,  21,    2,  -15 },   // 0x61 'a'
+  {  9413,  18,  23,  21,    1,  -21 },   // 0x62 'b'
+  {  9620,  16,  17,  21,    3,  -15 },   // 0x63 'c'
+  {  9756,  19,  23,  21,    2,  -21 },   // 0x64 'd'
+  {  9975,  16,  17,  21,    2,  -15 },   // 0x65 'e'
+  { 10111,  15,  22,  21,    4,  -21 },   // 0x66 'f'
+  { 10276,  18,  23,  21,    2,  -15 },   // 0x67 'g'
+  { 10483,  18,  22,  21,    2,  -21 },   // 0x68 'h'
+  { 10681,  15,  22,  21,    3,  -21 },   // 0x69 'i'
+  { 10846,  11,  29,  21,    4,  -21 },   // 0x6A 'j'
+  { 11006,  17,  22,  21,    3,  -21 },   // 0x6B 'k'
+  { 11193,  15,  22,  21,    3,  -21 },   // 0x6C 'l'
+  { 11358,  21,  16,  21,    0,  -15 },   // 0x6D 'm'
+  { 11526,  18,  16,  21,    1,  -15 },   // 0x6E 'n'
+  { 11670,  17,  17,  21,    2,  -15 },   // 0x6F 'o'
+  { 11815,  18,  23,  21,    1,  -15 },   // 0x70 'p'
+  { 12022,  19,  23,  21,    2,  -15 },   // 0x71 'q'
+  { 12241,  17,  16,  21,    3,  -15 },   // 0x72 'r'
+  { 12377,  15,  17,  21,    3,  -15 },   // 0x73 's'
+  { 12505,  16,  21,  21,    2,  -19 },   // 0x74 't'
+  { 12673,  18,  17,  21,    2,  -15 },   // 0x75 'u'
+  { 12826,  21,  16,  21,    0,  -15 },   // 0x76 'v'
+  { 12994,  21,  16,  21,    0,  -15 },   // 0x77 'w'
+  { 13162,  19,  16,  21,    1,  -15 },   // 0x78 'x'
+  { 13314,  19,  23,  21,    1,  -15 },   // 0x79 'y'
+  { 13533,  14,  16,  21,    4,  -15 },   // 0x7A 'z'
+  { 13645,   9,  27,  21,    6,  -21 },   // 0x7B '{'
+  { 13767,   3,  27,  21,    9,  -21 },   // 0x7C '|'
+  { 13808,   9,  27,  21,    6,  -21 },   // 0x7D '}'
+  { 13930,  15,   6,  21,    3,  -12 } }; // 0x7E '~'
+
+const GFXalphaFont FreeMono18pt4a PROGMEM = {
+  (const uint8_t  *)FreeMono18pt4aBitmaps,
+  (const GFXglyph *)FreeMono18pt4aGlyphs,
+  0x20, 0x7E, 35 };
+
+// Approx. 14647 bytes
@@ -0,0 +1,249 @@
+#include "FakeTFT.h"
+
+// Subset of the ILI9341 command set the fake panel understands
+#define FAKETFT_SLPOUT   0x11
+#define FAKETFT_DISPON   0x29
+#define FAKETFT_CASET    0x2A
+#define FAKETFT_PASET    0x2B
+#define FAKETFT_RAMWR    0x2C
+#define FAKETFT_RAMRD    0x2E
+#define FAKETFT_VSCRDEF  0x33
+#define FAKETFT_MADCTL   0x36
+#define FAKETFT_VSCRSADD 0x37
+#define FAKETFT_PIXFMT   0x3A
+
+#define MADCTL_MY  0x80
+#define MADCTL_MX  0x40
+#define MADCTL_MV  0x20
+#define MADCTL_BGR 0x08
+
+FakeTFTPanel::FakeTFTPanel(int8_t dc) : dcPin(dc) {
+	reset();
+}
+
+void FakeTFTPanel::reset(void) {
+	memset(&counters, 0, sizeof(counters));
+	memset(gram, 0, sizeof(gram));
+	cmd = argIndex = hiByte = readPhase = 0;
+	writeLimit = readLimit = clock = 0;
+	madctl = MADCTL_MX | MADCTL_BGR;
+	xs = ys = cx = cy = 0;
+	xe = FAKETFT_WIDTH - 1;
+	ye = FAKETFT_HEIGHT - 1;
+	tfa = vsp = 0;
+	vsa = FAKETFT_HEIGHT;
+}
+
+void FakeTFTPanel::beginTransaction(uint32_t clock) {
+	this->clock = clock;
+	counters.transactions++;
+}
+
+// Map a column/page address (what CASET and PASET talk about) to a GRAM
+// offset, honoring the row/column exchange and mirroring bits of MADCTL
+// the same way the real controller does.
+uint32_t FakeTFTPanel::index(uint16_t col, uint16_t page) const {
+	bool     mv = madctl & MADCTL_MV;
+	uint16_t cw = mv ? FAKETFT_HEIGHT : FAKETFT_WIDTH,
+	         ph = mv ? FAKETFT_WIDTH  : FAKETFT_HEIGHT;
+	if ((col >= cw) || (page >= ph)) return UINT32_MAX;
+	if (madctl & MADCTL_MX) col  = cw - 1 - col;
+	if (madctl & MADCTL_MY) page = ph - 1 - page;
+	return mv ? ((uint32_t)col * FAKETFT_WIDTH + page) :
+	            ((uint32_t)page * FAKETFT_WIDTH + col);
+}
+
+uint16_t FakeTFTPanel::getPixel(int16_t x, int16_t y) const {
+	uint32_t i = ((x < 0) || (y < 0)) ? UINT32_MAX : index(x, y);
+	return (i == UINT32_MAX) ? 0 : gram[i];
+}
+
+// Glass rows in the vertical scrolling area show memory rows starting at
+// VSCRSADD's, wrapping around within the area
+uint16_t FakeTFTPanel::getGlassPixel(int16_t x, int16_t row) const {
+	if ((row >= tfa) && (row < tfa + vsa) && (vsp >= tfa) && (vsp < tfa + vsa)) {
+		row = tfa + (row - tfa + vsp - tfa) % vsa;
+	}
+	return getPixel(x, row);
+}
+
+void FakeTFTPanel::store(uint16_t color) {
+	uint32_t i = index(cx, cy);
+	if (i != UINT32_MAX) gram[i] = color;
+	counters.pixels++;
+	if (++cx > xe) {
+		cx = xs;
+		if (++cy > ye) cy = ys;
+	}
+}
+
+uint8_t FakeTFTPanel::transfer(uint8_t b) {
+	counters.bytes++;
+
+	if (digitalRead(dcPin) == LOW) { // Command byte
+		counters.commands++;
+		cmd      = b;
+		argIndex = 0;
+		switch (cmd) {
+		case FAKETFT_CASET:
+			counters.caset++;
+			break;
+		case FAKETFT_PASET:
+			counters.paset++;
+			break;
+		case FAKETFT_RAMWR:
+			counters.ramwr++;
+			cx = xs;
+			cy = ys;
+			break;
+		case FAKETFT_RAMRD:
+			cx        = xs;
+			cy        = ys;
+			readPhase = 0;
+			break;
+		}
+		return 0;
+	}
+
+	if (cmd == FAKETFT_RAMRD) { // 18-bit color, a byte per component
+		uint8_t r = 0;
+		if (readPhase) {
+			uint32_t i = index(cx, cy);
+			uint16_t c = (i == UINT32_MAX) ? 0 : gram[i];
+			switch (readPhase) {
+			case 1: r = (c >> 8) & 0xF8; break;
+			case 2: r = (c >> 3) & 0xFC; break;
+			case 3:
+				r = (c << 3) & 0xF8;
+				if (++cx > xe) {
+					cx = xs;
+					if (++cy > ye) cy = ys;
+				}
+				break;
+			}
+			if (readLimit && (clock > readLimit)) r ^= 0x40;
+		}
+		readPhase = (readPhase == 3) ? 1 : (readPhase + 1);
+		return r;
+	}
+	if ((cmd == FAKETFT_RAMWR) && writeLimit && (clock > writeLimit)) {
+		b ^= 0x10;
+	}
+
+	switch (cmd) { // Data byte, meaning depends on the last command
+	case FAKETFT_CASET:
+		switch (argIndex) {
+		case 0: xs = (uint16_t)b << 8; break;
+		case 1: xs |= b;               break;
+		case 2: xe = (uint16_t)b << 8; break;
+		case 3: xe |= b;               break;
+		}
+		break;
+	case FAKETFT_PASET:
+		switch (argIndex) {
+		case 0: ys = (uint16_t)b << 8; break;
+		case 1: ys |= b;               break;
+		case 2: ye = (uint16_t)b << 8; break;
+		case 3: ye |= b;               break;
+		}
+		break;
+	case FAKETFT_RAMWR:
+		if (argIndex & 1) store(((uint16_t)hiByte << 8) | b);
+		else              hiByte = b;
+		break;
+	case FAKETFT_MADCTL:
+		if (argIndex == 0) madctl = b;
+		break;
+	case FAKETFT_VSCRDEF:
+		switch (argIndex) {
+		case 0: tfa = (uint16_t)b << 8; break;
+		case 1: tfa |= b;               break;
+		case 2: vsa = (uint16_t)b << 8; break;
+		case 3: vsa |= b;               break;
+		}
+		break;
+	case FAKETFT_VSCRSADD:
+		switch (argIndex) {
+		case 0: vsp = (uint16_t)b << 8; break;
+		case 1: vsp |= b;               break;
+		}
+		break;
+	}
+	if (argIndex < 255) argIndex++;
+	else                argIndex = 2; // Keep RAMWR byte parity on long runs
+	return 0;
+}
+
+FakeTFT::FakeTFT(void) :
+  Adafruit_SPITFT(FAKETFT_WIDTH, FAKETFT_HEIGHT, FAKETFT_CS, FAKETFT_DC),
+  panel(FAKETFT_DC) {
+}
+
+void FakeTFT::begin(uint32_t freq) {
+	// Not in the constructor, SPI may not be constructed yet
+	SPI.attach(&panel);
+	if (!freq) freq = 32000000;
+	_freq = freq;
+	initSPI(freq);
+
+	startWrite();
+	writeCommand(FAKETFT_PIXFMT);
+	spiWrite(0x55);
+	writeCommand(FAKETFT_SLPOUT);
+	writeCommand(FAKETFT_DISPON);
+	endWrite();
+
+	setRotation(0);
+	resetCounters();
+}
+
+// Same MADCTL values and dimensions as Adafruit_ILI9341::setRotation()
+void FakeTFT::setRotation(uint8_t m) {
+	rotation = m % 4;
+	switch (rotation) {
+	case 0:
+		m       = (MADCTL_MX | MADCTL_BGR);
+		_width  = FAKETFT_WIDTH;
+		_height = FAKETFT_HEIGHT;
+		break;
+	case 1:
+		m       = (MADCTL_MV | MADCTL_BGR);
+		_width  = FAKETFT_HEIGHT;
+		_height = FAKETFT_WIDTH;
+		break;
+	case 2:
+		m       = (MADCTL_MY | MADCTL_BGR);
+		_width  = FAKETFT_WIDTH;
+		_height = FAKETFT_HEIGHT;
+		break;
+	case 3:
+		m       = (MADCTL_MX | MADCTL_MY | MADCTL_MV | MADCTL_BGR);
+		_width  = FAKETFT_HEIGHT;
+		_height = FAKETFT_WIDTH;
+		break;
+	}
+
+	startWrite();
+	writeCommand(FAKETFT_MADCTL);
+	spiWrite(m);
+	endWrite();
+	invalidateAddrWindow();
+}
+
+// Same byte sequence as Adafruit_ILI9341::setAddrWindow()
+void FakeTFT::setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+	panel.counters.addrWindows++;
+	uint32_t xa = ((uint32_t)x << 16) | (x+w-1);
+	uint32_t ya = ((uint32_t)y << 16) | (y+h-1);
+	if (xa != addrColumns) {
+		writeCommand(FAKETFT_CASET);
+		SPI_WRITE32(xa);
+		addrColumns = xa;
+	}
+	if (ya != addrRows) {
+		writeCommand(FAKETFT_PASET);
+		SPI_WRITE32(ya);
+		addrRows = ya;
+	}
+	writeCommand(FAKETFT_RAMWR);
+}
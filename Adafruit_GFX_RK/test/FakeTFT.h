@@ -0,0 +1,89 @@
+// An ILI9341 stand-in for running Adafruit_SPITFT on the host.
+//
+// FakeTFT is a normal Adafruit_SPITFT subclass (it sends the same CASET,
+// PASET, RAMWR and MADCTL sequences as Adafruit_ILI9341) talking over the
+// fake SPI bus in SPI.h. On the far end of that bus FakeTFTPanel decodes
+// the byte stream into a 240x320 565 GRAM, so the result of any drawing
+// call can be compared pixel-for-pixel with a GFXcanvas16, and counts
+// everything it sees so the benchmark can report bus cost per primitive.
+#ifndef __FAKETFT_H
+#define __FAKETFT_H
+
+#include "Particle.h"
+#include "SPI.h"
+#include "Adafruit_SPITFT.h"
+
+#define FAKETFT_WIDTH  240 ///< Native (rotation 0) width, same as ILI9341
+#define FAKETFT_HEIGHT 320 ///< Native (rotation 0) height, same as ILI9341
+
+#define FAKETFT_CS 4 ///< Fake chip-select pin number
+#define FAKETFT_DC 5 ///< Fake data/command pin number
+
+/// What the fake panel saw on the wire
+typedef struct {
+	uint32_t bytes;        ///< Every byte clocked out, command or data
+	uint32_t commands;     ///< Bytes sent with D/C low
+	uint32_t pixels;       ///< 16-bit pixels that landed in GRAM
+	uint32_t transactions; ///< beginTransaction() calls
+	uint32_t addrWindows;  ///< setAddrWindow() calls (counted by FakeTFT)
+	uint32_t caset;        ///< CASET commands
+	uint32_t paset;        ///< PASET commands
+	uint32_t ramwr;        ///< RAMWR commands
+} FakeTFTCounters;
+
+/// The 'panel' end of the fake bus: a command decoder in front of a GRAM
+class FakeTFTPanel : public HostSPIDevice {
+public:
+	FakeTFTPanel(int8_t dc);
+
+	void     beginTransaction(uint32_t clock);
+	uint8_t  transfer(uint8_t b);
+
+	void     reset(void);
+	uint16_t getPixel(int16_t x, int16_t y) const;
+	uint16_t getGlassPixel(int16_t x, int16_t row) const;
+	uint16_t *getBuffer(void) { return gram; }
+
+	FakeTFTCounters counters;
+	uint32_t writeLimit; ///< Pixels written faster than this arrive corrupted, 0 for no limit
+	uint32_t readLimit;  ///< Pixels read faster than this come back corrupted, 0 for no limit
+	uint32_t clock;      ///< SPI clock of the current transaction
+
+private:
+	void     store(uint16_t color);
+	uint32_t index(uint16_t col, uint16_t page) const;
+
+	int8_t   dcPin;
+	uint8_t  cmd;        // Last command byte seen
+	uint8_t  argIndex;   // Data bytes received since that command
+	uint8_t  hiByte;     // First half of a 16-bit pixel
+	uint8_t  madctl;
+	uint16_t xs, xe, ys, ye; // Address window (column/page space)
+	uint16_t cx, cy;         // GRAM write (or read) pointer
+	uint8_t  readPhase;      // RAMRD: 0 for the dummy byte, then red, green, blue
+	uint16_t tfa, vsa, vsp;  // Vertical scrolling: top fixed rows, scrolling rows, start
+	uint16_t gram[FAKETFT_WIDTH * FAKETFT_HEIGHT];
+};
+
+/// ILI9341-compatible Adafruit_SPITFT driver for the fake panel
+class FakeTFT : public Adafruit_SPITFT {
+public:
+	FakeTFT(void);
+
+	void begin(uint32_t freq = 0);
+	void setRotation(uint8_t m);
+	void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+	uint16_t getPixel(int16_t x, int16_t y) const { return panel.getPixel(x, y); }
+	/// What the panel shows, at rotation 0, with vertical scrolling applied
+	uint16_t getGlassPixel(int16_t x, int16_t y) const { return panel.getGlassPixel(x, y); }
+	void     resetCounters(void) {
+		memset(&panel.counters, 0, sizeof(panel.counters));
+		SPI.dmaTransfers = 0;
+	}
+	const FakeTFTCounters &counters(void) const { return panel.counters; }
+
+	FakeTFTPanel panel;
+};
+
+#endif /* __FAKETFT_H */
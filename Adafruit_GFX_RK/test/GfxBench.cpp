@@ -0,0 +1,105 @@
+// Benchmark runner for the helpingHands.cpp tests on the host. Build from
+// this directory with:
+// g++ -std=c++11 -O2 -DPARTICLE -I. -I../src -I../../JsonParserGeneratorRK/test/gcclib GfxBench.cpp Scenes.cpp FakeTFT.cpp host_wiring.cpp ../src/Adafruit_GFX_RK.cpp ../src/Adafruit_SPITFT.cpp ../src/Adafruit_DirtyCanvas.cpp ../src/Adafruit_GlyphCache.cpp ../src/Adafruit_Pixel565.cpp ../../JsonParserGeneratorRK/test/gcclib/helpers.cpp ../../JsonParserGeneratorRK/test/gcclib/spark_wiring_string.cpp ../../JsonParserGeneratorRK/test/gcclib/spark_wiring_print.cpp -o GfxBench
+//
+// ./GfxBench [filter] runs every scene whose name contains filter. Output
+// follows Google Benchmark: one line per scene with wall time per
+// iteration, then counters. Everything except time is exact (it comes
+// from FakeTFT) so before/after numbers for a change can be diffed.
+// Built with -DSPITFT_TRACE, each scene is followed by the tracer's
+// per-primitive report for one more run of it.
+#include "Particle.h"
+#include "FakeTFT.h"
+#include "Scenes.h"
+
+#define BENCH_MIN_NANOS      200000000ULL ///< Keep iterating for at least this long
+#define BENCH_MIN_ITERATIONS 3
+#define BENCH_MAX_ITERATIONS 1000
+
+static FakeTFT tft;
+
+/// Accumulates time and bus traffic, minus whatever the scene paused for
+class BenchClock : public SceneClock {
+public:
+	BenchClock() : nanos(0), start(0), paused(false) {
+		memset(&counters, 0, sizeof(counters));
+		memset(&mark, 0, sizeof(mark));
+	}
+
+	void resume(void) {
+		paused = false;
+		mark   = tft.counters();
+		start  = hostNanos();
+	}
+
+	void pause(void) {
+		uint64_t now = hostNanos();
+		if (paused) return;
+		paused = true;
+		nanos += now - start;
+
+		const FakeTFTCounters &c = tft.counters();
+		counters.bytes        += c.bytes        - mark.bytes;
+		counters.commands     += c.commands     - mark.commands;
+		counters.pixels       += c.pixels       - mark.pixels;
+		counters.transactions += c.transactions - mark.transactions;
+		counters.addrWindows  += c.addrWindows  - mark.addrWindows;
+		counters.caset        += c.caset        - mark.caset;
+		counters.paset        += c.paset        - mark.paset;
+		counters.ramwr        += c.ramwr        - mark.ramwr;
+	}
+
+	uint64_t        nanos;
+	FakeTFTCounters counters;
+
+private:
+	uint64_t        start;
+	bool            paused;
+	FakeTFTCounters mark;
+};
+
+static void runScene(const Scene &scene) {
+	BenchClock clock;
+	uint32_t   iterations = 0, prims = 0;
+
+	while ((iterations < BENCH_MIN_ITERATIONS) ||
+	       ((clock.nanos < BENCH_MIN_NANOS) && (iterations < BENCH_MAX_ITERATIONS))) {
+		clock.resume();
+		prims += scene.func(tft, clock);
+		clock.pause();
+		iterations++;
+	}
+
+	double perIter = (double)iterations, perPrim = prims ? (double)prims : 1.0;
+	printf("%-22s %11.0f ns %10lu  prims=%-6.0f bytes=%-9.0f cmds=%-7.0f windows=%-6.0f xfers=%-6.0f"
+	       " ns/prim=%-9.1f bytes/prim=%.1f\n",
+	       scene.name, clock.nanos / perIter, (unsigned long)iterations,
+	       prims / perIter,
+	       clock.counters.bytes / perIter,
+	       clock.counters.commands / perIter,
+	       clock.counters.addrWindows / perIter,
+	       clock.counters.transactions / perIter,
+	       clock.nanos / perPrim,
+	       clock.counters.bytes / perPrim);
+
+#if defined(SPITFT_TRACE)
+	tft.traceReset();
+	scene.func(tft, clock);
+	tft.traceFrame(&Serial);
+	printf("\n");
+#endif
+}
+
+int main(int argc, char *argv[]) {
+	const char *filter = (argc > 1) ? argv[1] : NULL;
+
+	tft.begin();
+
+	printf("%-22s %14s %10s  %s\n", "Benchmark", "Time", "Iterations", "Counters (per iteration, then per primitive)");
+	printf("--------------------------------------------------------------------------------------------------------------------\n");
+	for (size_t ii = 0; ii < numScenes; ii++) {
+		if (filter && !strstr(scenes[ii].name, filter)) continue;
+		runScene(scenes[ii]);
+	}
+	return 0;
+}
@@ -0,0 +1,1501 @@
+// Host tests for the GFX core. Build from this directory with:
+// g++ -std=c++14 -DPARTICLE -I. -I../src -I../../JsonParserGeneratorRK/test/gcclib GfxTest.cpp Scenes.cpp FakeTFT.cpp host_wiring.cpp ../src/Adafruit_GFX_RK.cpp ../src/Adafruit_SPITFT.cpp ../src/Adafruit_DirtyCanvas.cpp ../src/Adafruit_BandRenderer.cpp ../src/Adafruit_GlyphCache.cpp ../src/Adafruit_AlphaFont.cpp ../src/Adafruit_DrawQueue.cpp ../src/Adafruit_ScrollConsole.cpp ../src/Adafruit_RLEImage.cpp ../src/Adafruit_ImageLoader.cpp ../src/Adafruit_Compositor.cpp ../src/Adafruit_TileMap.cpp ../src/Adafruit_Widgets.cpp ../src/Adafruit_Pixel565.cpp ../src/Adafruit_PaletteCanvas.cpp ../src/Adafruit_MonoCanvas.cpp ../src/Adafruit_RowCanvas.cpp ../../JsonParserGeneratorRK/test/gcclib/helpers.cpp ../../JsonParserGeneratorRK/test/gcclib/spark_wiring_string.cpp ../../JsonParserGeneratorRK/test/gcclib/spark_wiring_print.cpp -o GfxTest
+// Add -DSPITFT_TRACE to the command line to also test the bus tracer.
+#include "Particle.h"
+#include "FakeTFT.h"
+#include "Scenes.h"
+#include "Adafruit_DirtyCanvas.h"
+#include "Adafruit_BandRenderer.h"
+#include "Adafruit_GlyphCache.h"
+#include "Adafruit_AlphaFont.h"
+#include "Adafruit_Widgets.h"
+#include "Adafruit_DrawQueue.h"
+#include "Adafruit_ScrollConsole.h"
+#include "Adafruit_RLEImage.h"
+#include "Adafruit_ImageLoader.h"
+#include "Adafruit_Compositor.h"
+#include "Adafruit_TileMap.h"
+#include "Adafruit_Pixel565.h"
+#include "Adafruit_PaletteCanvas.h"
+#include "Adafruit_MonoCanvas.h"
+#include "FreeMono9pt7b.h"
+#include "FreeMono18pt4a.h"
+#include "FreeMono12pt4a.h"
+#include "../../Reminders.h"
+#include "../imageconvert/rleencode.h"
+#include "glcdfont.c"
+#include <vector>
+
+GFX_BAKE_FONT(FreeMono9pt7bRuns, FreeMono9pt7b, FreeMono9pt7bBitmaps, FreeMono9pt7bGlyphs);
+static_assert(FreeMono9pt7bRunsBaked.glyph['-' - ' '].runCount == 1, "Baked at compile time");
+
+// Both are too big for the stack
+static FakeTFT     tft;
+static GFXcanvas16 canvas(FAKETFT_WIDTH, FAKETFT_HEIGHT);
+
+// Reads back what GFXcanvas16::drawPixel() stored at (x, y)
+uint16_t canvasPixel(GFXcanvas16 &c, int16_t x, int16_t y) {
+	int16_t t;
+	switch (c.getRotation()) {
+	case 1:
+		t = x;
+		x = FAKETFT_WIDTH - 1 - y;
+		y = t;
+		break;
+	case 2:
+		x = FAKETFT_WIDTH  - 1 - x;
+		y = FAKETFT_HEIGHT - 1 - y;
+		break;
+	case 3:
+		t = x;
+		x = y;
+		y = FAKETFT_HEIGHT - 1 - t;
+		break;
+	}
+	return c.getBuffer()[x + y * FAKETFT_WIDTH];
+}
+
+void _assertSameAsCanvas(const char *what, uint8_t rotation, size_t line) {
+	for (int16_t y = 0; y < tft.height(); y++) {
+		for (int16_t x = 0; x < tft.width(); x++) {
+			uint16_t expected = canvasPixel(canvas, x, y), actual = tft.getPixel(x, y);
+			if (expected != actual) {
+				printf("%s rotation %u pixel (%d,%d) expected %04x got %04x line %lu\n",
+				       what, rotation, x, y, expected, actual, (unsigned long)line);
+				assert(false);
+			}
+		}
+	}
+}
+#define assertSameAsCanvas(what, rot) _assertSameAsCanvas(what, rot, __LINE__)
+
+// The pixel at a time Bresenham writeLine() used to be
+void referenceLine(GFXcanvas16 &c, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+	bool steep = abs(y1 - y0) > abs(x1 - x0);
+	if (steep) {
+		std::swap(x0, y0);
+		std::swap(x1, y1);
+	}
+	if (x0 > x1) {
+		std::swap(x0, x1);
+		std::swap(y0, y1);
+	}
+	int16_t dx = x1 - x0, dy = abs(y1 - y0), err = dx / 2, ystep = (y0 < y1) ? 1 : -1;
+	for (; x0 <= x1; x0++) {
+		if (steep) {
+			c.drawPixel(y0, x0, color);
+		} else {
+			c.drawPixel(x0, y0, color);
+		}
+		err -= dy;
+		if (err < 0) {
+			y0 += ystep;
+			err += dx;
+		}
+	}
+}
+
+// Run-length encode an image with imageconvert's encoder, values being
+// colors (16 bits) or indexes into the 16-color palette
+std::vector<uint8_t> encodeImage(const uint16_t *pixels, size_t n, const uint16_t *palette, uint8_t bits) {
+	return rleEncode(std::vector<uint16_t>(pixels, pixels + n), std::vector<uint16_t>(palette, palette + 16), bits);
+}
+
+// An image file in memory, read back at most step bytes at a time the way
+// an SD card read can come up short
+class MemoryFile : public GFXimageSource {
+public:
+	MemoryFile(const std::vector<uint8_t> &data, size_t step) : data(data), step(step), at(0) {}
+	int read(uint8_t *buf, size_t len) {
+		len = std::min(std::min(len, step), data.size() - at);
+		memcpy(buf, &data[at], len);
+		at += len;
+		return len;
+	}
+	const std::vector<uint8_t> &data;
+	size_t step, at;
+};
+
+// Somewhere to print to that keeps what it gets, up to a limit
+class MemoryPrint : public Print {
+public:
+	MemoryPrint(size_t limit = SIZE_MAX) : limit(limit) {}
+	size_t write(uint8_t b) {
+		if (data.size() >= limit) return 0;
+		data.push_back(b);
+		return 1;
+	}
+	std::vector<uint8_t> data;
+	size_t limit;
+};
+
+// A BMP file of 8-bit red, green and blue, bottom row first unless topDown
+std::vector<uint8_t> makeBMP(const uint8_t *rgb, int32_t w, int32_t h, uint8_t bpp, bool topDown) {
+	uint32_t stride = (w * bpp + 3) & ~3, offset = 54 + 16; // With a gap before the pixels
+	std::vector<uint8_t> f(offset + stride * h, 0);
+	uint32_t fields[] = { 2, (uint32_t)f.size(), 6, 0, 10, offset, 14, 40, 18, (uint32_t)w,
+	                      22, (uint32_t)(topDown ? -h : h), 26, 1 | ((bpp * 8u) << 16) };
+	for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i += 2) {
+		memcpy(&f[fields[i]], &fields[i + 1], 4); // The host is little-endian too
+	}
+	f[0] = 'B';
+	f[1] = 'M';
+	for (int32_t y = 0; y < h; y++) {
+		uint8_t *row = &f[offset + stride * (topDown ? y : (h - 1 - y))];
+		for (int32_t x = 0; x < w; x++) {
+			const uint8_t *c = &rgb[(y * w + x) * 3];
+			row[x * bpp]     = c[2];
+			row[x * bpp + 1] = c[1];
+			row[x * bpp + 2] = c[0];
+		}
+	}
+	return f;
+}
+
+// A reminder screen with a bit of everything, drawn through the static type
+// so GFXbandRenderer records its single-command versions
+static const uint16_t checker[4 * 4] = {
+	SCENE_RED, SCENE_BLUE, SCENE_RED, SCENE_BLUE,
+	SCENE_BLUE, SCENE_RED, SCENE_BLUE, SCENE_RED,
+	SCENE_RED, SCENE_BLUE, SCENE_RED, SCENE_BLUE,
+	SCENE_BLUE, SCENE_RED, SCENE_BLUE, SCENE_RED
+};
+
+template <class GFX>
+void drawReminder(GFX &gfx) {
+	gfx.fillScreen(SCENE_BLACK);
+	gfx.setFont();
+	gfx.setCursor(0, 0);
+	gfx.setTextColor(SCENE_CYAN);
+	gfx.setTextSize(3);
+	gfx.println("Lets help out\na little and\n load the diswasher\n keep cups paired with lids!");
+	gfx.setTextColor(SCENE_YELLOW, SCENE_BLUE);
+	gfx.println("12:34");
+	gfx.fillRoundRect(200, 150, 100, 60, 10, SCENE_GREEN);
+	gfx.drawCircle(60, 180, 50, SCENE_RED);
+	gfx.fillTriangle(10, 230, 150, 100, 300, 239, SCENE_MAGENTA);
+	gfx.drawLine(0, 239, 319, 0, SCENE_WHITE);
+	gfx.drawRGBBitmap(250, 20, checker, 4, 4);
+	gfx.setFont(&FreeMono9pt7b);
+	gfx.setTextSize(1);
+	gfx.setCursor(10, 215);
+	gfx.setTextColor(SCENE_WHITE);
+	gfx.print("Wind down");
+	gfx.setFont();
+}
+
+int main(int argc, char *argv[]) {
+	SceneClock clock;
+
+	tft.begin();
+
+	{
+		// One window, then every pixel of the screen and nothing else
+		tft.resetCounters();
+		tft.fillScreen(SCENE_RED);
+		assert(tft.counters().addrWindows == 1);
+		assert(tft.counters().pixels == FAKETFT_WIDTH * FAKETFT_HEIGHT);
+		assert(tft.counters().bytes == FAKETFT_WIDTH * FAKETFT_HEIGHT * 2 + 11);
+		assert(tft.counters().transactions == 1);
+		assert(tft.getPixel(0, 0) == SCENE_RED);
+		// Sent in chunks of both DMA buffers, a long scanline each
+		assert(SPI.dmaTransfers == FAKETFT_WIDTH * FAKETFT_HEIGHT / (FAKETFT_HEIGHT * 2));
+		assert(tft.getPixel(FAKETFT_WIDTH - 1, FAKETFT_HEIGHT - 1) == SCENE_RED);
+	}
+
+	{
+		// Single pixel costs a whole CASET/PASET/RAMWR
+		tft.resetCounters();
+		tft.drawPixel(10, 20, SCENE_BLUE);
+		assert(tft.counters().addrWindows == 1);
+		assert(tft.counters().commands == 3);
+		assert(tft.counters().bytes == 13);
+		assert(tft.getPixel(10, 20) == SCENE_BLUE);
+		assert(tft.getPixel(11, 20) == SCENE_RED);
+	}
+
+	{
+		// Pixels down a column keep the CASET, along a row the PASET, and
+		// the same window again is just the RAMWR; rotating, sending a
+		// command or reading a register forgets the window
+		tft.resetCounters();
+		tft.drawPixel(30, 40, SCENE_BLUE);
+		tft.drawPixel(30, 41, SCENE_BLUE);
+		tft.drawPixel(31, 41, SCENE_BLUE);
+		tft.drawPixel(31, 41, SCENE_BLUE);
+		assert(tft.counters().addrWindows == 4);
+		assert(tft.counters().caset == 2 && tft.counters().paset == 2);
+		assert(tft.counters().ramwr == 4);
+		assert(tft.counters().bytes == 13 + 8 + 8 + 3);
+		assert(tft.getPixel(30, 40) == SCENE_BLUE && tft.getPixel(30, 41) == SCENE_BLUE);
+		assert(tft.getPixel(31, 41) == SCENE_BLUE && tft.getPixel(31, 40) == SCENE_RED);
+
+		tft.setRotation(0);
+		tft.resetCounters();
+		tft.drawPixel(31, 41, SCENE_GREEN);
+		tft.sendCommand(0x00); // NOP
+		tft.drawPixel(31, 41, SCENE_GREEN);
+		tft.readcommand8(0x09);
+		tft.drawPixel(31, 41, SCENE_GREEN);
+		assert(tft.counters().caset == 3 && tft.counters().paset == 3);
+		assert(tft.getPixel(31, 41) == SCENE_GREEN);
+	}
+
+	{
+		// A command waits for pixels the DMA is still sending, so they
+		// arrive as data instead of being read as command bytes
+		static uint16_t row[64];
+		for (int i = 0; i < 64; i++) {
+			row[i] = (uint16_t)(i * 2654435761u >> 16);
+		}
+		SPI.deferDMA = true;
+		tft.startWrite();
+		tft.setAddrWindow(10, 200, 64, 1);
+		tft.writePixels(row, 64, false);
+		tft.setAddrWindow(10, 201, 64, 1);
+		tft.writePixels(row, 64, false);
+		tft.endWrite();
+		SPI.deferDMA = false;
+		for (int16_t x = 0; x < 64; x++) {
+			assert(tft.getPixel(10 + x, 200) == row[x]);
+			assert(tft.getPixel(10 + x, 201) == row[x]);
+		}
+	}
+
+	{
+		// RGB bitmaps go out a row at a time through the DMA buffers, each
+		// row prepared while the one before is sent
+		static uint16_t bitmap[100 * 50];
+		for (int i = 0; i < 100 * 50; i++) {
+			bitmap[i] = (uint16_t)(i * 2654435761u >> 16);
+		}
+		tft.resetCounters();
+		tft.drawRGBBitmap(-10, 300, bitmap, 100, 50);
+		assert(tft.counters().pixels == 90 * 20);
+		assert(SPI.dmaTransfers == 20);
+		for (int16_t y = 0; y < 20; y++) {
+			for (int16_t x = 0; x < 90; x++) {
+				assert(tft.getPixel(x, 300 + y) == bitmap[y * 100 + x + 10]);
+			}
+		}
+	}
+
+	{
+		// Run-length encoded images, as colors and as 8- and 4-bit palette
+		// indexes, match the raw pixels anywhere on or partly off the
+		// display, on the display (one window) and on a canvas (lines and
+		// pixels); a solid image is one window of a single color burst
+		static const uint16_t palette[16] = {
+			SCENE_BLACK, SCENE_BLUE, SCENE_RED, SCENE_GREEN, SCENE_CYAN, SCENE_MAGENTA, SCENE_YELLOW, SCENE_WHITE,
+			0x1234, 0x2345, 0x3456, 0x4567, 0x5678, 0x6789, 0x789A, 0x89AB
+		};
+		static uint16_t pixels[37 * 23];
+		uint32_t seed = 7;
+		for (int i = 0; i < 37 * 23; i++) {
+			seed = seed * 1103515245 + 12345;
+			int x = i % 37, y = i / 37;
+			pixels[i] = (x < 12) ? palette[y & 3] : ((y > 15) ? palette[9] : palette[(seed >> 16) & 15]);
+		}
+		static const int16_t where[][2] = { { 10, 10 }, { -5, 3 }, { 3, -7 }, { 220, 300 }, { -36, -22 }, { 240, 0 } };
+		for (uint8_t bits = 4; bits <= 16; bits *= 2) {
+			std::vector<uint8_t> data = encodeImage(pixels, 37 * 23, palette, bits);
+			assert(data.size() < 37 * 23 * 2);
+			GFXrleImage image = { data.data(), (bits == 16) ? NULL : palette, 37, 23, bits };
+			for (size_t i = 0; i < sizeof(where) / sizeof(where[0]); i++) {
+				tft.fillScreen(SCENE_BLACK);
+				canvas.fillScreen(SCENE_BLACK);
+				tft.resetCounters();
+				tft.drawRLEImage(where[i][0], where[i][1], &image);
+				assert(tft.counters().addrWindows == ((i < 5) ? 1 : 0));
+				canvas.drawRGBBitmap(where[i][0], where[i][1], pixels, 37, 23);
+				assertSameAsCanvas("drawRLEImage", 0);
+
+				tft.fillScreen(SCENE_BLACK);
+				canvas.fillScreen(SCENE_BLACK);
+				tft.drawRGBBitmap(where[i][0], where[i][1], pixels, 37, 23);
+				canvas.drawRLEImage(where[i][0], where[i][1], &image);
+				assertSameAsCanvas("drawRLEImage on canvas", 0);
+			}
+		}
+
+		static uint16_t solid[100 * 100];
+		for (int i = 0; i < 100 * 100; i++) solid[i] = SCENE_MAGENTA;
+		std::vector<uint8_t> data = encodeImage(solid, 100 * 100, palette, 4);
+		assert(data.size() == (100 * 100 + 127) / 128 * 2);
+		GFXrleImage image = { data.data(), palette, 100, 100, 4 };
+		tft.resetCounters();
+		tft.drawRLEImage(50, 50, &image);
+		assert(tft.counters().addrWindows == 1);
+		assert(tft.counters().bytes == 11 + 100 * 100 * 2);
+		assert(SPI.dmaTransfers < 100 * 100 / 128);
+		assert(tft.getPixel(50, 50) == SCENE_MAGENTA && tft.getPixel(149, 149) == SCENE_MAGENTA);
+		assert(tft.getPixel(49, 50) == SCENE_BLACK && tft.getPixel(150, 149) == SCENE_BLACK);
+	}
+
+	{
+		// BMP and raw files drawn as they are read match the pixels anywhere
+		// on or partly off the display and on a canvas, however the reads
+		// split the file, also with each span's DMA still going when the next
+		// window is set; top-down and raw files take about a window per chunk and
+		// bottom-up ones a window per row; short files fail
+		static uint8_t  rgb[53 * 31 * 3];
+		static uint16_t pixels[53 * 31];
+		uint32_t seed = 11;
+		for (int i = 0; i < 53 * 31; i++) {
+			for (int j = 0; j < 3; j++) {
+				seed = seed * 1103515245 + 12345;
+				rgb[i * 3 + j] = seed >> 16;
+			}
+			pixels[i] = ((rgb[i * 3] & 0xF8) << 8) | ((rgb[i * 3 + 1] & 0xFC) << 3) | (rgb[i * 3 + 2] >> 3);
+		}
+		std::vector<uint8_t> files[6] = { makeBMP(rgb, 53, 31, 3, false), makeBMP(rgb, 53, 31, 4, false),
+		                                  makeBMP(rgb, 53, 31, 3, true), makeBMP(rgb, 53, 31, 4, true) };
+		for (int i = 0; i < 53 * 31; i++) {
+			files[4].push_back(pixels[i] & 0xFF);
+			files[4].push_back(pixels[i] >> 8);
+			files[5].push_back(pixels[i] >> 8);
+			files[5].push_back(pixels[i] & 0xFF);
+		}
+		static GFXimageLoader tftLoader(tft), canvasLoader(canvas);
+		static const int16_t where[][2] = { { 10, 10 }, { -5, 3 }, { 3, -7 }, { 220, 300 }, { -52, -30 }, { 240, 0 } };
+		static const size_t steps[] = { 4096, 512, 77, 1 };
+		for (int f = 0; f < 6; f++) {
+			for (size_t i = 0; i < sizeof(where) / sizeof(where[0]); i++) {
+				for (size_t s = 0; s < sizeof(steps) / sizeof(steps[0]); s++) {
+					MemoryFile file(files[f], steps[s]);
+					tft.fillScreen(SCENE_BLACK);
+					canvas.fillScreen(SCENE_BLACK);
+					tft.resetCounters();
+					SPI.deferDMA = (s & 1);
+					assert((f < 4) ? tftLoader.drawBMP(file, where[i][0], where[i][1]) :
+					                 tftLoader.drawRaw(file, where[i][0], where[i][1], 53, 31, f == 5));
+					SPI.deferDMA = false;
+					if ((i == 0) && (s == 1)) {
+						uint32_t chunks = files[f].size() / 512 + 1; // Plus up to one window per row split
+						assert(tft.counters().addrWindows <= ((f < 2) ? 31 + chunks : 2 * chunks));
+					}
+					canvas.drawRGBBitmap(where[i][0], where[i][1], pixels, 53, 31);
+					assertSameAsCanvas("GFXimageLoader", 0);
+				}
+
+				MemoryFile file(files[f], 100);
+				tft.fillScreen(SCENE_BLACK);
+				canvas.fillScreen(SCENE_BLACK);
+				tft.drawRGBBitmap(where[i][0], where[i][1], pixels, 53, 31);
+				assert((f < 4) ? canvasLoader.drawBMP(file, where[i][0], where[i][1]) :
+				                 canvasLoader.drawRaw(file, where[i][0], where[i][1], 53, 31, f == 5));
+				assertSameAsCanvas("GFXimageLoader on canvas", 0);
+			}
+			std::vector<uint8_t> cut(files[f].begin(), files[f].end() - 5);
+			MemoryFile file(cut, 512);
+			assert(!((f < 4) ? tftLoader.drawBMP(file, 0, 0) : tftLoader.drawRaw(file, 0, 0, 53, 31)));
+		}
+		MemoryFile notBMP(files[4], 512);
+		assert(!tftLoader.drawBMP(notBMP, 0, 0));
+	}
+
+	{
+		// Sprites with a key color and with a mask, moving over a canvas
+		// background, partly off the display, overlapping, changing frame
+		// and hidden, match drawing the whole picture; a move sends only
+		// the old and new rectangles, merged when they overlap, however
+		// small the scratch canvas, and whether or not the DMA keeps up
+		static GFXcanvas16 back(240, 320);
+		for (int16_t y = 0; y < 320; y += 10) {
+			back.fillRect(0, y, 240, 10, (y & 16) ? SCENE_CYAN : SCENE_MAGENTA);
+		}
+		back.fillCircle(120, 160, 50, SCENE_YELLOW);
+		static uint16_t walk[2][20 * 16], feet[13 * 11];
+		static uint8_t  mask[2 * 11];
+		for (int i = 0; i < 20 * 16; i++) {
+			walk[0][i] = ((i % 20) < 3 || (i / 20) == 7) ? SCENE_BLACK : SCENE_RED;
+			walk[1][i] = ((i * 7) % 5 == 0) ? SCENE_BLACK : SCENE_BLUE;
+		}
+		for (int i = 0; i < 13 * 11; i++) feet[i] = 0x1234 + i;
+		for (int i = 0; i < 2 * 11; i++) mask[i] = 0x5A ^ (i * 29);
+		static const int16_t moves[][4] = {
+			{ 10, 10, 50, 60 }, { 12, 11, 51, 62 }, { 40, 20, 45, 25 }, { -10, -5, 230, 310 },
+			{ 200, 300, -8, 100 }, { 100, 100, 104, 108 }, { 100, 100, 104, 108 }, { 0, 0, 0, 0 }
+		};
+		for (uint16_t scratch = 8; scratch <= 64; scratch *= 8) {
+			GFXcompositor comp(tft, scratch, scratch / 2);
+			comp.setBackground(&back);
+			int8_t a = comp.addSprite(walk[0], 20, 16, SCENE_BLACK), b = comp.addSprite(feet, mask, 13, 11);
+			assert((a == 0) && (b == 1));
+			for (size_t m = 0; m < sizeof(moves) / sizeof(moves[0]); m++) {
+				comp.moveSprite(a, moves[m][0], moves[m][1]);
+				comp.moveSprite(b, moves[m][2], moves[m][3]);
+				comp.setBitmap(a, walk[m & 1]);
+				comp.showSprite(b, m != 6);
+				tft.resetCounters();
+				SPI.deferDMA = (m & 1);
+				uint8_t rects = comp.update();
+				SPI.deferDMA = false;
+				if (m == 1) {
+					// Both moved a little: two rectangles, each old and new together
+					assert(rects == 2);
+					assert(tft.counters().pixels == 22 * 17 + 14 * 13);
+				}
+				if (m == 2) assert(rects == 3); // Walk left one alone, feet moved onto it
+				memcpy(canvas.getBuffer(), back.getBuffer(), 240 * 320 * 2);
+				for (int i = 0; i < 20 * 16; i++) {
+					if (walk[m & 1][i] != SCENE_BLACK) canvas.drawPixel(moves[m][0] + i % 20, moves[m][1] + i / 20, walk[m & 1][i]);
+				}
+				if (m != 6) canvas.drawRGBBitmap(moves[m][2], moves[m][3], feet, mask, 13, 11);
+				assertSameAsCanvas("GFXcompositor", 0);
+			}
+			tft.resetCounters();
+			assert(comp.update() == 0 && tft.counters().bytes == 0);
+			comp.setBackground(SCENE_GREEN);
+			comp.redraw();
+			assert(tft.getPixel(239, 319) == SCENE_GREEN && tft.getPixel(16, 12) == walk[1][12 * 20 + 16]);
+		}
+	}
+
+	{
+		// Tile maps at 1x and 2x match drawing every cell as a bitmap;
+		// building the next screen from a cleared grid sends only the
+		// cells that differ, and nothing at all when none do, whether or
+		// not the DMA keeps up
+		static GFXtileSet font;
+		assert(GFXtileMap::makeTextTiles(&font, 8, ' ', 95));
+		assert(!GFXtileMap::makeTextTiles(&font, 8, ' ', 95, 2) && (font.size == 8));
+		static const char *screens[][2] = {
+			{ "Time to try to use\nthe restroom!", "10:41" },
+			{ "Time to try to use\nthe kitchen!", "10:42" },
+			{ "Are your feet up?", "10:42" }
+		};
+		for (uint8_t scale = 1; scale <= 2; scale++) {
+			uint16_t cols = 240 / (8 * scale), rows = 320 / (8 * scale), cs = 8 * scale;
+			GFXtileMap map(tft, &font, cols, rows, scale);
+			for (size_t s = 0; s < 3; s++) {
+				uint16_t color = (s == 2) ? SCENE_GREEN : SCENE_YELLOW;
+				map.clear(SCENE_BLACK);
+				map.print(1, 2, screens[s][0], color, SCENE_BLACK);
+				map.print(0, rows - 1, screens[s][1], SCENE_WHITE, SCENE_BLUE);
+				map.fill(cols - 3, 0, 3, 3, '#' - ' ', SCENE_RED, SCENE_CYAN);
+				tft.resetCounters();
+				SPI.deferDMA = (s & 1);
+				uint16_t sent = map.flush();
+				SPI.deferDMA = false;
+				if (s == 0) assert(sent == cols * rows);
+				if (s == 1) assert(sent == 9 + 1); // "restroom!" to "kitchen!", "1" to "2"
+				assert(tft.counters().pixels == (uint32_t)sent * cs * cs);
+
+				canvas.fillScreen(SCENE_BLACK);
+				uint16_t c = 1, r = 2;
+				for (const char *t = screens[s][0]; *t; t++) {
+					if (*t == '\n') {
+						c = 1;
+						r++;
+					} else {
+						canvas.drawBitmap(c * 8, r * 8, &font.bitmap[(*t - ' ') * 8], 8, 8, color, SCENE_BLACK);
+						c++;
+					}
+				}
+				for (const char *t = screens[s][1]; *t; t++) {
+					canvas.drawBitmap((t - screens[s][1]) * 8, (rows - 1) * 8, &font.bitmap[(*t - ' ') * 8], 8, 8, SCENE_WHITE, SCENE_BLUE);
+				}
+				for (int i = 0; i < 9; i++) {
+					canvas.drawBitmap((cols - 3 + i % 3) * 8, (i / 3) * 8, &font.bitmap[('#' - ' ') * 8], 8, 8, SCENE_RED, SCENE_CYAN);
+				}
+				if (scale == 2) {
+					// The reference at 1x, then each pixel doubled from the top left quarter
+					for (int16_t y = 319; y >= 0; y--) {
+						for (int16_t x = 239; x >= 0; x--) {
+							canvas.drawPixel(x, y, canvas.getBuffer()[(y / 2) * 240 + x / 2]);
+						}
+					}
+				}
+				assertSameAsCanvas("GFXtileMap", 0);
+			}
+			tft.resetCounters();
+			map.print(1, 2, "A", SCENE_GREEN, SCENE_BLACK);
+			assert(map.flush() == 0 && tft.counters().bytes == 0);
+			map.clear(SCENE_MAGENTA);
+			tft.resetCounters();
+			assert(map.flush() == cols * rows);
+			assert(tft.counters().pixels == 240 * 320 && tft.counters().ramwr == rows); // A fill per row
+		}
+	}
+
+	{
+		// Widgets changed one step at a time match the same widgets painted
+		// from scratch on a canvas, and each step repaints only the widgets
+		// that changed and those they uncovered or overlap
+		struct Ui {
+			GFXlabel       time, date, message;
+			GFXicon        icon;
+			GFXprogressBar bar;
+			GFXbutton      button;
+			GFXscreen      screen;
+			Ui(Adafruit_GFX &gfx, const uint16_t *bitmap) :
+				time(0, 0, "10:41:00", SCENE_YELLOW), date(0, 24, "10/18/26", SCENE_YELLOW),
+				message(0, 100, "Time to try to use\nthe restroom!", SCENE_GREEN),
+				icon(200, 60, bitmap, 16, 16), bar(10, 280, 200, 12, SCENE_CYAN),
+				button(150, 200, 80, 40, "OK", SCENE_WHITE, SCENE_BLUE, SCENE_WHITE, 2),
+				screen(gfx, SCENE_BLACK) {
+				time.setTextSize(3);
+				date.setTextSize(3);
+				screen.add(icon);
+				screen.add(time);
+				screen.add(date);
+				screen.add(message);
+				screen.add(bar);
+				screen.add(button);
+			}
+			void step(int s) {
+				switch (s) {
+				case 1: time.setText("10:41:01"); break;
+				case 2: message.setText("Are your feet up?"); message.setColor(SCENE_RED, SCENE_MAGENTA); break;
+				case 3: bar.setValue(40); break;
+				case 4: message.setAlphaFont(&FreeMono18pt4a); message.moveTo(0, 140); break;
+				case 5: date.moveTo(150, 55); break; // Over the icon
+				case 6: button.press(true); break;
+				case 7: date.show(false); break;
+				case 8: screen.remove(button); break;
+				case 9: message.show(false); time.moveTo(0, 296); break;
+				}
+			}
+		};
+		static uint16_t bitmap[16 * 16];
+		for (int i = 0; i < 16 * 16; i++) {
+			bitmap[i] = (uint16_t)(i * 0x0821);
+		}
+		// The date moved over the icon is drawn on top of it, and hiding the
+		// date repaints the icon it uncovers
+		static const uint8_t painted[] = { 6, 1, 1, 1, 1, 1, 1, 1, 0, 1 };
+		Ui ui(tft, bitmap);
+		for (int s = 0; s < 10; s++) {
+			tft.resetCounters();
+			ui.step(s);
+			assert(ui.screen.render() == painted[s]);
+			if (s == 1) assert(tft.counters().pixels == 8 * 18 * 24); // Just the time
+			if (s == 3) assert(tft.counters().pixels <= 200 * 12 + 4); // drawRect() sends its corners twice
+			if (s == 8) assert(tft.counters().pixels == 80 * 40);     // Cleared by remove()
+			Ui ref(canvas, bitmap);
+			for (int r = 1; r <= s; r++) {
+				ref.step(r);
+			}
+			ref.screen.render();
+			assertSameAsCanvas("GFXscreen", 0);
+		}
+		tft.resetCounters();
+		assert(ui.screen.render() == 0 && tft.counters().bytes == 0);
+		ui.time.setText("10:41:01");
+		ui.bar.setValue(40);
+		assert(ui.screen.render() == 0 && tft.counters().bytes == 0);
+		ui.message.setAlphaFont(NULL);
+		ui.message.setFont(NULL); // Not ambiguous
+		tft.setTextWrap(true);
+		canvas.setTextWrap(true);
+	}
+
+	{
+		// Every reminder CapstoneCode shows fits across the display at its
+		// rotation, and above the time and date along the bottom
+		struct Label : GFXlabel {
+			Label(const char *text) : GFXlabel(0, 0, text) {}
+			using GFXlabel::getBounds;
+		};
+		static const struct {
+			const char         *text;
+			const GFXalphaFont *font;
+			int16_t             y;
+		} reminders[] = {
+			{ REMIND_PEE_TEXT, &FreeMono18pt4a, 24 },       { REMIND_FEET_UP_TEXT, &FreeMono18pt4a, 24 },
+			{ REMIND_MOVE_TEXT, &FreeMono18pt4a, 24 },      { REMIND_BREAKFAST_TEXT, &FreeMono18pt4a, 24 },
+			{ REMIND_LUNCH_TEXT, &FreeMono18pt4a, 24 },     { REMIND_WIND_DOWN_TEXT, &FreeMono18pt4a, 24 },
+			{ REMIND_DISHES_TEXT, &FreeMono12pt4a, 16 }
+		};
+		tft.setRotation(1);
+		for (size_t r = 0; r < sizeof(reminders) / sizeof(reminders[0]); r++) {
+			Label label(reminders[r].text);
+			label.setAlphaFont(reminders[r].font);
+			label.moveTo(0, reminders[r].y);
+			int16_t  x1, y1;
+			uint16_t w, h;
+			label.getBounds(tft, &x1, &y1, &w, &h);
+			assert((x1 >= 0) && (x1 + w <= tft.width()));
+			assert((y1 >= 0) && (y1 + h <= tft.height() - 48));
+		}
+		tft.setRotation(0);
+	}
+
+	{
+		// Calibration finds the fastest clocks the panel keeps up with,
+		// uses a step below each, and hands back something setBusSpeed()
+		// takes next boot
+		SPITFT_BusSpeed speed;
+		tft.panel.writeLimit = 40000000;
+		tft.panel.readLimit  = 12000000;
+		assert(tft.calibrateSPI(&speed));
+		assert(speed.writeFreq == 32000000 && speed.readFreq == 8000000);
+		tft.fillRect(0, 0, 10, 10, SCENE_RED);
+		assert(tft.panel.clock == 32000000);
+		tft.readcommand8(0x09);
+		assert(tft.panel.clock == 8000000);
+
+		tft.setSPISpeed(16000000, SPITFT_READ_SAFE);
+		assert(tft.setBusSpeed(speed));
+		tft.fillRect(0, 0, 10, 10, SCENE_RED);
+		assert(tft.panel.clock == 32000000);
+		speed.magic = 0xFFFFFFFF; // Blank EEPROM
+		assert(!tft.setBusSpeed(speed));
+
+		// Nothing reads back (no MISO): no clocks found, the old ones kept
+		tft.panel.readLimit = 1;
+		assert(!tft.calibrateSPI(&speed));
+		tft.fillRect(0, 0, 10, 10, SCENE_RED);
+		assert(tft.panel.clock == 32000000);
+
+		tft.panel.writeLimit = tft.panel.readLimit = 0;
+		assert(tft.calibrateSPI(&speed) && (speed.writeFreq == 60000000)); // A step below SPITFT_CALIBRATE_MAX
+		tft.setSPISpeed(32000000, SPITFT_READ_SAFE);
+	}
+
+	{
+		// Pixels read back are the ones drawn, 0 off the display, and a
+		// screenshot loads back as the same screen, read a chunk per
+		// transaction
+		for (uint8_t rot = 0; rot < 4; rot += 3) {
+			tft.setRotation(rot);
+			canvas.setRotation(rot);
+			for (int i = 0; i < 40; i++) {
+				tft.fillRect((i * 37) % 300, (i * 53) % 300, 10 + i * 3, 5 + i * 2, (uint16_t)(i * 0x1F39 + 7));
+			}
+			uint16_t pixels[20 * 10];
+			tft.readPixels(-5, tft.height() - 4, 20, 10, pixels);
+			for (int16_t y = 0; y < 10; y++) {
+				for (int16_t x = 0; x < 20; x++) {
+					bool on = (x >= 5) && (y < 4);
+					assert(pixels[y * 20 + x] == (on ? tft.getPixel(x - 5, tft.height() - 4 + y) : 0));
+				}
+			}
+
+			MemoryPrint shot;
+			tft.resetCounters();
+			assert(tft.writeScreenshot(shot));
+			uint16_t w = tft.width(), h = tft.height();
+			assert(shot.data.size() == 54 + (size_t)w * h * 3);
+			assert(tft.counters().transactions == 2u * h * ((w + SPITFT_SHOT_CHUNK - 1) / SPITFT_SHOT_CHUNK));
+			GFXimageLoader loader(canvas);
+			MemoryFile file(shot.data, 4096);
+			canvas.fillScreen(SCENE_BLACK);
+			assert(loader.drawBMP(file, 0, 0));
+			assertSameAsCanvas("writeScreenshot", rot);
+
+			MemoryPrint full(1000); // Card full
+			assert(!tft.writeScreenshot(full));
+		}
+		tft.setRotation(0);
+		canvas.setRotation(0);
+	}
+
+	{
+		// The 565 kernels match a pixel at a time at any alignment and
+		// length, as do canvas fills and copies at any rotation
+		uint16_t src[48], dst[48], want[48];
+		for (int i = 0; i < 48; i++) src[i] = (uint16_t)(i * 0x9E37 + 0x1234);
+		src[5] = src[6] = src[17] = src[30] = SCENE_RED;
+		for (uint32_t off = 0; off < 4; off++) {
+			for (uint32_t n = 0; n <= 40; n++) {
+				for (int i = 0; i < 48; i++) dst[i] = want[i] = (uint16_t)(i * 0x3B1);
+				gfx565Fill(dst + off, SCENE_BLUE, n);
+				for (uint32_t i = 0; i < n; i++) want[off + i] = SCENE_BLUE;
+				assert(!memcmp(dst, want, sizeof(dst)));
+				gfx565Fill(dst + off, 0xA5A5, n);
+				for (uint32_t i = 0; i < n; i++) want[off + i] = 0xA5A5;
+				assert(!memcmp(dst, want, sizeof(dst)));
+
+				gfx565CopyKey(dst + off, src + 3, n, SCENE_RED);
+				for (uint32_t i = 0; i < n; i++) {
+					if (src[3 + i] != SCENE_RED) want[off + i] = src[3 + i];
+				}
+				assert(!memcmp(dst, want, sizeof(dst)));
+
+				gfx565Swap(dst + off, src + 1, n);
+				for (uint32_t i = 0; i < n; i++) want[off + i] = (src[1 + i] << 8) | (src[1 + i] >> 8);
+				assert(!memcmp(dst, want, sizeof(dst)));
+
+				gfx565Blend(dst + off, src + 2, n);
+				for (uint32_t i = 0; i < n; i++) {
+					uint16_t a = want[off + i], b = src[2 + i];
+					want[off + i] = (((a >> 11) + (b >> 11)) / 2) << 11 |
+					                (((a >> 5 & 0x3F) + (b >> 5 & 0x3F)) / 2) << 5 |
+					                ((a & 0x1F) + (b & 0x1F)) / 2;
+				}
+				assert(!memcmp(dst, want, sizeof(dst)));
+			}
+		}
+
+		GFXcanvas16 fast(37, 23), slow(37, 23), sprite(13, 9);
+		for (int16_t y = 0; y < 9; y++) {
+			for (int16_t x = 0; x < 13; x++) {
+				sprite.drawPixel(x, y, ((x + y) % 3) ? (uint16_t)(x * 0x841 + y * 0x1F) : SCENE_RED);
+			}
+		}
+		static const int16_t rects[][4] = {
+			{ 0, 0, 37, 37 }, { 3, 2, 5, 7 }, { -4, -3, 9, 8 }, { 30, 15, 20, 20 },
+			{ 10, 10, -6, -4 }, { 5, 5, 0, 3 }, { 0, 4, 100, 1 }, { 2, 0, 1, 100 },
+		};
+		for (uint8_t rot = 0; rot < 4; rot++) {
+			fast.setRotation(rot);
+			slow.setRotation(rot);
+			for (size_t r = 0; r < sizeof(rects) / sizeof(rects[0]); r++) {
+				uint16_t color = (uint16_t)(r * 0x2945 + 1);
+				fast.fillRect(rects[r][0], rects[r][1], rects[r][2], rects[r][3], color);
+				int16_t x = rects[r][0], y = rects[r][1], w = rects[r][2], h = rects[r][3];
+				if (w < 0) { x += w + 1; w = -w; }
+				if (h < 0) { y += h + 1; h = -h; }
+				for (int16_t j = y; j < y + h; j++) {
+					for (int16_t i = x; i < x + w; i++) slow.drawPixel(i, j, color);
+				}
+				assert(!memcmp(fast.getBuffer(), slow.getBuffer(), 37 * 23 * 2));
+			}
+			static const int16_t at[][2] = { { 0, 0 }, { 5, 3 }, { -4, -2 }, { 30, 18 } };
+			for (size_t a = 0; a < sizeof(at) / sizeof(at[0]); a++) {
+				for (uint8_t mode = 0; mode < 3; mode++) {
+					if (mode == 0) fast.drawCanvas(at[a][0], at[a][1], sprite);
+					if (mode == 1) fast.drawCanvas(at[a][0], at[a][1], sprite, SCENE_RED);
+					if (mode == 2) fast.blendCanvas(at[a][0], at[a][1], sprite);
+					for (int16_t y = 0; y < 9; y++) {
+						for (int16_t x = 0; x < 13; x++) {
+							int16_t px = at[a][0] + x, py = at[a][1] + y;
+							if (px < 0 || py < 0 || px >= slow.width() || py >= slow.height()) continue;
+							uint16_t c = sprite.getBuffer()[y * 13 + x];
+							if (mode == 1 && c == SCENE_RED) continue;
+							if (mode == 2) {
+								int16_t bx = px, by = py; // As GFXcanvas16::drawPixel() stores it
+								if (rot == 1) { bx = 36 - py; by = px; }
+								if (rot == 2) { bx = 36 - px; by = 22 - py; }
+								if (rot == 3) { bx = py; by = 22 - px; }
+								c = gfx565Average(slow.getBuffer()[by * 37 + bx], c);
+							}
+							slow.drawPixel(px, py, c);
+						}
+					}
+					assert(!memcmp(fast.getBuffer(), slow.getBuffer(), 37 * 23 * 2));
+				}
+			}
+		}
+
+		// Bulk drawing on a dirty canvas still marks what it changed
+		GFXcanvas16Dirty dirty(40, 30);
+		dirty.flush(tft);
+		dirty.fillRect(3, 4, 5, 6, SCENE_RED);
+		dirty.drawCanvas(20, 20, sprite);
+		assert(dirty.dirtyCount() > 0);
+		tft.resetCounters();
+		dirty.flush(tft);
+		assert(tft.counters().pixels > 0 && tft.counters().pixels < 40 * 30);
+		for (int16_t y = 0; y < 30; y++) {
+			for (int16_t x = 0; x < 40; x++) {
+				assert(tft.getPixel(x, y) == dirty.getBuffer()[x + y * 40]);
+			}
+		}
+	}
+
+	{
+		// Canvas pixels land where they always did at every rotation, and
+		// fast lines, clipped or drawn backwards, match them pixel for pixel
+		static const int16_t lines[][3] = {
+			{ 0, 0, 40 }, { 3, 2, 1 }, { -5, 4, 12 }, { 18, 7, -9 }, { 19, 12, 30 },
+			{ 7, -1, 5 }, { 2, 25, 3 }, { 9, 5, 0 }, { 1, 3, 9 }, { 12, 8, -40 },
+		};
+		GFXcanvas1  one(21, 13), oneRef(21, 13);
+		GFXcanvas8  eight(21, 13), eightRef(21, 13);
+		GFXcanvas16 sixteen(21, 13), sixteenRef(21, 13);
+		for (uint8_t rot = 0; rot < 4; rot++) {
+			one.setRotation(rot);
+			oneRef.setRotation(rot);
+			eight.setRotation(rot);
+			eightRef.setRotation(rot);
+			sixteen.setRotation(rot);
+			sixteenRef.setRotation(rot);
+			sixteen.fillScreen(0);
+			for (int16_t y = 0; y < sixteen.height(); y++) {
+				for (int16_t x = 0; x < sixteen.width(); x++) {
+					int16_t bx = x, by = y;
+					if (rot == 1) { bx = 20 - y; by = x; }
+					if (rot == 2) { bx = 20 - x; by = 12 - y; }
+					if (rot == 3) { bx = y; by = 12 - x; }
+					sixteen.drawPixel(x, y, 1 + x + y * 32);
+					assert(sixteen.getBuffer()[bx + by * 21] == 1 + x + y * 32);
+					one.fillScreen(0);
+					one.drawPixel(x, y, 1);
+					assert(one.getBuffer()[bx / 8 + by * 3] == 0x80 >> (bx & 7));
+				}
+			}
+			sixteen.fillScreen(0);
+			sixteenRef.fillScreen(0);
+
+			for (size_t l = 0; l < sizeof(lines) / sizeof(lines[0]); l++) {
+				int16_t x = lines[l][0], y = lines[l][1], n = lines[l][2];
+				uint16_t color = (uint16_t)(l * 0x1357 + 1);
+				one.fillScreen(l & 1);
+				oneRef.fillScreen(l & 1);
+				for (uint8_t vertical = 0; vertical < 2; vertical++) {
+					if (vertical) {
+						one.drawFastVLine(x, y, n, !(l & 1));
+						eight.writeFastVLine(x, y, n, color);
+						sixteen.drawFastVLine(x, y, n, color);
+					} else {
+						one.writeFastHLine(x, y, n, !(l & 1));
+						eight.writeFastHLine(x, y, n, color);
+						sixteen.drawFastHLine(x, y, n, color);
+					}
+					int16_t a = (n < 0) ? n + 1 : 0, b = (n < 0) ? 1 : n;
+					for (int16_t i = a; i < b; i++) {
+						int16_t px = vertical ? x : x + i, py = vertical ? y + i : y;
+						oneRef.drawPixel(px, py, !(l & 1));
+						eightRef.drawPixel(px, py, color);
+						sixteenRef.drawPixel(px, py, color);
+					}
+					assert(!memcmp(one.getBuffer(), oneRef.getBuffer(), 3 * 13));
+					assert(!memcmp(eight.getBuffer(), eightRef.getBuffer(), 21 * 13));
+					assert(!memcmp(sixteen.getBuffer(), sixteenRef.getBuffer(), 21 * 13 * 2));
+				}
+			}
+		}
+	}
+
+	{
+		// A palette canvas shows on the display in its palette's colors,
+		// and only the rows drawn on since the last flush are sent again
+		tft.setRotation(0);
+		GFXcanvas8Palette pal(200, 50);
+		assert(pal.getPalette()[GFXcanvas8Palette::color332(SCENE_WHITE)] == SCENE_WHITE);
+		assert(pal.getPalette()[GFXcanvas8Palette::color332(SCENE_RED)] == SCENE_RED);
+		assert(pal.getPalette()[GFXcanvas8Palette::color332(SCENE_BLACK)] == SCENE_BLACK);
+		pal.fillScreen(3);
+		pal.fillCircle(40, 25, 20, 200);
+		pal.setCursor(80, 10);
+		pal.setTextColor(17);
+		pal.print("Palette");
+		tft.resetCounters();
+		assert(pal.flush(tft, 20, 30) == 200 * 50);
+		assert(tft.counters().addrWindows == 1);
+		for (int16_t y = 0; y < 50; y++) {
+			for (int16_t x = 0; x < 200; x++) {
+				assert(tft.getPixel(20 + x, 30 + y) == pal.getPalette()[pal.getBuffer()[x + y * 200]]);
+			}
+		}
+		tft.resetCounters();
+		assert(pal.flush(tft, 20, 30) == 0);
+		assert(tft.counters().bytes == 0);
+
+		pal.drawFastHLine(-10, 7, 300, 9);
+		pal.drawPixel(5, 9, 9);
+		pal.drawFastVLine(150, 20, -3, 9);
+		pal.drawFastVLine(150, 60, 3, 9); // Off the canvas
+		tft.resetCounters();
+		assert(pal.flush(tft, 20, 30) == 200 * 5);
+		assert(tft.counters().addrWindows == 3);
+		assert(tft.getPixel(20, 37) == pal.getPalette()[9]);
+		assert(tft.getPixel(170, 48) == pal.getPalette()[9]);
+
+		// Rotated, a horizontal line crosses rows
+		pal.setRotation(1);
+		pal.drawFastHLine(10, 100, 5, 9);
+		pal.setRotation(0);
+		tft.resetCounters();
+		assert(pal.flush(tft, 20, 30) == 200 * 5);
+
+		static const uint16_t grays[] = { SCENE_BLACK, 0x8410, SCENE_WHITE };
+		pal.setPalette(grays, 3, 200);
+		pal.setPaletteColor(17, SCENE_RED);
+		assert(pal.getPalette()[201] == 0x8410);
+		tft.resetCounters();
+		assert(pal.flush(tft, tft.width() - 100, -10) == 100 * 40); // Clipped
+		assert(tft.getPixel(tft.width() - 100 + 40, 15) == SCENE_BLACK);
+	}
+
+	{
+		// 1-bit pixels expand to two colors from any bit, and a two-color
+		// canvas goes out in one window, then only the rows drawn on
+		uint8_t bits[8] = { 0x00, 0xFF, 0xA5, 0x3C, 0x81, 0xFF, 0x0F, 0x70 };
+		uint16_t px[64];
+		for (uint32_t first = 0; first < 20; first++) {
+			for (uint32_t n = 0; first + n <= 64; n++) {
+				for (int i = 0; i < 64; i++) px[i] = 0x1234;
+				gfx565Expand1(px, bits, first, n, SCENE_YELLOW, SCENE_BLUE);
+				for (uint32_t i = 0; i < 64; i++) {
+					uint32_t b = first + i;
+					assert(px[i] == ((i >= n) ? 0x1234 : (bits[b >> 3] & (0x80 >> (b & 7))) ? SCENE_YELLOW : SCENE_BLUE));
+				}
+			}
+		}
+
+		tft.setRotation(1);
+		GFXcanvas1Mono mono(301, 40, SCENE_WHITE, SCENE_BLUE);
+		mono.setCursor(3, 5);
+		mono.setTextColor(1);
+		mono.setTextSize(2);
+		mono.print("Take your pills");
+		mono.drawRect(0, 0, 301, 40, 1);
+		tft.resetCounters();
+		assert(mono.flush(tft, 10, 100) == 301 * 40);
+		assert(tft.counters().addrWindows == 1);
+		for (int16_t y = 0; y < 40; y++) {
+			for (int16_t x = 0; x < 301; x++) {
+				bool on = mono.getBuffer()[y * 38 + x / 8] & (0x80 >> (x & 7));
+				assert(tft.getPixel(10 + x, 100 + y) == (on ? SCENE_WHITE : SCENE_BLUE));
+			}
+		}
+		assert(mono.flush(tft, 10, 100) == 0);
+
+		mono.fillRect(50, 20, 30, 4, 0);
+		tft.resetCounters();
+		assert(mono.flush(tft, 10, 100) == 301 * 4);
+		assert(tft.counters().addrWindows == 1);
+		assert(tft.getPixel(60, 121) == SCENE_BLUE);
+		mono.setColors(SCENE_RED, SCENE_BLACK);
+		assert(mono.flush(tft, -20, 100) == 281 * 40); // Clipped
+		assert(tft.getPixel(0, 100) == SCENE_RED);
+
+		GFXcanvas1Mono always(16, 4, SCENE_WHITE, SCENE_BLACK, false);
+		assert(always.flush(tft) == 16 * 4);
+		assert(always.flush(tft) == 16 * 4);
+		tft.setRotation(0);
+	}
+
+	{
+		// A baked font draws the same pixels as the GFXfont it came from,
+		// and measures exactly the pixels it lights
+		GFXcanvas16 bitmapText(320, 100), runText(320, 100);
+		const char *text = "Take 2 pills,\nthen rest.";
+		for (uint8_t size = 1; size <= 2; size++) {
+			bitmapText.fillScreen(SCENE_BLACK);
+			runText.fillScreen(SCENE_BLACK);
+			bitmapText.setFont(&FreeMono9pt7b);
+			runText.setRunFont(&FreeMono9pt7bRuns);
+			bitmapText.setTextSize(size);
+			runText.setTextSize(size);
+			bitmapText.setCursor(3, 30);
+			runText.setCursor(3, 30);
+			bitmapText.print(text);
+			runText.print(text);
+			assert(!memcmp(bitmapText.getBuffer(), runText.getBuffer(), 320 * 100 * 2));
+			assert(runText.getCursorX() == bitmapText.getCursorX());
+			assert(runText.getCursorY() == bitmapText.getCursorY());
+
+			int16_t minx = 320, miny = 100, maxx = -1, maxy = -1;
+			for (int16_t y = 0; y < 100; y++) {
+				for (int16_t x = 0; x < 320; x++) {
+					if (runText.getBuffer()[y * 320 + x] != SCENE_BLACK) {
+						if(x < minx) minx = x;
+						if(x > maxx) maxx = x;
+						if(y < miny) miny = y;
+						if(y > maxy) maxy = y;
+					}
+				}
+			}
+			int16_t x1, y1;
+			uint16_t w, h;
+			runText.getTextBounds(text, 3, 30, &x1, &y1, &w, &h);
+			assert(x1 == minx && y1 == miny && w == maxx - minx + 1 && h == maxy - miny + 1);
+		}
+		runText.setFont();
+		runText.setTextSize(1);
+		runText.setCursor(0, 0);
+		runText.print("A");
+		assert(runText.getCursorX() == 6);
+	}
+
+	{
+		// Classic font characters match the font bit for bit at any size,
+		// opaque ones in a single address window, transparent ones in far
+		// fewer windows than lit pixels
+		static const uint8_t sizes[][2] = { { 1, 1 }, { 3, 3 }, { 2, 3 }, { 11, 2 } };
+		uint32_t lit = 0, litWindows = 0;
+		for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+			uint8_t sx = sizes[s][0], sy = sizes[s][1];
+			for (int c = 0; c < 255; c++) {
+				for (int opaque = 0; opaque < 2; opaque++) {
+					uint16_t bg = opaque ? SCENE_BLACK : SCENE_YELLOW;
+					tft.fillRect(9, 9, 6 * sx + 2, 8 * sy + 2, SCENE_BLUE);
+					tft.resetCounters();
+					tft.drawChar(10, 10, c, SCENE_YELLOW, bg, sx, sy);
+					if (opaque && (6 * sx <= 64)) {
+						assert(tft.counters().addrWindows == 1);
+					}
+					int index = (c >= 176) ? c + 1 : c; // cp437(false)
+					for (int16_t y = 9; y < 8 * sy + 11; y++) {
+						for (int16_t x = 9; x < 6 * sx + 11; x++) {
+							int i = (x - 10) / sx, j = (y - 10) / sy;
+							uint16_t expected = SCENE_BLUE;
+							if ((x >= 10) && (y >= 10) && (i < 6) && (j < 8)) {
+								bool on = (i < 5) && (font[index * 5 + i] & (1 << j));
+								expected = on ? SCENE_YELLOW : opaque ? bg : SCENE_BLUE;
+								if (on && !opaque) lit++;
+							}
+							assert(tft.getPixel(x, y) == expected);
+						}
+					}
+					if (!opaque) litWindows += tft.counters().addrWindows;
+				}
+			}
+		}
+		assert(litWindows * 4 < lit);
+	}
+
+	{
+		// GFXfont characters match the font bit for bit, drawn from scratch,
+		// from a cache, and from one too small for the font so it keeps
+		// evicting, and a cache hit sends exactly what a miss does
+		const GFXfont *f = &FreeMono9pt7b;
+		GFXglyphCache bigCache, smallCache(64);
+		GFXglyphCache *caches[3] = { NULL, &bigCache, &smallCache };
+		tft.setFont(f);
+		for (uint8_t s = 1; s <= 2; s++) {
+			for (int pass = 0; pass < 2; pass++) {
+				for (int k = 0; k < 3; k++) {
+					tft.setGlyphCache(caches[k]);
+					for (int c = f->first; c <= f->last; c++) {
+						GFXglyph *g = &f->glyph[c - f->first];
+						int16_t x0 = 60 + g->xOffset * s, y0 = 80 + g->yOffset * s;
+						tft.fillRect(x0 - 1, y0 - 1, g->width * s + 2, g->height * s + 2, SCENE_BLUE);
+						tft.resetCounters();
+						tft.drawChar(60, 80, c, SCENE_YELLOW, SCENE_YELLOW, s, s);
+						static uint32_t windows[256];
+						if (k == 0) windows[c] = tft.counters().addrWindows;
+						assert(tft.counters().addrWindows == windows[c]);
+						for (int16_t y = -1; y <= g->height * s; y++) {
+							for (int16_t x = -1; x <= g->width * s; x++) {
+								bool on = false;
+								if ((x >= 0) && (y >= 0) && (x < g->width * s) && (y < g->height * s)) {
+									uint16_t bit = (y / s) * g->width + x / s;
+									on = f->bitmap[g->bitmapOffset + bit / 8] & (0x80 >> (bit & 7));
+								}
+								assert(tft.getPixel(x0 + x, y0 + y) == (on ? SCENE_YELLOW : SCENE_BLUE));
+							}
+						}
+					}
+				}
+			}
+		}
+		assert(bigCache.used() <= GFX_GLYPH_CACHE);
+		assert(smallCache.used() <= 64);
+
+		// Clock digits: every character after the first time is a hit
+		// (space has no pixels, so is never drawn)
+		bigCache.clear();
+		tft.setGlyphCache(&bigCache);
+		for (int i = 0; i < 3; i++) {
+			tft.setCursor(10, 100);
+			tft.print("12:34:56 PM");
+		}
+		assert(bigCache.misses() == 9);
+		assert(bigCache.hits() == 3 * 10 - 9);
+		tft.setGlyphCache(NULL);
+		tft.setFont(NULL);
+	}
+
+	{
+		// Anti-aliased text: one window per glyph on the display, the same
+		// pixels as the per-pixel path a canvas takes, and alpha 0 and 15
+		// give exactly the background and text colors
+		const GFXalphaFont *f = &FreeMono18pt4a;
+		GFXalphaText tftText(tft, f), canvasText(canvas, f);
+		for (uint8_t rotation = 0; rotation < 4; rotation++) {
+			tft.setRotation(rotation);
+			canvas.setRotation(rotation);
+			tft.fillScreen(SCENE_BLACK);
+			canvas.fillScreen(SCENE_BLACK);
+			tftText.setTextColor(SCENE_YELLOW, SCENE_BLACK);
+			canvasText.setTextColor(SCENE_YELLOW, SCENE_BLACK);
+			tftText.setCursor(0, 30);
+			canvasText.setCursor(0, 30);
+			tft.resetCounters();
+			const char *msg = "Time to try to use\nthe restroom! ~{}@";
+			tftText.print(msg);
+			canvasText.print(msg);
+			assert(tftText.getCursorY() == canvasText.getCursorY());
+			assert(tft.counters().addrWindows == strlen(msg) - 7); // Not the 6 spaces or newline
+			tftText.drawChar(-5, tft.height() + 3, 'g'); // Clipped, a pixel at a time
+			canvasText.drawChar(-5, canvas.height() + 3, 'g');
+			assertSameAsCanvas("alpha text", rotation);
+		}
+		tft.setRotation(0);
+		canvas.setRotation(0);
+
+		tft.fillScreen(SCENE_BLUE);
+		tftText.setTextColor(SCENE_WHITE, SCENE_BLUE);
+		tftText.drawChar(50, 50, 'M');
+		const GFXglyph *g = &f->glyph['M' - f->first];
+		uint32_t n = 0;
+		for (int16_t y = 0; y < g->height; y++) {
+			for (int16_t x = 0; x < g->width; x++, n++) {
+				uint8_t a = f->bitmap[g->bitmapOffset + n / 2] >> ((n & 1) ? 0 : 4) & 0x0F;
+				uint16_t p = tft.getPixel(50 + g->xOffset + x, 50 + g->yOffset + y);
+				if (a == 0) assert(p == SCENE_BLUE);
+				if (a == 15) assert(p == SCENE_WHITE);
+				if (a && a < 15) assert(p != SCENE_BLUE && p != SCENE_WHITE);
+			}
+		}
+		assert(tftText.textWidth("abc") == 3 * g->xAdvance);
+	}
+
+	{
+		// Every scene drawn through a draw queue matches the canvas, and
+		// the ones that fit in the queue go out in one transaction
+		GFXdrawQueue queue(tft);
+		for (uint8_t rotation = 0; rotation < 4; rotation++) {
+			queue.setRotation(rotation);
+			canvas.setRotation(rotation);
+			assert(queue.width() == tft.width());
+			for (size_t ii = 0; ii < numScenes; ii++) {
+				tft.resetCounters();
+				scenes[ii].func(queue, clock);
+				queue.flush();
+				if (!strcmp(scenes[ii].name, "HorizVertLines") ||
+				    !strcmp(scenes[ii].name, "RectanglesOutline")) {
+					assert(tft.counters().transactions == 1);
+				}
+				scenes[ii].func(canvas, clock);
+				assertSameAsCanvas(scenes[ii].name, rotation);
+			}
+		}
+		queue.setRotation(0);
+		canvas.setRotation(0);
+
+		// Stacked lines of one color merge, and so do pixel runs
+		for (int16_t y = 10; y < 20; y++) queue.drawFastHLine(5, y, 30, SCENE_RED);
+		assert(queue.queued() == 1);
+		queue.drawLine(0, 100, 200, 110, SCENE_GREEN);
+		assert(queue.queued() == 1 + 11);
+		tft.resetCounters();
+		queue.flush();
+		assert(tft.counters().addrWindows == 12);
+
+		// A later fill drops whatever it covers
+		queue.fillCircle(50, 50, 20, SCENE_BLUE);
+		queue.drawRect(100, 100, 20, 20, SCENE_RED);
+		queue.fillRect(20, 20, 70, 70, SCENE_BLACK);
+		assert(queue.queued() == 5);
+		queue.fillScreen(SCENE_BLACK);
+		assert(queue.queued() == 1);
+		queue.flush();
+	}
+
+	{
+		// A scrolling console shows the last lines in order, leaves the
+		// fixed areas alone, and a line once full costs one line of pixels
+		GFXscrollConsole console(tft, 16, 20);
+		tft.setRotation(1);
+		tft.fillScreen(SCENE_RED);
+		console.setTextSize(2);
+		console.setTextColor(SCENE_YELLOW, SCENE_BLUE);
+		console.begin();
+		assert(tft.getRotation() == 0);
+		assert(console.lines() == 17); // 284 rows, 12 left to the bottom area
+		for (int i = 0; i < 40; i++) console.printf("line %d\n", i);
+		tft.resetCounters();
+		console.printf("line %d\n", 40);
+		assert(tft.counters().pixels <= 2 * 240 * 16);
+		assert(tft.counters().transactions < 20);
+
+		canvas.setRotation(0);
+		canvas.fillScreen(SCENE_RED);
+		canvas.fillRect(0, 16, 240, 17 * 16, SCENE_BLUE);
+		canvas.setTextSize(2);
+		canvas.setTextColor(SCENE_YELLOW, SCENE_BLUE);
+		for (int i = 0; i < 16; i++) {
+			canvas.setCursor(0, 16 + i * 16);
+			canvas.printf("line %d", 25 + i);
+		}
+		for (int16_t y = 0; y < 320; y++) {
+			for (int16_t x = 0; x < 240; x++) {
+				assert(tft.getGlassPixel(x, y) == canvasPixel(canvas, x, y));
+			}
+		}
+
+		console.end();
+		for (int16_t y = 0; y < 320; y++) {
+			assert(tft.getGlassPixel(7, y) == tft.getPixel(7, y));
+		}
+
+		GFXscrollConsole overfull(tft, 300, 40);
+		overfull.begin();
+		assert(overfull.lines() == 0);
+		overfull.print("nowhere\n");
+		overfull.end();
+		canvas.setTextSize(1);
+	}
+
+	{
+		// Lines a run at a time have exactly the old pixels, drawing over
+		// them in the background color either way round leaves nothing,
+		// and cost a window per run
+		canvas.setRotation(0);
+		uint32_t seed = 1;
+		for (int i = 0; i < 2000; i++) {
+			int16_t v[4];
+			for (int j = 0; j < 4; j++) {
+				seed = seed * 1103515245 + 12345;
+				v[j] = (int16_t)((seed >> 16) % 400) - 80;
+			}
+			if (i & 1) v[3] = v[1] + (v[3] & 15) - 8; // Shallow
+			for (int order = 0; order < 2; order++) {
+				canvas.fillScreen(SCENE_BLACK);
+				if (order) {
+					canvas.drawLine(v[0], v[1], v[2], v[3], SCENE_WHITE);
+					referenceLine(canvas, v[0], v[1], v[2], v[3], SCENE_BLACK);
+				} else {
+					referenceLine(canvas, v[0], v[1], v[2], v[3], SCENE_WHITE);
+					canvas.drawLine(v[0], v[1], v[2], v[3], SCENE_BLACK);
+				}
+				for (int k = 0; k < FAKETFT_WIDTH * FAKETFT_HEIGHT; k++) {
+					assert(canvas.getBuffer()[k] == SCENE_BLACK);
+				}
+			}
+		}
+		tft.resetCounters();
+		tft.drawLine(0, 0, 239, 9, SCENE_WHITE);
+		assert(tft.counters().addrWindows == 10);
+		assert(tft.counters().pixels == 240);
+		tft.resetCounters();
+		tft.drawLine(5, 319, 0, 0, SCENE_WHITE);
+		assert(tft.counters().addrWindows == 6);
+		tft.resetCounters();
+		tft.drawLine(0, 0, 100, 100, SCENE_WHITE);
+		assert(tft.counters().addrWindows == 101);
+	}
+
+	{
+		// Filled circles and rounded rectangles a row at a time cover exactly
+		// the pixels of the old quarter-circle columns: the new shape drawn
+		// over the old one in the background color leaves nothing, and the
+		// other way around
+		canvas.setRotation(0);
+		for (int16_t r = 0; r <= 40; r++) {
+			for (int pass = 0; pass < 4; pass++) {
+				// (Not h == 2 * r: the old way draws zero-height columns there,
+				// which a canvas turns into two pixels)
+				int16_t w = 2 * r + (pass & 1) * 7 + ((pass == 3) ? 1 : 0), h = 2 * r + 1 + (pass >> 1) * 4;
+				if (!w) continue;
+				for (int order = 0; order < 2; order++) {
+					canvas.fillScreen(SCENE_BLACK);
+					for (int step = 0; step < 2; step++) {
+						uint16_t color = step ? SCENE_BLACK : SCENE_WHITE;
+						if ((step == 0) == (order == 0)) {
+							canvas.startWrite();
+							if (pass == 0) {
+								canvas.writeFastVLine(100, 100 - r, 2 * r + 1, color);
+								canvas.fillCircleHelper(100, 100, r, 3, 0, color);
+							} else {
+								canvas.writeFillRect(10 + r, 10, w - 2 * r, h, color);
+								canvas.fillCircleHelper(10 + w - r - 1, 10 + r, r, 1, h - 2 * r - 1, color);
+								canvas.fillCircleHelper(10 + r, 10 + r, r, 2, h - 2 * r - 1, color);
+							}
+							canvas.endWrite();
+						} else if (pass == 0) {
+							canvas.fillCircle(100, 100, r, color);
+						} else {
+							canvas.fillRoundRect(10, 10, w, h, r, color);
+						}
+					}
+					for (int i = 0; i < FAKETFT_WIDTH * FAKETFT_HEIGHT; i++) {
+						assert(canvas.getBuffer()[i] == SCENE_BLACK);
+					}
+				}
+			}
+		}
+
+		// Rows of equal width go out as one window
+		tft.resetCounters();
+		tft.fillCircle(120, 160, 50, SCENE_RED);
+		assert(tft.counters().addrWindows < 2 * 50 + 1 - 10);
+		tft.resetCounters();
+		tft.fillRoundRect(20, 20, 200, 100, 10, SCENE_GREEN);
+		assert(tft.counters().addrWindows <= 2 * 10 + 1);
+		tft.resetCounters();
+		tft.fillTriangle(120, 0, 100, 300, 140, 300, SCENE_BLUE); // Tall and thin
+		assert(tft.counters().addrWindows < 300 / 2);
+		canvas.fillCircle(120, 160, 50, SCENE_RED);
+		canvas.fillRoundRect(20, 20, 200, 100, 10, SCENE_GREEN);
+		canvas.fillTriangle(120, 0, 100, 300, 140, 300, SCENE_BLUE);
+		canvas.fillScreen(SCENE_BLACK);
+		tft.fillScreen(SCENE_BLACK);
+
+		// Polygons: a rectangle is the rectangle, in one window; a concave
+		// one is filled around its notch; a pentagram by the even-odd rule
+		// leaves its middle empty
+		static const int16_t rectX[] = { 10, 50, 50, 10 }, rectY[] = { 10, 10, 30, 30 };
+		static const int16_t notchX[] = { 60, 160, 160, 110, 60 }, notchY[] = { 40, 40, 140, 90, 140 };
+		static const int16_t starX[] = { 120, 155, 63, 177, 85 }, starY[] = { 160, 268, 201, 201, 268 };
+		tft.resetCounters();
+		tft.fillPolygon(rectX, rectY, 4, SCENE_YELLOW);
+		assert(tft.counters().addrWindows == 1);
+		assert(tft.counters().pixels == 41 * 21);
+		canvas.fillRect(10, 10, 41, 21, SCENE_YELLOW);
+		assertSameAsCanvas("fillPolygon rectangle", 0);
+
+		tft.resetCounters();
+		tft.fillPolygon(notchX, notchY, 5, SCENE_CYAN);
+		assert(tft.counters().addrWindows <= 1 + 2 * 51); // Above the notch, then per row
+		assert(tft.getPixel(110, 60) == SCENE_CYAN);
+		assert(tft.getPixel(70, 130) == SCENE_CYAN && tft.getPixel(150, 130) == SCENE_CYAN);
+		assert(tft.getPixel(110, 130) == SCENE_BLACK);
+		canvas.fillPolygon(notchX, notchY, 5, SCENE_CYAN);
+		assertSameAsCanvas("fillPolygon notch", 0);
+
+		tft.fillPolygon(starX, starY, 5, SCENE_MAGENTA);
+		assert(tft.getPixel(120, 215) == SCENE_BLACK);
+		assert(tft.getPixel(120, 175) == SCENE_MAGENTA);
+		assert(tft.getPixel(150, 260) == SCENE_MAGENTA);
+		canvas.fillPolygon(starX, starY, 5, SCENE_MAGENTA);
+		assertSameAsCanvas("fillPolygon star", 0);
+	}
+
+	{
+		// Every helpingHands.cpp test, in every rotation, matches the canvas
+		for (uint8_t rotation = 0; rotation < 4; rotation++) {
+			tft.setRotation(rotation);
+			canvas.setRotation(rotation);
+			assert(tft.width() == canvas.width());
+			assert(tft.height() == canvas.height());
+
+			for (size_t ii = 0; ii < numScenes; ii++) {
+				assert(scenes[ii].func(tft, clock) > 0);
+				assert(scenes[ii].func(canvas, clock) > 0);
+				assertSameAsCanvas(scenes[ii].name, rotation);
+			}
+		}
+		tft.setRotation(0);
+	}
+
+	{
+		// Redrawing the clock the CapstoneCode.cpp way (clear, print it all)
+		// only sends what changed
+		GFXcanvas16Dirty clock(320, 48);
+		tft.setRotation(1);
+		tft.fillScreen(SCENE_BLUE);
+		clock.setTextColor(SCENE_YELLOW);
+		clock.setTextSize(3);
+
+		clock.fillScreen(SCENE_BLACK);
+		clock.setCursor(0, 0);
+		clock.println("12:34");
+		clock.println(" 10-17-2026");
+		tft.resetCounters();
+		assert(clock.flush(tft) == 320 * 48);
+		assert(clock.dirtyCount() == 0);
+		for (int16_t y = 0; y < 48; y++) {
+			for (int16_t x = 0; x < 320; x++) {
+				assert(tft.getPixel(x, y) == clock.getBuffer()[x + y * 320]);
+			}
+		}
+		assert(tft.getPixel(0, 48) == SCENE_BLUE);
+
+		clock.fillScreen(SCENE_BLACK);
+		clock.setCursor(0, 0);
+		clock.println("12:35");
+		clock.println(" 10-17-2026");
+		tft.resetCounters();
+		uint32_t pixels = clock.flush(tft);
+		assert(pixels > 0 && pixels <= 24 * 24); // One digit, tile aligned
+		assert(tft.counters().bytes < 1000);
+		assert(tft.counters().addrWindows == 1);
+		for (int16_t y = 0; y < 48; y++) {
+			for (int16_t x = 0; x < 320; x++) {
+				assert(tft.getPixel(x, y) == clock.getBuffer()[x + y * 320]);
+			}
+		}
+
+		// Nothing changed, nothing sent
+		clock.fillScreen(SCENE_BLACK);
+		clock.setCursor(0, 0);
+		clock.println("12:35");
+		clock.println(" 10-17-2026");
+		assert(clock.flush(tft) == 0);
+		tft.setRotation(0);
+	}
+
+	{
+		// Banded rendering matches a full-size canvas, a strip at a time
+		tft.setRotation(1);
+		canvas.setRotation(1);
+		drawReminder(canvas);
+
+		GFXbandRenderer bands(320, 240);
+		drawReminder(bands);
+		assert(!bands.overflowed());
+		assert(bands.listUsed() < 400);
+		tft.fillScreen(SCENE_RED);
+		tft.resetCounters();
+		assert(bands.render(tft) == 320 * 240);
+		assert(tft.counters().addrWindows == 240 / GFX_BAND_ROWS);
+		assert(tft.counters().pixels == 320 * 240);
+		assertSameAsCanvas("GFXbandRenderer", 1);
+
+		// Strips that don't divide the height, and a list that's too small
+		GFXbandRenderer odd(320, 240, 7);
+		drawReminder(odd);
+		tft.fillScreen(SCENE_RED);
+		odd.render(tft);
+		assertSameAsCanvas("GFXbandRenderer 7 rows", 1);
+
+		GFXbandRenderer tiny(320, 240, 24, 64);
+		drawReminder(tiny);
+		assert(tiny.overflowed());
+		tiny.fillScreen(SCENE_BLACK);
+		assert(!tiny.overflowed() && tiny.listUsed() == 0);
+
+		tft.setRotation(0);
+		canvas.setRotation(0);
+	}
+
+#if defined(SPITFT_TRACE)
+	{
+		// Tracer sees exactly the bytes the panel does, charged per primitive
+		tft.setRotation(0);
+		tft.resetCounters();
+		tft.traceReset();
+		tft.fillScreen(SCENE_BLACK);
+		tft.fillRoundRect(10, 10, 100, 50, 8, SCENE_RED);
+		tft.setCursor(0, 0);
+		tft.setTextColor(SCENE_WHITE);
+		tft.setTextSize(1);
+		tft.print("Hi");
+
+		const SPITFT_TraceFrame &f = tft.traceCurrent();
+		uint32_t bytes = 0;
+		for (int p = 0; p < GFX_TRACE_COUNT; p++) {
+			bytes += Adafruit_SPITFT::traceBytes(f.prim[p]);
+		}
+		assert(bytes == tft.counters().bytes);
+		assert(f.prim[GFX_TRACE_FILLSCREEN].calls == 1);
+		assert(f.prim[GFX_TRACE_FILLSCREEN].colorBytes == FAKETFT_WIDTH * FAKETFT_HEIGHT * 2);
+		assert(f.prim[GFX_TRACE_FILLSCREEN].windows == 1);
+		assert(f.prim[GFX_TRACE_FILLRECT].calls == 0); // Nested, charged to fillScreen
+		assert(f.prim[GFX_TRACE_FILLROUNDRECT].calls == 1);
+		assert(f.prim[GFX_TRACE_CHAR].calls == 2);
+		// At most CASET, PASET and RAMWR per window, RAMWR always
+		assert(f.prim[GFX_TRACE_CHAR].windows >= (f.prim[GFX_TRACE_CHAR].commands + 2) / 3);
+		uint32_t windows = 0;
+		for (int p = 0; p < GFX_TRACE_COUNT; p++) {
+			windows += f.prim[p].windows;
+		}
+		assert(windows == tft.counters().ramwr);
+
+		// Same pixel twice doesn't re-send the CASET and PASET
+		tft.drawPixel(5, 5, SCENE_RED);
+		tft.drawPixel(5, 5, SCENE_RED);
+		assert(tft.traceCurrent().prim[GFX_TRACE_PIXEL].windows == 2);
+		assert(tft.traceCurrent().prim[GFX_TRACE_PIXEL].commands == 4);
+		assert(tft.traceCurrent().prim[GFX_TRACE_PIXEL].repeatBytes == 0);
+
+		tft.traceFrame();
+		assert(tft.traceHistory(0) != NULL);
+		assert(tft.traceHistory(0)->frame == 0);
+		assert(tft.traceHistory(1) == NULL);
+		assert(tft.traceCurrent().frame == 1);
+		assert(tft.traceCurrent().prim[GFX_TRACE_PIXEL].calls == 0);
+	}
+#endif
+
+	printf("GfxTest passed\n");
+	return 0;
+}
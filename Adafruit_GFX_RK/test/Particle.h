@@ -0,0 +1,69 @@
+// Dummy Particle.h for building the GFX core from gcc on the host.
+// String and Print come from the JsonParserGeneratorRK/test/gcclib shim;
+// everything else here is the handful of Wiring calls that
+// Adafruit_GFX_RK.cpp and Adafruit_SPITFT.cpp actually make.
+#ifndef __PARTICLE_H
+#define __PARTICLE_H
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <cassert>
+
+#include "spark_wiring_string.h"
+#include "spark_wiring_print.h"
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+// Flash is plain memory on the host. Words are read with memcpy() rather
+// than through a cast pointer, which breaks strict aliasing.
+static inline unsigned short hostReadWord(const void *addr) {
+	unsigned short w;
+	memcpy(&w, addr, sizeof(w));
+	return w;
+}
+static inline unsigned long hostReadDword(const void *addr) {
+	unsigned long d;
+	memcpy(&d, addr, sizeof(d));
+	return d;
+}
+
+#define PROGMEM
+#define pgm_read_byte(addr)  (*(const unsigned char *)(addr))
+#define pgm_read_word(addr)  hostReadWord(addr)
+#define pgm_read_dword(addr) hostReadDword(addr)
+#define HIGH     0x1
+#define LOW      0x0
+#define INPUT    0x0
+#define OUTPUT   0x1
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#define HOST_NUM_PINS 32 ///< Size of the fake GPIO table
+
+void     pinMode(uint16_t pin, uint8_t mode);
+void     digitalWrite(uint16_t pin, uint8_t value);
+int32_t  digitalRead(uint16_t pin);
+void     delay(unsigned long ms);
+unsigned long millis(void);
+unsigned long micros(void);
+void     yield(void);
+
+// Host-only: nanoseconds from a monotonic clock, for the benchmark runner
+uint64_t hostNanos(void);
+
+/// Serial goes to stdout on the host
+class HostSerial : public Print {
+public:
+	void begin(unsigned long baud) { (void)baud; }
+	virtual size_t write(uint8_t c) { return fputc(c, stdout) == EOF ? 0 : 1; }
+	using Print::write;
+};
+extern HostSerial Serial;
+
+#endif /* __PARTICLE_H */
@@ -0,0 +1,100 @@
+// Dummy SPI.h for building Adafruit_SPITFT from gcc on the host. There is
+// no bus here: every byte is handed to whatever HostSPIDevice is attached
+// (see FakeTFT.h), which is also where the replies for reads come from.
+// The DMA form of transfer() finishes before it returns, then calls back,
+// unless deferDMA is set: then its bytes go out only when the driver next
+// waits for it (SPI_ASYNC_POLL()), at whatever D/C says by then, as they
+// would from a slow DMA on the hardware.
+#ifndef __SPI_H
+#define __SPI_H
+
+#include "Particle.h"
+
+#define SPI_HAS_TRANSACTION
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x01
+#define SPI_MODE2 0x02
+#define SPI_MODE3 0x03
+
+/// Called by Adafruit_SPITFT while it waits for a DMA transfer
+#define SPI_ASYNC_POLL() SPI.finishDMA()
+
+/// Something listening on the far end of the fake SPI bus
+class HostSPIDevice {
+public:
+	virtual ~HostSPIDevice() {}
+	virtual void    beginTransaction(uint32_t clock) { (void)clock; }
+	virtual void    endTransaction(void) {}
+	virtual uint8_t transfer(uint8_t b) = 0;
+};
+
+typedef void (*wiring_spi_dma_transfercomplete_callback_t)(void);
+
+class SPISettings {
+public:
+	SPISettings() : clock(4000000), bitOrder(MSBFIRST), dataMode(SPI_MODE0) {}
+	SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode) :
+	  clock(clock), bitOrder(bitOrder), dataMode(dataMode) {}
+	uint32_t clock;
+	uint8_t  bitOrder;
+	uint8_t  dataMode;
+};
+
+class SPIClass {
+public:
+	SPIClass() : dmaTransfers(0), deferDMA(false), device(NULL),
+	  pendingTx(NULL), pendingLen(0), pendingCallback(NULL) {}
+
+	void    begin(void) {}
+	void    end(void) {}
+	void    beginTransaction(SPISettings settings) {
+		if(device) device->beginTransaction(settings.clock);
+	}
+	void    endTransaction(void) { if(device) device->endTransaction(); }
+	uint8_t transfer(uint8_t b) { return device ? device->transfer(b) : 0; }
+	void    transfer(void *tx, void *rx, size_t len,
+	                 wiring_spi_dma_transfercomplete_callback_t callback) {
+		dmaTransfers++;
+		if (deferDMA && !rx) {
+			finishDMA(); // One at a time
+			pendingTx       = (const uint8_t *)tx;
+			pendingLen      = len;
+			pendingCallback = callback;
+			return;
+		}
+		for (size_t i = 0; i < len; i++) {
+			uint8_t b = transfer(tx ? ((uint8_t *)tx)[i] : 0);
+			if (rx) ((uint8_t *)rx)[i] = b;
+		}
+		if (callback) callback();
+	}
+
+	/// Host-only: send a deferred DMA transfer now, and call back
+	void    finishDMA(void) {
+		if (!pendingCallback && !pendingLen) return;
+		wiring_spi_dma_transfercomplete_callback_t callback = pendingCallback;
+		for (size_t i = 0; i < pendingLen; i++) {
+			transfer(pendingTx ? pendingTx[i] : 0);
+		}
+		pendingLen      = 0;
+		pendingCallback = NULL;
+		if (callback) callback();
+	}
+
+	/// Host-only: connect the fake peripheral that receives our bytes
+	void    attach(HostSPIDevice *d) { device = d; }
+
+	uint32_t dmaTransfers; ///< Host-only: calls to the DMA form of transfer()
+	bool     deferDMA;     ///< Host-only: leave DMA transfers running until waited for
+
+private:
+	HostSPIDevice *device;
+	const uint8_t *pendingTx;
+	size_t         pendingLen;
+	wiring_spi_dma_transfercomplete_callback_t pendingCallback;
+};
+
+extern SPIClass SPI;
+
+#endif /* __SPI_H */
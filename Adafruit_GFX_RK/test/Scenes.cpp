@@ -0,0 +1,213 @@
+#include "Scenes.h"
+
+// Adafruit_GFX has no color565(), that lives in Adafruit_SPITFT
+static uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+	return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+static int imin(int a, int b) {
+	return (a < b) ? a : b;
+}
+
+static void clear(Adafruit_GFX &gfx, SceneClock &clock) {
+	clock.pause();
+	gfx.fillScreen(SCENE_BLACK);
+	clock.resume();
+}
+
+static uint32_t sceneFillScreen(Adafruit_GFX &gfx, SceneClock &clock) {
+	(void)clock;
+	gfx.fillScreen(SCENE_BLACK);
+	gfx.fillScreen(SCENE_RED);
+	gfx.fillScreen(SCENE_GREEN);
+	gfx.fillScreen(SCENE_BLUE);
+	gfx.fillScreen(SCENE_BLACK);
+	return 5;
+}
+
+// Counts characters rather than print calls, that's what drawChar() sees
+static uint32_t sceneText(Adafruit_GFX &gfx, SceneClock &clock) {
+	uint32_t n = 0;
+
+	clear(gfx, clock);
+	gfx.setCursor(0, 0);
+	gfx.setTextColor(SCENE_WHITE);
+	gfx.setTextSize(1);
+	n += gfx.println("Hello World!");
+	gfx.setTextColor(SCENE_YELLOW);
+	gfx.setTextSize(2);
+	n += gfx.println(1234.56);
+	gfx.setTextColor(SCENE_RED);
+	gfx.setTextSize(3);
+	n += gfx.println(0xDEADBEEF, HEX);
+	n += gfx.println();
+	gfx.setTextColor(SCENE_GREEN);
+	gfx.setTextSize(5);
+	n += gfx.println("Groop");
+	gfx.setTextSize(2);
+	n += gfx.println("I implore thee,");
+	gfx.setTextSize(1);
+	n += gfx.println("my foonting turlingdromes.");
+	n += gfx.println("And hooptiously drangle me");
+	n += gfx.println("with crinkly bindlewurdles,");
+	n += gfx.println("Or I will rend thee");
+	n += gfx.println("in the gobberwarts");
+	n += gfx.println("with my blurglecruncheon,");
+	n += gfx.println("see if I don't!");
+	return n;
+}
+
+static uint32_t sceneLines(Adafruit_GFX &gfx, SceneClock &clock) {
+	static const uint8_t corners[4][2] = { { 0, 0 }, { 1, 0 }, { 0, 1 }, { 1, 1 } };
+	int      w = gfx.width(), h = gfx.height();
+	uint32_t n = 0;
+
+	for (int c = 0; c < 4; c++) {
+		int x1 = corners[c][0] ? w - 1 : 0,
+		    y1 = corners[c][1] ? h - 1 : 0,
+		    x2, y2 = corners[c][1] ? 0 : h - 1;
+		clear(gfx, clock);
+		for (x2 = 0; x2 < w; x2 += 6, n++)
+			gfx.drawLine(x1, y1, x2, y2, SCENE_CYAN);
+		x2 = corners[c][0] ? 0 : w - 1;
+		for (y2 = 0; y2 < h; y2 += 6, n++)
+			gfx.drawLine(x1, y1, x2, y2, SCENE_CYAN);
+	}
+	return n;
+}
+
+static uint32_t sceneFastLines(Adafruit_GFX &gfx, SceneClock &clock) {
+	int      w = gfx.width(), h = gfx.height();
+	uint32_t n = 0;
+
+	clear(gfx, clock);
+	for (int y = 0; y < h; y += 5, n++)
+		gfx.drawFastHLine(0, y, w, SCENE_RED);
+	for (int x = 0; x < w; x += 5, n++)
+		gfx.drawFastVLine(x, 0, h, SCENE_BLUE);
+	return n;
+}
+
+static uint32_t sceneRects(Adafruit_GFX &gfx, SceneClock &clock) {
+	int      cx = gfx.width() / 2, cy = gfx.height() / 2,
+	         n  = imin(gfx.width(), gfx.height());
+	uint32_t count = 0;
+
+	clear(gfx, clock);
+	for (int i = 2; i < n; i += 6, count++) {
+		int i2 = i / 2;
+		gfx.drawRect(cx - i2, cy - i2, i, i, SCENE_GREEN);
+	}
+	return count;
+}
+
+// Outlines are not included in timing results
+static uint32_t sceneFilledRects(Adafruit_GFX &gfx, SceneClock &clock) {
+	int      cx = gfx.width() / 2 - 1, cy = gfx.height() / 2 - 1,
+	         n  = imin(gfx.width(), gfx.height());
+	uint32_t count = 0;
+
+	clear(gfx, clock);
+	for (int i = n; i > 0; i -= 6, count++) {
+		int i2 = i / 2;
+		gfx.fillRect(cx - i2, cy - i2, i, i, SCENE_YELLOW);
+		clock.pause();
+		gfx.drawRect(cx - i2, cy - i2, i, i, SCENE_MAGENTA);
+		clock.resume();
+	}
+	return count;
+}
+
+static uint32_t sceneFilledCircles(Adafruit_GFX &gfx, SceneClock &clock) {
+	int      radius = 10, r2 = radius * 2, w = gfx.width(), h = gfx.height();
+	uint32_t n = 0;
+
+	clear(gfx, clock);
+	for (int x = radius; x < w; x += r2)
+		for (int y = radius; y < h; y += r2, n++)
+			gfx.fillCircle(x, y, radius, SCENE_MAGENTA);
+	return n;
+}
+
+// Screen is not cleared for this one, same as helpingHands.cpp
+static uint32_t sceneCircles(Adafruit_GFX &gfx, SceneClock &clock) {
+	int      radius = 10, r2 = radius * 2,
+	         w = gfx.width() + radius, h = gfx.height() + radius;
+	uint32_t n = 0;
+
+	(void)clock;
+	for (int x = 0; x < w; x += r2)
+		for (int y = 0; y < h; y += r2, n++)
+			gfx.drawCircle(x, y, radius, SCENE_WHITE);
+	return n;
+}
+
+static uint32_t sceneTriangles(Adafruit_GFX &gfx, SceneClock &clock) {
+	int      cx = gfx.width() / 2 - 1, cy = gfx.height() / 2 - 1,
+	         n  = imin(cx, cy);
+	uint32_t count = 0;
+
+	clear(gfx, clock);
+	for (int i = 0; i < n; i += 5, count++)
+		gfx.drawTriangle(cx, cy - i, cx - i, cy + i, cx + i, cy + i,
+		                 color565(i, i, i));
+	return count;
+}
+
+static uint32_t sceneFilledTriangles(Adafruit_GFX &gfx, SceneClock &clock) {
+	int      cx = gfx.width() / 2 - 1, cy = gfx.height() / 2 - 1;
+	uint32_t count = 0;
+
+	clear(gfx, clock);
+	for (int i = imin(cx, cy); i > 10; i -= 5, count++) {
+		gfx.fillTriangle(cx, cy - i, cx - i, cy + i, cx + i, cy + i,
+		                 color565(0, i * 10, i * 10));
+		clock.pause();
+		gfx.drawTriangle(cx, cy - i, cx - i, cy + i, cx + i, cy + i,
+		                 color565(i * 10, i * 10, 0));
+		clock.resume();
+	}
+	return count;
+}
+
+static uint32_t sceneRoundRects(Adafruit_GFX &gfx, SceneClock &clock) {
+	int      cx = gfx.width() / 2 - 1, cy = gfx.height() / 2 - 1,
+	         w  = imin(gfx.width(), gfx.height());
+	uint32_t count = 0;
+
+	clear(gfx, clock);
+	for (int i = 0; i < w; i += 6, count++) {
+		int i2 = i / 2;
+		gfx.drawRoundRect(cx - i2, cy - i2, i, i, i / 8, color565(i, 0, 0));
+	}
+	return count;
+}
+
+static uint32_t sceneFilledRoundRects(Adafruit_GFX &gfx, SceneClock &clock) {
+	int      cx = gfx.width() / 2 - 1, cy = gfx.height() / 2 - 1;
+	uint32_t count = 0;
+
+	clear(gfx, clock);
+	for (int i = imin(gfx.width(), gfx.height()); i > 20; i -= 6, count++) {
+		int i2 = i / 2;
+		gfx.fillRoundRect(cx - i2, cy - i2, i, i, i / 8, color565(0, i, 0));
+	}
+	return count;
+}
+
+// Same order as the printout in helpingHands.cpp setup()
+const Scene scenes[] = {
+	{ "ScreenFill",          sceneFillScreen       },
+	{ "Text",                sceneText             },
+	{ "Lines",               sceneLines            },
+	{ "HorizVertLines",      sceneFastLines        },
+	{ "RectanglesOutline",   sceneRects            },
+	{ "RectanglesFilled",    sceneFilledRects      },
+	{ "CirclesFilled",       sceneFilledCircles    },
+	{ "CirclesOutline",      sceneCircles          },
+	{ "TrianglesOutline",    sceneTriangles        },
+	{ "TrianglesFilled",     sceneFilledTriangles  },
+	{ "RoundedRectsOutline", sceneRoundRects       },
+	{ "RoundedRectsFilled",  sceneFilledRoundRects },
+};
+const size_t numScenes = sizeof(scenes) / sizeof(scenes[0]);
@@ -0,0 +1,39 @@
+// The helpingHands.cpp benchmark tests, rewritten against a plain
+// Adafruit_GFX reference so the same drawing can be sent to FakeTFT (to
+// count bus traffic) or to a GFXcanvas16 (as the pixel-exact reference).
+#ifndef __SCENES_H
+#define __SCENES_H
+
+#include "Adafruit_GFX.h"
+
+// Colors used by helpingHands.cpp, same values as Adafruit_ILI9341.h
+#define SCENE_BLACK   0x0000
+#define SCENE_BLUE    0x001F
+#define SCENE_RED     0xF800
+#define SCENE_GREEN   0x07E0
+#define SCENE_CYAN    0x07FF
+#define SCENE_MAGENTA 0xF81F
+#define SCENE_YELLOW  0xFFE0
+#define SCENE_WHITE   0xFFFF
+
+/// Lets a scene hide its setup work (the clearing fillScreen() calls that
+/// helpingHands.cpp also leaves out of its timing) from whoever is measuring
+class SceneClock {
+public:
+	virtual ~SceneClock() {}
+	virtual void pause(void) {}
+	virtual void resume(void) {}
+};
+
+/// A scene draws on gfx and returns how many primitives it timed
+typedef uint32_t (*SceneFunc)(Adafruit_GFX &gfx, SceneClock &clock);
+
+typedef struct {
+	const char *name;
+	SceneFunc   func;
+} Scene;
+
+extern const Scene scenes[];
+extern const size_t numScenes;
+
+#endif /* __SCENES_H */
@@ -0,0 +1,50 @@
+#include "Particle.h"
+#include "SPI.h"
+
+#include <time.h>
+
+// Wiring calls used by the GFX core, implemented just well enough for the
+// host build. Pin levels are remembered so FakeTFT can see the D/C line.
+
+static uint8_t pinLevel[HOST_NUM_PINS];
+
+HostSerial Serial;
+SPIClass   SPI;
+
+void pinMode(uint16_t pin, uint8_t mode) {
+	(void)pin;
+	(void)mode;
+}
+
+void digitalWrite(uint16_t pin, uint8_t value) {
+	if (pin < HOST_NUM_PINS) {
+		pinLevel[pin] = value ? HIGH : LOW;
+	}
+}
+
+int32_t digitalRead(uint16_t pin) {
+	return (pin < HOST_NUM_PINS) ? pinLevel[pin] : LOW;
+}
+
+uint64_t hostNanos(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Nothing on the host needs real time to pass (reset pulses, sleep-out),
+// so delay() returns immediately to keep the benchmark honest.
+void delay(unsigned long ms) {
+	(void)ms;
+}
+
+unsigned long millis(void) {
+	return (unsigned long)(hostNanos() / 1000000ULL);
+}
+
+unsigned long micros(void) {
+	return (unsigned long)(hostNanos() / 1000ULL);
+}
+
+void yield(void) {
+}
@@ -164,6 +164,7 @@ void Adafruit_ILI9341::begin(uint32_t freq) {
 
     _width  = ILI9341_TFTWIDTH;
     _height = ILI9341_TFTHEIGHT;
+    invalidateAddrWindow(); // Reset back to the whole panel
 }
 
 
@@ -202,6 +203,7 @@ void Adafruit_ILI9341::setRotation(uint8_t m) {
     writeCommand(ILI9341_MADCTL);
     spiWrite(m);
     endWrite();
+    invalidateAddrWindow(); // Same ranges mean something else now
 }
 
 /**************************************************************************/
@@ -231,7 +233,7 @@ void Adafruit_ILI9341::scrollTo(uint16_t y) {
 
 /**************************************************************************/
 /*!
-    @brief   Set the "address window" - the rectangle we will write to RAM with the next chunk of SPI data writes. The ILI9341 will automatically wrap the data as each row is filled
+    @brief   Set the "address window" - the rectangle we will write to RAM with the next chunk of SPI data writes. The ILI9341 will automatically wrap the data as each row is filled. A column or row range the display already has isn't sent again; see invalidateAddrWindow()
     @param   x  TFT memory 'x' origin
     @param   y  TFT memory 'y' origin
     @param   w  Width of rectangle
@@ -241,11 +243,17 @@ void Adafruit_ILI9341::scrollTo(uint16_t y) {
 void Adafruit_ILI9341::setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
     uint32_t xa = ((uint32_t)x << 16) | (x+w-1);
     uint32_t ya = ((uint32_t)y << 16) | (y+h-1);
-    writeCommand(ILI9341_CASET); // Column addr set
-    SPI_WRITE32(xa);
-    writeCommand(ILI9341_PASET); // Row addr set
-    SPI_WRITE32(ya);
-    writeCommand(ILI9341_RAMWR); // write to RAM
+    if(xa != addrColumns) { // Vertical strips, glyph columns... reuse it
+        writeCommand(ILI9341_CASET); // Column addr set
+        SPI_WRITE32(xa);
+        addrColumns = xa;
+    }
+    if(ya != addrRows) { // Runs along a row reuse this one
+        writeCommand(ILI9341_PASET); // Row addr set
+        SPI_WRITE32(ya);
+        addrRows = ya;
+    }
+    writeCommand(ILI9341_RAMWR); // write to RAM, from the window's start
 }
 
 /**************************************************************************/
@@ -258,15 +266,15 @@ void Adafruit_ILI9341::setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_
 */
 /**************************************************************************/
 uint8_t Adafruit_ILI9341::readcommand8(uint8_t command, uint8_t index) {
-    uint32_t freq = _freq;
-    if(_freq > 24000000) _freq = 24000000;
+    useReadClock(true);
     startWrite();
     writeCommand(0xD9);  // woo sekret command?
     spiWrite(0x10 + index);
     writeCommand(command);
     uint8_t r = spiRead();
     endWrite();
-    _freq = freq;
+    useReadClock(false);
+    invalidateAddrWindow();
     return r;
 }
 
@@ -1,6 +1,12 @@
 // Include Particle Device OS APIs
 #include <Particle.h>
 #include <Adafruit_GFX_RK.h>
+#include <Adafruit_GlyphCache.h>
+#include <Adafruit_AlphaFont.h>
+#include <Adafruit_DrawQueue.h>
+#include <Adafruit_Widgets.h>
+#include <FreeMono18pt4a.h>
+#include <FreeMono12pt4a.h>
 #include <neopixel.h>
 #include <Colors.h>
 #include <IoTTimer.h>
@@ -12,6 +18,7 @@
 #include <Adafruit_MQTT/Adafruit_MQTT_SPARK.h>
 #include <Adafruit_MQTT/Adafruit_MQTT.h>
 #include <Credentials.h>
+#include "Reminders.h"
 
 TCPClient TheClient;
 
@@ -44,8 +51,16 @@ unsigned long lastRemindUpdate = 0;
 // CONSTANTS
 const int PIXELCOUNT = 7, NUMBEROFTRACKS = 6, WEMO = 1, HUE = 1;
 const unsigned long DEBOUNCE_DELAY = 1000; // 1 second debounce time
+const int BUS_SPEED_ADDR = 0;              // EEPROM address of the display's calibrated SPI clocks
 // OBJECTS
 Adafruit_ILI9341 tft(TFT_CS, TFT_DC);
+SPITFT_BusSpeed busSpeed; // Fastest clocks the display works at, found on the first boot
+GFXglyphCache glyphCache; // Clock digits and reminder text
+GFXscreen screen(tft, ILI9341_BLACK); // Repaints only the labels that changed
+GFXlabel timeLabel(0, 0, "", ILI9341_YELLOW);  // Size 3, at the top or along the bottom
+GFXlabel dateLabel(0, 24, "", ILI9341_YELLOW); // Size 3, under the time
+GFXlabel messageLabel(0, 24); // Anti-aliased reminder messages
+GFXdrawQueue drawQueue(tft); // Batches line and outline drawing into one transaction
 Adafruit_NeoPixel pixel(PIXELCOUNT, SPI1, WS2812B);
 Button encoderSwitch(D15);
 DFRobotDFPlayerMini MomsGrooves;
@@ -103,6 +118,19 @@ void setup()
   Serial1.begin(9600);
   // initiate display
   tft.begin();
+  EEPROM.get(BUS_SPEED_ADDR, busSpeed);
+  if (!tft.setBusSpeed(busSpeed) && tft.calibrateSPI(&busSpeed))
+  {
+    EEPROM.put(BUS_SPEED_ADDR, busSpeed); // Later boots skip calibrating
+  }
+  tft.setGlyphCache(&glyphCache);
+  timeLabel.setTextSize(3);
+  dateLabel.setTextSize(3);
+  messageLabel.setAlphaFont(&FreeMono18pt4a);
+  messageLabel.show(false);
+  screen.add(timeLabel);
+  screen.add(dateLabel);
+  screen.add(messageLabel);
   // initialte wifi
   WiFi.on();
 
@@ -440,11 +468,13 @@ unsigned long testFastLines(uint16_t color1, uint16_t color2)
   int x, y, w = tft.width(), h = tft.height();
 
   tft.fillScreen(ILI9341_BLACK);
+  drawQueue.setRotation(tft.getRotation());
   start = micros();
   for (y = 0; y < h; y += 5)
-    tft.drawFastHLine(0, y, w, color1);
+    drawQueue.drawFastHLine(0, y, w, color1);
   for (x = 0; x < w; x += 5)
-    tft.drawFastVLine(x, 0, h, color2);
+    drawQueue.drawFastVLine(x, 0, h, color2);
+  drawQueue.flush();
 
   return micros() - start;
 }
@@ -456,13 +486,15 @@ unsigned long testRects(uint16_t color)
       cy = tft.height() / 2;
 
   tft.fillScreen(ILI9341_BLACK);
+  drawQueue.setRotation(tft.getRotation());
   n = min(tft.width(), tft.height());
   start = micros();
   for (i = 2; i < n; i += 6)
   {
     i2 = i / 2;
-    tft.drawRect(cx - i2, cy - i2, i, i, color);
+    drawQueue.drawRect(cx - i2, cy - i2, i, i, color);
   }
+  drawQueue.flush();
 
   return micros() - start;
 }
@@ -632,18 +664,19 @@ void updateTimeAndDate()
     Particle.syncTime();
     delay(5000); // Wait for sync to complete
   }
-  tft.fillScreen(ILI9341_BLACK);
-  tft.setCursor(0, 0);
-  tft.setTextColor(ILI9341_YELLOW);
-  tft.setTextSize(3);
-
   snprintf(timeString, sizeof(timeString), "%02d:%02d", Time.hour(), Time.minute());
   snprintf(buffer, sizeof(buffer), " %02d-%02d-%04d", Time.month(), Time.day(), Time.year());
 
   Serial.printf("Current Time: %s\n", timeString);
   Serial.printf("Current Date: %s\n", buffer);
-  tft.println(timeString);
-  tft.println(buffer);
+  timeLabel.setText(timeString);
+  dateLabel.setText(buffer);
+  timeLabel.setColor(ILI9341_YELLOW);
+  dateLabel.setColor(ILI9341_YELLOW);
+  timeLabel.moveTo(0, 0); // Back to the top if a reminder moved it
+  dateLabel.moveTo(0, 24);
+  messageLabel.show(false);
+  screen.render(); // Only what changed, e.g. the minutes
 }
 
 // REMINDERS FUNCTIONS
@@ -651,15 +684,16 @@ void printRemindToPee()
 {
   updatePixelState(yellow);
   updateHueState(yellow);
-  tft.fillScreen(ILI9341_BLACK);
-  tft.setCursor(45, 20);
-  tft.setTextColor(ILI9341_YELLOW);
-  tft.setCursor(0, 0);
-  tft.setTextColor(ILI9341_YELLOW);
-  tft.setTextSize(3);
-  tft.println("Time to try to use \nthe restroom!");
-  tft.println(timeString);
-  tft.println(buffer);
+  timeLabel.setColor(ILI9341_YELLOW);
+  dateLabel.setColor(ILI9341_YELLOW);
+  timeLabel.moveTo(0, TFT_HEIGHT - 48); // Time and date along the bottom
+  dateLabel.moveTo(0, TFT_HEIGHT - 24);
+  messageLabel.setAlphaFont(&FreeMono18pt4a);
+  messageLabel.moveTo(0, 24);
+  messageLabel.setColor(ILI9341_YELLOW);
+  messageLabel.setText(REMIND_PEE_TEXT);
+  messageLabel.show(true);
+  screen.render();
 
   reminders.publish("Reminder to Pee");
   colors.publish(yellow);
@@ -669,15 +703,16 @@ void printRemindFeetUp()
 {
   updatePixelState(green);
   updateHueState(green);
-  tft.fillScreen(ILI9341_BLACK);
-  tft.setCursor(45, 20);
-  tft.setTextColor(ILI9341_GREEN);
-  tft.setCursor(0, 0);
-  tft.setTextColor(ILI9341_GREEN);
-  tft.setTextSize(3);
-  tft.println("Are your feet up?");
-  tft.println(timeString);
-  tft.println(buffer);
+  timeLabel.setColor(ILI9341_GREEN);
+  dateLabel.setColor(ILI9341_GREEN);
+  timeLabel.moveTo(0, TFT_HEIGHT - 48); // Time and date along the bottom
+  dateLabel.moveTo(0, TFT_HEIGHT - 24);
+  messageLabel.setAlphaFont(&FreeMono18pt4a);
+  messageLabel.moveTo(0, 24);
+  messageLabel.setColor(ILI9341_GREEN);
+  messageLabel.setText(REMIND_FEET_UP_TEXT);
+  messageLabel.show(true);
+  screen.render();
   reminders.publish("Are your feet up?");
   colors.publish(green);
   Serial.printf("Publishing %s \n", "Are your feet up?");
@@ -686,15 +721,16 @@ void printRemindMoveAround()
 {
   updatePixelState(orange);
   updateHueState(orange);
-  tft.fillScreen(ILI9341_BLACK);
-  tft.setCursor(45, 20);
-  tft.setTextColor(ILI9341_ORANGE);
-  tft.setCursor(0, 0);
-  tft.setTextColor(ILI9341_ORANGE);
-  tft.setTextSize(3);
-  tft.println("Lets get up \nand move around!");
-  tft.println(timeString);
-  tft.println(buffer);
+  timeLabel.setColor(ILI9341_ORANGE);
+  dateLabel.setColor(ILI9341_ORANGE);
+  timeLabel.moveTo(0, TFT_HEIGHT - 48); // Time and date along the bottom
+  dateLabel.moveTo(0, TFT_HEIGHT - 24);
+  messageLabel.setAlphaFont(&FreeMono18pt4a);
+  messageLabel.moveTo(0, 24);
+  messageLabel.setColor(ILI9341_ORANGE);
+  messageLabel.setText(REMIND_MOVE_TEXT);
+  messageLabel.show(true);
+  screen.render();
   reminders.publish("Time to move around");
   colors.publish(orange);
   Serial.printf("Publishing %s \n", "Time to move around");
@@ -703,15 +739,16 @@ void printMorningBreakfast()
 {
   updatePixelState(cyan);
   updateHueState(cyan);
-  tft.fillScreen(ILI9341_BLACK);
-  tft.setCursor(45, 20);
-  tft.setTextColor(ILI9341_CYAN);
-  tft.setCursor(0, 0);
-  tft.setTextColor(ILI9341_CYAN);
-  tft.setTextSize(3);
-  tft.println("Good morning Mama\nTime eat some oatemeal!!");
-  tft.println(timeString);
-  tft.println(buffer);
+  timeLabel.setColor(ILI9341_CYAN);
+  dateLabel.setColor(ILI9341_CYAN);
+  timeLabel.moveTo(0, TFT_HEIGHT - 48); // Time and date along the bottom
+  dateLabel.moveTo(0, TFT_HEIGHT - 24);
+  messageLabel.setAlphaFont(&FreeMono18pt4a);
+  messageLabel.moveTo(0, 24);
+  messageLabel.setColor(ILI9341_CYAN);
+  messageLabel.setText(REMIND_BREAKFAST_TEXT);
+  messageLabel.show(true);
+  screen.render();
   reminders.publish("breakfast time");
   colors.publish(cyan);
   Serial.printf("Publishing %s \n", "breakfast time");
@@ -720,15 +757,16 @@ void printLunchBreakReminder()
 {
   updatePixelState(red);
   updateHueState(red);
-  tft.fillScreen(ILI9341_BLACK);
-  tft.setCursor(45, 20);
-  tft.setTextColor(ILI9341_PINK);
-  tft.setCursor(0, 0);
-  tft.setTextColor(ILI9341_PINK);
-  tft.setTextSize(3);
-  tft.println("Lunch time!");
-  tft.println(timeString);
-  tft.println(buffer);
+  timeLabel.setColor(ILI9341_PINK);
+  dateLabel.setColor(ILI9341_PINK);
+  timeLabel.moveTo(0, TFT_HEIGHT - 48); // Time and date along the bottom
+  dateLabel.moveTo(0, TFT_HEIGHT - 24);
+  messageLabel.setAlphaFont(&FreeMono18pt4a);
+  messageLabel.moveTo(0, 24);
+  messageLabel.setColor(ILI9341_PINK);
+  messageLabel.setText(REMIND_LUNCH_TEXT);
+  messageLabel.show(true);
+  screen.render();
   reminders.publish("Lunch!");
   colors.publish(red);
   Serial.printf("Publishing %s \n", "Lunch!");
@@ -737,15 +775,16 @@ void printDishes()
 {
   updatePixelState(cyan);
   updateHueState(cyan);
-  tft.fillScreen(ILI9341_BLACK);
-  tft.setCursor(45, 20);
-  tft.setTextColor(ILI9341_CYAN);
-  tft.setCursor(0, 0);
-  tft.setTextColor(ILI9341_CYAN);
-  tft.setTextSize(3);
-  tft.println("Lets help out\na little and\n load the diswasher\n keep cups paired with lids!");
-  tft.println(timeString);
-  tft.println(buffer);
+  timeLabel.setColor(ILI9341_CYAN);
+  dateLabel.setColor(ILI9341_CYAN);
+  timeLabel.moveTo(0, TFT_HEIGHT - 48); // Time and date along the bottom
+  dateLabel.moveTo(0, TFT_HEIGHT - 24);
+  messageLabel.setAlphaFont(&FreeMono12pt4a); // Too long for 18 point
+  messageLabel.moveTo(0, 16);
+  messageLabel.setColor(ILI9341_CYAN);
+  messageLabel.setText(REMIND_DISHES_TEXT);
+  messageLabel.show(true);
+  screen.render();
   reminders.publish("Dishes");
   colors.publish(cyan);
   Serial.printf("Publishing %s \n", "Dishes");
@@ -754,15 +793,16 @@ void printEveningWindDown()
 {
   updatePixelState(violet);
   updateHueState(violet);
-  tft.fillScreen(ILI9341_BLACK);
-  tft.setCursor(45, 20);
-  tft.setTextColor(ILI9341_PURPLE);
-  tft.setCursor(0, 0);
-  tft.setTextColor(ILI9341_PURPLE);
-  tft.setTextSize(3);
-  tft.println("Time to WIND DOWN");
-  tft.println(timeString);
-  tft.println(buffer);
+  timeLabel.setColor(ILI9341_PURPLE);
+  dateLabel.setColor(ILI9341_PURPLE);
+  timeLabel.moveTo(0, TFT_HEIGHT - 48); // Time and date along the bottom
+  dateLabel.moveTo(0, TFT_HEIGHT - 24);
+  messageLabel.setAlphaFont(&FreeMono18pt4a);
+  messageLabel.moveTo(0, 24);
+  messageLabel.setColor(ILI9341_PURPLE);
+  messageLabel.setText(REMIND_WIND_DOWN_TEXT);
+  messageLabel.show(true);
+  screen.render();
   reminders.publish("Wind down");
   colors.publish(violet);
   Serial.printf("Publishing %s \n", "Wind down");
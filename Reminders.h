@@ -0,0 +1,20 @@
+// Reminder messages for the display, broken into lines that fit across it
+// at rotation 1 (320 pixels): 15 characters in FreeMono18pt4a (21 pixels
+// each), 22 in FreeMono12pt4a (14 pixels each). GFXlabel doesn't wrap, so
+// a longer line runs off the right edge. Adafruit_GFX_RK/test/GfxTest.cpp
+// measures each one.
+#ifndef REMINDERS_H
+#define REMINDERS_H
+
+// FreeMono18pt4a, baseline at y = 24
+#define REMIND_PEE_TEXT       "Time to try\nto use the\nrestroom!"
+#define REMIND_FEET_UP_TEXT   "Are your feet\nup?"
+#define REMIND_MOVE_TEXT      "Lets get up\nand move\naround!"
+#define REMIND_BREAKFAST_TEXT "Good morning\nMama\nTime eat some\noatemeal!!"
+#define REMIND_LUNCH_TEXT     "Lunch time!"
+#define REMIND_WIND_DOWN_TEXT "Time to WIND\nDOWN"
+
+// FreeMono12pt4a, baseline at y = 16
+#define REMIND_DISHES_TEXT    "Lets help out\na little and\nload the diswasher\nkeep cups paired\nwith lids!"
+
+#endif // REMINDERS_H